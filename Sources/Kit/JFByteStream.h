@@ -36,6 +36,32 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Types
 // =================================================================================================
 
+/**
+ * A list of the ways the bytes of a stream can be owned, which determine how `JFByteStreamFree` releases them.
+ */
+typedef NS_ENUM(UInt8, JFByteStreamOwnership)
+{
+	/**
+	 * The bytes have been allocated using `malloc` and are released using `free`.
+	 */
+	JFByteStreamOwnershipMalloc,
+	
+	/**
+	 * The bytes belong to someone else: the stream is a view and releasing it does nothing.
+	 */
+	JFByteStreamOwnershipNone,
+	
+	/**
+	 * The bytes are a read-only memory-mapped file region, whose mapping starts at `owner`; they are released using `munmap`.
+	 */
+	JFByteStreamOwnershipMapped,
+	
+	/**
+	 * The bytes belong to the retained object `owner`, which is released.
+	 */
+	JFByteStreamOwnershipObject,
+};
+
 /**
  * A container for streams of bytes.
  */
@@ -50,6 +76,16 @@ typedef struct {
 	 * The number of elements contained by `bytes`.
 	 */
 	NSUInteger length;
+	
+	/**
+	 * How the bytes are owned by this stream.
+	 */
+	JFByteStreamOwnership ownership;
+	
+	/**
+	 * The start of the mapping or the retained object owning the bytes, depending on `ownership`; `NULL` otherwise.
+	 */
+	const void* _Nullable owner;
 } JFByteStream;
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -100,7 +136,7 @@ FOUNDATION_EXPORT JFByteStream JFByteStreamCopy(JFByteStream source);
 FOUNDATION_EXPORT BOOL JFByteStreamEqualToByteStream(JFByteStream byteStream1, JFByteStream byteStream2);
 
 /**
- * Deallocates the given stream bytes.
+ * Deallocates the given stream bytes, according to their ownership: the memory allocated using `malloc` is freed, the mapped file regions are unmapped, the owning objects are released and the views are left untouched.
  * @param byteStream The stream to deallocate.
  */
 FOUNDATION_EXPORT void JFByteStreamFree(JFByteStream byteStream);
@@ -113,14 +149,53 @@ FOUNDATION_EXPORT void JFByteStreamFree(JFByteStream byteStream);
  */
 FOUNDATION_EXPORT JFByteStream JFByteStreamMake(Byte* _Nullable bytes, NSUInteger length);
 
+/**
+ * Creates a new stream wrapping the bytes of the given data object, without copying them.
+ * @discussion The stream retains the data object until it is deallocated using `JFByteStreamFree`; a mutable data object is copied first, so that later changes can't move its bytes. The bytes must not be modified.
+ * @param data The data object.
+ * @return A new stream containing the bytes of the given data object.
+ */
+FOUNDATION_EXPORT JFByteStream JFByteStreamMakeWithData(NSData* data);
+
+/**
+ * Maps the whole given file into memory, read-only, and creates a new stream wrapping it.
+ * @param path The path of the file.
+ * @param outByteStream The new stream, to deallocate using `JFByteStreamFree`; it's `JFByteStreamZero` if the file is empty.
+ * @param outError The error that occurred, if any.
+ * @return `YES` if the file has been mapped, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamMapFile(NSString* path, JFByteStream* outByteStream, NSError* __autoreleasing _Nullable * _Nullable outError);
+
+/**
+ * Maps a region of the given file into memory, read-only, and creates a new stream wrapping it.
+ * @discussion The region does not need to be aligned to the size of the memory pages. The pages are loaded only when they are accessed, so mapping a large file is cheap; the file must not be truncated while the stream is in use.
+ * @param path The path of the file.
+ * @param offset The offset of the region inside the file.
+ * @param length The length of the region; it must not go past the end of the file.
+ * @param outByteStream The new stream, to deallocate using `JFByteStreamFree`; it's `JFByteStreamZero` if the region is empty.
+ * @param outError The error that occurred, if any.
+ * @return `YES` if the region has been mapped, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamMapFileRegion(NSString* path, unsigned long long offset, NSUInteger length, JFByteStream* outByteStream, NSError* __autoreleasing _Nullable * _Nullable outError);
+
 /**
  * Reallocates the stream buffer to contain `length` elements.
+ * @discussion A stream whose bytes have not been allocated using `malloc` is copied into a new buffer first, and the original bytes are deallocated using `JFByteStreamFree`.
  * @param byteStream The stream to be modified.
  * @param length The new length of the stream.
  * @return The stream given with the parameter `byteStream`.
  */
 FOUNDATION_EXPORT JFByteStream JFByteStreamRealloc(JFByteStream byteStream, NSUInteger length);
 
+/**
+ * Creates a view of a range of the elements of the given stream, without allocating nor copying anything.
+ * @discussion The view must not be used after the source stream is deallocated; deallocating the view itself does nothing.
+ * @param source The source stream.
+ * @param range The range of the elements; it's clamped to the length of the source stream.
+ * @return A view of the given range of the source stream.
+ */
+FOUNDATION_EXPORT JFByteStream JFByteStreamSlice(JFByteStream source, NSRange range);
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 NS_ASSUME_NONNULL_END
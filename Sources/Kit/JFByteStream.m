@@ -26,6 +26,11 @@
 
 #import "JFByteStream.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 NS_ASSUME_NONNULL_BEGIN
@@ -36,7 +41,7 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Constants
 // =================================================================================================
 
-JFByteStream const JFByteStreamZero = {NULL, 0};
+JFByteStream const JFByteStreamZero = {NULL, 0, JFByteStreamOwnershipMalloc, NULL};
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
@@ -44,6 +49,73 @@ JFByteStream const JFByteStreamZero = {NULL, 0};
 // MARK: Functions
 // =================================================================================================
 
+static BOOL JFByteStreamFailWithPOSIXError(int code, NSString* path, NSError* __autoreleasing _Nullable * _Nullable outError)
+{
+	if(outError)
+		*outError = [NSError errorWithDomain:NSPOSIXErrorDomain code:code userInfo:@{NSFilePathErrorKey: path}];
+	return NO;
+}
+
+static BOOL JFByteStreamMapRegion(NSString* path, unsigned long long offset, NSUInteger length, BOOL wholeFile, JFByteStream* outByteStream, NSError* __autoreleasing _Nullable * _Nullable outError)
+{
+	*outByteStream = JFByteStreamZero;
+	
+	int fileDescriptor = open(path.fileSystemRepresentation, O_RDONLY | O_CLOEXEC);
+	if(fileDescriptor < 0)
+		return JFByteStreamFailWithPOSIXError(errno, path, outError);
+	
+	struct stat info;
+	if(fstat(fileDescriptor, &info) != 0)
+	{
+		int code = errno;
+		close(fileDescriptor);
+		return JFByteStreamFailWithPOSIXError(code, path, outError);
+	}
+	
+	unsigned long long fileSize = (unsigned long long)info.st_size;
+	if(wholeFile)
+	{
+		offset = 0;
+		length = (NSUInteger)fileSize;
+		if(length != fileSize)
+		{
+			close(fileDescriptor);
+			return JFByteStreamFailWithPOSIXError(EFBIG, path, outError);
+		}
+	}
+	else if((offset > fileSize) || (length > fileSize - offset))
+	{
+		close(fileDescriptor);
+		return JFByteStreamFailWithPOSIXError(EINVAL, path, outError);
+	}
+	
+	if(length == 0)
+	{
+		close(fileDescriptor);
+		return YES;
+	}
+	
+	// The mapping must start at a page boundary: the bytes of the first page that come before the region are mapped too, and skipped.
+	NSUInteger pageOffset = (NSUInteger)(offset % (unsigned long long)getpagesize());
+	if(length > SIZE_MAX - pageOffset)
+	{
+		close(fileDescriptor);
+		return JFByteStreamFailWithPOSIXError(EFBIG, path, outError);
+	}
+	
+	void* mapping = mmap(NULL, length + pageOffset, PROT_READ, MAP_PRIVATE, fileDescriptor, (off_t)(offset - pageOffset));
+	int code = errno;
+	close(fileDescriptor);
+	if(mapping == MAP_FAILED)
+		return JFByteStreamFailWithPOSIXError(code, path, outError);
+	
+	outByteStream->bytes = (Byte*)mapping + pageOffset;
+	outByteStream->length = length;
+	outByteStream->ownership = JFByteStreamOwnershipMapped;
+	outByteStream->owner = mapping;
+	return YES;
+}
+
 JFByteStream JFByteStreamAlloc(NSUInteger length)
 {
 	Byte* bytes = ((length > 0) ? (Byte*)malloc(length * sizeof(Byte)) : NULL);
@@ -85,8 +157,29 @@ BOOL JFByteStreamEqualToByteStream(JFByteStream byteStream1, JFByteStream byteSt
 
 void JFByteStreamFree(JFByteStream byteStream)
 {
-	if(byteStream.bytes)
-		free(byteStream.bytes);
+	switch(byteStream.ownership)
+	{
+		case JFByteStreamOwnershipMalloc:
+		{
+			if(byteStream.bytes)
+				free(byteStream.bytes);
+			break;
+		}
+		case JFByteStreamOwnershipMapped:
+		{
+			// The mapping starts at the page boundary before the bytes.
+			Byte* mapping = (Byte*)byteStream.owner;
+			munmap(mapping, (size_t)(byteStream.bytes - mapping) + byteStream.length);
+			break;
+		}
+		case JFByteStreamOwnershipObject:
+		{
+			CFRelease(byteStream.owner);
+			break;
+		}
+		default:
+			break;
+	}
 }
 
 JFByteStream JFByteStreamMake(Byte* _Nullable bytes, NSUInteger length)
@@ -94,11 +187,49 @@ JFByteStream JFByteStreamMake(Byte* _Nullable bytes, NSUInteger length)
 	JFByteStream retVal;
 	retVal.bytes = bytes;
 	retVal.length = length;
+	retVal.ownership = JFByteStreamOwnershipMalloc;
+	retVal.owner = NULL;
+	return retVal;
+}
+
+JFByteStream JFByteStreamMakeWithData(NSData* data)
+{
+	// Copying an immutable data object only retains it.
+	data = [data copy];
+	if(data.length == 0)
+		return JFByteStreamZero;
+	
+	JFByteStream retVal = JFByteStreamMake((Byte*)data.bytes, data.length);
+	retVal.ownership = JFByteStreamOwnershipObject;
+	retVal.owner = CFBridgingRetain(data);
 	return retVal;
 }
 
+BOOL JFByteStreamMapFile(NSString* path, JFByteStream* outByteStream, NSError* __autoreleasing _Nullable * _Nullable outError)
+{
+	return JFByteStreamMapRegion(path, 0, 0, YES, outByteStream, outError);
+}
+
+BOOL JFByteStreamMapFileRegion(NSString* path, unsigned long long offset, NSUInteger length, JFByteStream* outByteStream, NSError* __autoreleasing _Nullable * _Nullable outError)
+{
+	return JFByteStreamMapRegion(path, offset, length, NO, outByteStream, outError);
+}
+
 JFByteStream JFByteStreamRealloc(JFByteStream byteStream, NSUInteger length)
 {
+	if(byteStream.ownership != JFByteStreamOwnershipMalloc)
+	{
+		// Only the memory allocated using `malloc` can be reallocated: anything else is copied.
+		JFByteStream retVal = JFByteStreamAlloc(length);
+		if((length > 0) && !retVal.bytes)
+			return byteStream;
+		
+		if(byteStream.bytes)
+			memcpy(retVal.bytes, byteStream.bytes, MIN(length, byteStream.length));
+		JFByteStreamFree(byteStream);
+		return retVal;
+	}
+	
 	Byte* bytes = (Byte*)realloc(byteStream.bytes, length * sizeof(Byte));
 	if(!bytes)
 		return byteStream;
@@ -108,6 +239,16 @@ JFByteStream JFByteStreamRealloc(JFByteStream byteStream, NSUInteger length)
 	return byteStream;
 }
 
+JFByteStream JFByteStreamSlice(JFByteStream source, NSRange range)
+{
+	NSUInteger location = MIN(range.location, source.length);
+	NSUInteger length = MIN(range.length, source.length - location);
+	
+	JFByteStream retVal = JFByteStreamMake((source.bytes ? (source.bytes + location) : NULL), length);
+	retVal.ownership = JFByteStreamOwnershipNone;
+	return retVal;
+}
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,148 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFByteStream.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions (Comparison)
+// =================================================================================================
+
+/**
+ * Returns the number of leading elements that the given streams have in common.
+ * @param byteStream1 The first element of the comparison.
+ * @param byteStream2 The second element of the comparison.
+ * @return The length of the longest common prefix of the given streams.
+ */
+FOUNDATION_EXPORT NSUInteger JFByteStreamCommonPrefixLength(JFByteStream byteStream1, JFByteStream byteStream2);
+
+/**
+ * Returns whether the given stream starts with the elements of the given prefix.
+ * @param byteStream The stream to check.
+ * @param prefix The prefix to look for.
+ * @return `YES` if the given stream starts with the given prefix, `NO` otherwise; an empty prefix is contained by any stream.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamHasPrefix(JFByteStream byteStream, JFByteStream prefix);
+
+// =================================================================================================
+// MARK: Functions (Encoding)
+// =================================================================================================
+
+/**
+ * Returns the number of characters needed to encode the given number of bytes in Base64, padding included.
+ * @param length The number of bytes.
+ * @return The length of the Base64 encoding.
+ */
+FOUNDATION_EXPORT NSUInteger JFByteStreamBase64EncodedLength(NSUInteger length);
+
+/**
+ * Decodes the given Base64 characters (standard alphabet, padded, without whitespace).
+ * @param chars The characters to decode.
+ * @param length The number of characters; it must be a multiple of 4.
+ * @param buffer The buffer that receives the decoded bytes; it must be at least `length / 4 * 3` bytes long.
+ * @param outLength The number of decoded bytes.
+ * @return `YES` if the characters are a valid Base64 encoding, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamDecodeBase64(const char* chars, NSUInteger length, Byte* buffer, NSUInteger* outLength);
+
+/**
+ * Decodes the given hexadecimal characters, in upper or lower case.
+ * @param chars The characters to decode.
+ * @param length The number of characters; it must be even.
+ * @param buffer The buffer that receives the decoded bytes; it must be at least `length / 2` bytes long.
+ * @return `YES` if the characters are a valid hexadecimal encoding, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamDecodeHex(const char* chars, NSUInteger length, Byte* buffer);
+
+/**
+ * Encodes the elements of the given stream in Base64 (standard alphabet, padded).
+ * @param byteStream The stream to encode.
+ * @param buffer The buffer that receives the characters, without a terminator; it must be at least `JFByteStreamBase64EncodedLength(byteStream.length)` characters long.
+ * @return The number of characters written.
+ */
+FOUNDATION_EXPORT NSUInteger JFByteStreamEncodeBase64(JFByteStream byteStream, char* buffer);
+
+/**
+ * Encodes the elements of the given stream as lower case hexadecimal characters.
+ * @param byteStream The stream to encode.
+ * @param buffer The buffer that receives the characters, without a terminator; it must be at least `byteStream.length * 2` characters long.
+ */
+FOUNDATION_EXPORT void JFByteStreamEncodeHex(JFByteStream byteStream, char* buffer);
+
+// =================================================================================================
+// MARK: Functions (Hashing)
+// =================================================================================================
+
+/**
+ * Computes the CRC-32C (Castagnoli) checksum of the given stream, using the CRC instructions of the CPU when available.
+ * @param byteStream The stream to checksum.
+ * @param crc The checksum of the preceding elements, to continue it, or `0` to start a new one.
+ * @return The checksum of the preceding elements followed by the given stream.
+ */
+FOUNDATION_EXPORT uint32_t JFByteStreamCRC32C(JFByteStream byteStream, uint32_t crc);
+
+/**
+ * Computes the 64 bit xxHash (XXH64) of the given stream.
+ * @param byteStream The stream to hash.
+ * @param seed The seed of the hash.
+ * @return The hash of the given stream.
+ */
+FOUNDATION_EXPORT uint64_t JFByteStreamXXHash64(JFByteStream byteStream, uint64_t seed);
+
+// =================================================================================================
+// MARK: Functions (Search)
+// =================================================================================================
+
+/**
+ * Returns the index of the first occurrence of the given byte inside the given stream, starting from the given index.
+ * @param byteStream The stream to search.
+ * @param value The byte to look for.
+ * @param fromIndex The index where the search starts.
+ * @return The index of the first occurrence of the given byte, or `NSNotFound` if the byte does not occur.
+ */
+FOUNDATION_EXPORT NSUInteger JFByteStreamIndexOfByte(JFByteStream byteStream, Byte value, NSUInteger fromIndex);
+
+/**
+ * Returns the index of the first occurrence of the given pattern inside the given stream, starting from the given index.
+ * @param byteStream The stream to search.
+ * @param pattern The sequence of bytes to look for; an empty pattern is found at `fromIndex`.
+ * @param fromIndex The index where the search starts.
+ * @return The index of the first occurrence of the given pattern, or `NSNotFound` if the pattern does not occur.
+ */
+FOUNDATION_EXPORT NSUInteger JFByteStreamIndexOfByteStream(JFByteStream byteStream, JFByteStream pattern, NSUInteger fromIndex);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
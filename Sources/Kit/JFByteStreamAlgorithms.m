@@ -0,0 +1,645 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFByteStreamAlgorithms.h"
+
+#if defined(__aarch64__) || defined(__arm64__)
+#	include <arm_acle.h>
+#	include <arm_neon.h>
+#	include <sys/sysctl.h>
+#elif defined(__x86_64__)
+#	include <immintrin.h>
+#endif
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Macros
+// =================================================================================================
+
+// The vector kernels work on 16 bytes at a time: NEON is always available on arm64 and SSE2 on x86_64, so they only need to be selected at compile time. A comparison of two vectors produces a mask with `JFByteStreamVectorMaskBits` bits for each byte.
+#if defined(__aarch64__) || defined(__arm64__)
+#	define JFByteStreamVectorEnabled 1
+#	define JFByteStreamVectorMaskAll UINT64_MAX
+#	define JFByteStreamVectorMaskBits 4
+#elif defined(__SSE2__)
+#	define JFByteStreamVectorEnabled 1
+#	define JFByteStreamVectorMaskAll ((uint64_t)0xFFFF)
+#	define JFByteStreamVectorMaskBits 1
+#else
+#	define JFByteStreamVectorEnabled 0
+#endif
+
+// The CRC-32C instructions are optional: the kernel using them is compiled for the specific target and selected at runtime.
+#if defined(__aarch64__) || defined(__arm64__)
+#	define JFByteStreamCRC32CHardwareEnabled 1
+#	define JFByteStreamCRC32CHardwareTarget __attribute__((target("crc")))
+#elif defined(__x86_64__)
+#	define JFByteStreamCRC32CHardwareEnabled 1
+#	define JFByteStreamCRC32CHardwareTarget __attribute__((target("sse4.2")))
+#else
+#	define JFByteStreamCRC32CHardwareEnabled 0
+#endif
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+static char const JFByteStreamBase64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// The value of each Base64 character, or `-1` for the characters outside of the alphabet.
+static int8_t const JFByteStreamBase64Values[256] = {
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+	-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+	-1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+static uint32_t const JFByteStreamCRC32CPolynomial = 0x82F63B78;
+
+static char const JFByteStreamHexDigits[] = "0123456789abcdef";
+
+// The value of each hexadecimal digit, or `-1` for the other characters.
+static int8_t const JFByteStreamHexValues[256] = {
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1, -1,
+	-1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+static uint64_t const JFByteStreamXXHash64Prime1 = 0x9E3779B185EBCA87ULL;
+static uint64_t const JFByteStreamXXHash64Prime2 = 0xC2B2AE3D27D4EB4FULL;
+static uint64_t const JFByteStreamXXHash64Prime3 = 0x165667B19E3779F9ULL;
+static uint64_t const JFByteStreamXXHash64Prime4 = 0x85EBCA77C2B2AE63ULL;
+static uint64_t const JFByteStreamXXHash64Prime5 = 0x27D4EB2F165667C5ULL;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+typedef uint32_t (*JFByteStreamCRC32CKernel)(uint32_t crc, const Byte* bytes, NSUInteger length);
+
+#if JFByteStreamVectorEnabled
+#	if defined(__aarch64__) || defined(__arm64__)
+typedef uint8x16_t JFByteStreamVector;
+#	else
+typedef __m128i JFByteStreamVector;
+#	endif
+#endif
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Variables
+// =================================================================================================
+
+// The software CRC-32C tables, for slicing the input 8 bytes at a time.
+static uint32_t JFByteStreamCRC32CTables[8][256];
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions (Vectors)
+// =================================================================================================
+
+#if JFByteStreamVectorEnabled
+
+static inline JFByteStreamVector JFByteStreamVectorLoad(const Byte* bytes)
+{
+#	if defined(__aarch64__) || defined(__arm64__)
+	return vld1q_u8(bytes);
+#	else
+	return _mm_loadu_si128((const __m128i*)(const void*)bytes);
+#	endif
+}
+
+static inline JFByteStreamVector JFByteStreamVectorSplat(Byte value)
+{
+#	if defined(__aarch64__) || defined(__arm64__)
+	return vdupq_n_u8(value);
+#	else
+	return _mm_set1_epi8((char)value);
+#	endif
+}
+
+static inline uint64_t JFByteStreamVectorMask(JFByteStreamVector matches)
+{
+#	if defined(__aarch64__) || defined(__arm64__)
+	// NEON has no equivalent of `movemask`: narrowing each 16 bit lane by 4 bits leaves 4 bits for each byte.
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+#	else
+	return (uint64_t)(uint32_t)_mm_movemask_epi8(matches);
+#	endif
+}
+
+static inline uint64_t JFByteStreamVectorMatches(JFByteStreamVector vector1, JFByteStreamVector vector2)
+{
+#	if defined(__aarch64__) || defined(__arm64__)
+	return JFByteStreamVectorMask(vceqq_u8(vector1, vector2));
+#	else
+	return JFByteStreamVectorMask(_mm_cmpeq_epi8(vector1, vector2));
+#	endif
+}
+
+static inline uint64_t JFByteStreamVectorMatchesBoth(JFByteStreamVector vector1, JFByteStreamVector vector2, JFByteStreamVector vector3, JFByteStreamVector vector4)
+{
+#	if defined(__aarch64__) || defined(__arm64__)
+	return JFByteStreamVectorMask(vandq_u8(vceqq_u8(vector1, vector2), vceqq_u8(vector3, vector4)));
+#	else
+	return JFByteStreamVectorMask(_mm_and_si128(_mm_cmpeq_epi8(vector1, vector2), _mm_cmpeq_epi8(vector3, vector4)));
+#	endif
+}
+
+#endif
+
+// =================================================================================================
+// MARK: Functions (CRC-32C)
+// =================================================================================================
+
+static uint32_t JFByteStreamCRC32CSoftware(uint32_t crc, const Byte* bytes, NSUInteger length)
+{
+	uint32_t (*tables)[256] = JFByteStreamCRC32CTables;
+	for(; (length >= 8); bytes += 8, length -= 8)
+	{
+		uint32_t low;
+		uint32_t high;
+		memcpy(&low, bytes, sizeof(low));
+		memcpy(&high, bytes + 4, sizeof(high));
+		low = NSSwapLittleIntToHost(low) ^ crc;
+		high = NSSwapLittleIntToHost(high);
+		crc = (tables[7][low & 0xFF] ^ tables[6][(low >> 8) & 0xFF] ^ tables[5][(low >> 16) & 0xFF] ^ tables[4][low >> 24] ^ tables[3][high & 0xFF] ^ tables[2][(high >> 8) & 0xFF] ^ tables[1][(high >> 16) & 0xFF] ^ tables[0][high >> 24]);
+	}
+	for(; length > 0; bytes++, length--)
+		crc = tables[0][(crc ^ *bytes) & 0xFF] ^ (crc >> 8);
+	return crc;
+}
+
+#if JFByteStreamCRC32CHardwareEnabled
+
+JFByteStreamCRC32CHardwareTarget static uint32_t JFByteStreamCRC32CHardware(uint32_t crc, const Byte* bytes, NSUInteger length)
+{
+	for(; (length >= 8); bytes += 8, length -= 8)
+	{
+		uint64_t chunk;
+		memcpy(&chunk, bytes, sizeof(chunk));
+#	if defined(__aarch64__) || defined(__arm64__)
+		crc = __crc32cd(crc, chunk);
+#	else
+		crc = (uint32_t)_mm_crc32_u64(crc, chunk);
+#	endif
+	}
+	for(; length > 0; bytes++, length--)
+	{
+#	if defined(__aarch64__) || defined(__arm64__)
+		crc = __crc32cb(crc, *bytes);
+#	else
+		crc = _mm_crc32_u8(crc, *bytes);
+#	endif
+	}
+	return crc;
+}
+
+static BOOL JFByteStreamCRC32CHardwareAvailable(void)
+{
+#	if defined(__ARM_FEATURE_CRC32)
+	return YES;
+#	elif defined(__aarch64__) || defined(__arm64__)
+	int value = 0;
+	size_t size = sizeof(value);
+	return ((sysctlbyname("hw.optional.armv8_crc32", &value, &size, NULL, 0) == 0) && (value != 0));
+#	else
+	return (__builtin_cpu_supports("sse4.2") != 0);
+#	endif
+}
+
+#endif
+
+static JFByteStreamCRC32CKernel JFByteStreamCRC32CSelectKernel(void)
+{
+	static JFByteStreamCRC32CKernel retVal = NULL;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		for(uint32_t index = 0; index < 256; index++)
+		{
+			uint32_t crc = index;
+			for(NSUInteger bit = 0; bit < 8; bit++)
+				crc = ((crc & 1) ? ((crc >> 1) ^ JFByteStreamCRC32CPolynomial) : (crc >> 1));
+			JFByteStreamCRC32CTables[0][index] = crc;
+		}
+		for(NSUInteger table = 1; table < 8; table++)
+		{
+			for(NSUInteger index = 0; index < 256; index++)
+			{
+				uint32_t crc = JFByteStreamCRC32CTables[table - 1][index];
+				JFByteStreamCRC32CTables[table][index] = (crc >> 8) ^ JFByteStreamCRC32CTables[0][crc & 0xFF];
+			}
+		}
+		
+		retVal = JFByteStreamCRC32CSoftware;
+#if JFByteStreamCRC32CHardwareEnabled
+		if(JFByteStreamCRC32CHardwareAvailable())
+			retVal = JFByteStreamCRC32CHardware;
+#endif
+	});
+	return retVal;
+}
+
+// =================================================================================================
+// MARK: Functions (xxHash)
+// =================================================================================================
+
+static inline uint64_t JFByteStreamXXHash64Read64(const Byte* bytes)
+{
+	uint64_t retVal;
+	memcpy(&retVal, bytes, sizeof(retVal));
+	return NSSwapLittleLongLongToHost(retVal);
+}
+
+static inline uint64_t JFByteStreamXXHash64Rotate(uint64_t value, int shift)
+{
+	return ((value << shift) | (value >> (64 - shift)));
+}
+
+static inline uint64_t JFByteStreamXXHash64Round(uint64_t accumulator, uint64_t input)
+{
+	accumulator += input * JFByteStreamXXHash64Prime2;
+	return JFByteStreamXXHash64Rotate(accumulator, 31) * JFByteStreamXXHash64Prime1;
+}
+
+static inline uint64_t JFByteStreamXXHash64Merge(uint64_t accumulator, uint64_t value)
+{
+	accumulator ^= JFByteStreamXXHash64Round(0, value);
+	return accumulator * JFByteStreamXXHash64Prime1 + JFByteStreamXXHash64Prime4;
+}
+
+// =================================================================================================
+// MARK: Functions (Comparison)
+// =================================================================================================
+
+NSUInteger JFByteStreamCommonPrefixLength(JFByteStream byteStream1, JFByteStream byteStream2)
+{
+	NSUInteger length = MIN(byteStream1.length, byteStream2.length);
+	const Byte* bytes1 = byteStream1.bytes;
+	const Byte* bytes2 = byteStream2.bytes;
+	
+	NSUInteger index = 0;
+#if JFByteStreamVectorEnabled
+	for(; index + 16 <= length; index += 16)
+	{
+		uint64_t mask = JFByteStreamVectorMatches(JFByteStreamVectorLoad(bytes1 + index), JFByteStreamVectorLoad(bytes2 + index));
+		if(mask != JFByteStreamVectorMaskAll)
+			return index + (NSUInteger)__builtin_ctzll(~mask) / JFByteStreamVectorMaskBits;
+	}
+#endif
+	while((index < length) && (bytes1[index] == bytes2[index]))
+		index++;
+	return index;
+}
+
+BOOL JFByteStreamHasPrefix(JFByteStream byteStream, JFByteStream prefix)
+{
+	if(prefix.length > byteStream.length)
+		return NO;
+	
+	return ((prefix.length == 0) || (memcmp(byteStream.bytes, prefix.bytes, prefix.length) == 0));
+}
+
+// =================================================================================================
+// MARK: Functions (Encoding)
+// =================================================================================================
+
+NSUInteger JFByteStreamBase64EncodedLength(NSUInteger length)
+{
+	return ((length + 2) / 3) * 4;
+}
+
+BOOL JFByteStreamDecodeBase64(const char* chars, NSUInteger length, Byte* buffer, NSUInteger* outLength)
+{
+	if(length % 4 != 0)
+		return NO;
+	
+	const Byte* input = (const Byte*)chars;
+	NSUInteger padding = 0;
+	if((length > 0) && (input[length - 1] == '='))
+		padding = ((input[length - 2] == '=') ? 2 : 1);
+	
+	// The last group is decoded separately when it's padded.
+	NSUInteger fullLength = (padding > 0) ? (length - 4) : length;
+	Byte* output = buffer;
+	for(NSUInteger index = 0; index < fullLength; index += 4)
+	{
+		int32_t value1 = JFByteStreamBase64Values[input[index]];
+		int32_t value2 = JFByteStreamBase64Values[input[index + 1]];
+		int32_t value3 = JFByteStreamBase64Values[input[index + 2]];
+		int32_t value4 = JFByteStreamBase64Values[input[index + 3]];
+		if((value1 | value2 | value3 | value4) < 0)
+			return NO;
+		
+		uint32_t group = ((uint32_t)value1 << 18) | ((uint32_t)value2 << 12) | ((uint32_t)value3 << 6) | (uint32_t)value4;
+		output[0] = (Byte)(group >> 16);
+		output[1] = (Byte)(group >> 8);
+		output[2] = (Byte)group;
+		output += 3;
+	}
+	
+	if(padding > 0)
+	{
+		const Byte* group = input + fullLength;
+		int32_t value1 = JFByteStreamBase64Values[group[0]];
+		int32_t value2 = JFByteStreamBase64Values[group[1]];
+		int32_t value3 = ((padding == 1) ? JFByteStreamBase64Values[group[2]] : 0);
+		if((value1 | value2 | value3) < 0)
+			return NO;
+		
+		uint32_t bits = ((uint32_t)value1 << 18) | ((uint32_t)value2 << 12) | ((uint32_t)value3 << 6);
+		*output++ = (Byte)(bits >> 16);
+		if(padding == 1)
+			*output++ = (Byte)(bits >> 8);
+	}
+	
+	*outLength = (NSUInteger)(output - buffer);
+	return YES;
+}
+
+BOOL JFByteStreamDecodeHex(const char* chars, NSUInteger length, Byte* buffer)
+{
+	if(length % 2 != 0)
+		return NO;
+	
+	const Byte* input = (const Byte*)chars;
+	for(NSUInteger index = 0; index < length; index += 2)
+	{
+		int32_t high = JFByteStreamHexValues[input[index]];
+		int32_t low = JFByteStreamHexValues[input[index + 1]];
+		if((high | low) < 0)
+			return NO;
+		
+		buffer[index / 2] = (Byte)((high << 4) | low);
+	}
+	return YES;
+}
+
+NSUInteger JFByteStreamEncodeBase64(JFByteStream byteStream, char* buffer)
+{
+	const Byte* bytes = byteStream.bytes;
+	NSUInteger length = byteStream.length;
+	char* output = buffer;
+	
+	NSUInteger index = 0;
+	for(; index + 3 <= length; index += 3)
+	{
+		uint32_t group = ((uint32_t)bytes[index] << 16) | ((uint32_t)bytes[index + 1] << 8) | (uint32_t)bytes[index + 2];
+		output[0] = JFByteStreamBase64Alphabet[group >> 18];
+		output[1] = JFByteStreamBase64Alphabet[(group >> 12) & 0x3F];
+		output[2] = JFByteStreamBase64Alphabet[(group >> 6) & 0x3F];
+		output[3] = JFByteStreamBase64Alphabet[group & 0x3F];
+		output += 4;
+	}
+	
+	NSUInteger remaining = length - index;
+	if(remaining > 0)
+	{
+		uint32_t group = ((uint32_t)bytes[index] << 16) | ((remaining == 2) ? ((uint32_t)bytes[index + 1] << 8) : 0);
+		output[0] = JFByteStreamBase64Alphabet[group >> 18];
+		output[1] = JFByteStreamBase64Alphabet[(group >> 12) & 0x3F];
+		output[2] = ((remaining == 2) ? JFByteStreamBase64Alphabet[(group >> 6) & 0x3F] : '=');
+		output[3] = '=';
+		output += 4;
+	}
+	
+	return (NSUInteger)(output - buffer);
+}
+
+void JFByteStreamEncodeHex(JFByteStream byteStream, char* buffer)
+{
+	const Byte* bytes = byteStream.bytes;
+	NSUInteger length = byteStream.length;
+	
+	NSUInteger index = 0;
+#if defined(__aarch64__) || defined(__arm64__)
+	// Each nibble selects its digit through a table lookup; the interleaving store puts the two digits of each byte next to each other.
+	uint8x16_t digits = vld1q_u8((const uint8_t*)JFByteStreamHexDigits);
+	uint8x16_t lowMask = vdupq_n_u8(0x0F);
+	for(; index + 16 <= length; index += 16)
+	{
+		uint8x16_t vector = vld1q_u8(bytes + index);
+		uint8x16x2_t chars;
+		chars.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(vector, 4));
+		chars.val[1] = vqtbl1q_u8(digits, vandq_u8(vector, lowMask));
+		vst2q_u8((uint8_t*)buffer + index * 2, chars);
+	}
+#elif defined(__SSSE3__)
+	__m128i digits = _mm_loadu_si128((const __m128i*)(const void*)JFByteStreamHexDigits);
+	__m128i lowMask = _mm_set1_epi8(0x0F);
+	for(; index + 16 <= length; index += 16)
+	{
+		__m128i vector = _mm_loadu_si128((const __m128i*)(const void*)(bytes + index));
+		__m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(vector, 4), lowMask));
+		__m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(vector, lowMask));
+		_mm_storeu_si128((__m128i*)(void*)(buffer + index * 2), _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128((__m128i*)(void*)(buffer + index * 2 + 16), _mm_unpackhi_epi8(high, low));
+	}
+#endif
+	for(; index < length; index++)
+	{
+		buffer[index * 2] = JFByteStreamHexDigits[bytes[index] >> 4];
+		buffer[index * 2 + 1] = JFByteStreamHexDigits[bytes[index] & 0x0F];
+	}
+}
+
+// =================================================================================================
+// MARK: Functions (Hashing)
+// =================================================================================================
+
+uint32_t JFByteStreamCRC32C(JFByteStream byteStream, uint32_t crc)
+{
+	if(byteStream.length == 0)
+		return crc;
+	
+	return ~JFByteStreamCRC32CSelectKernel()(~crc, byteStream.bytes, byteStream.length);
+}
+
+uint64_t JFByteStreamXXHash64(JFByteStream byteStream, uint64_t seed)
+{
+	const Byte* bytes = byteStream.bytes;
+	NSUInteger length = byteStream.length;
+	
+	uint64_t retVal;
+	if(length >= 32)
+	{
+		// Four independent accumulators keep the multipliers of the CPU busy.
+		uint64_t accumulator1 = seed + JFByteStreamXXHash64Prime1 + JFByteStreamXXHash64Prime2;
+		uint64_t accumulator2 = seed + JFByteStreamXXHash64Prime2;
+		uint64_t accumulator3 = seed;
+		uint64_t accumulator4 = seed - JFByteStreamXXHash64Prime1;
+		for(; length >= 32; bytes += 32, length -= 32)
+		{
+			accumulator1 = JFByteStreamXXHash64Round(accumulator1, JFByteStreamXXHash64Read64(bytes));
+			accumulator2 = JFByteStreamXXHash64Round(accumulator2, JFByteStreamXXHash64Read64(bytes + 8));
+			accumulator3 = JFByteStreamXXHash64Round(accumulator3, JFByteStreamXXHash64Read64(bytes + 16));
+			accumulator4 = JFByteStreamXXHash64Round(accumulator4, JFByteStreamXXHash64Read64(bytes + 24));
+		}
+		retVal = JFByteStreamXXHash64Rotate(accumulator1, 1) + JFByteStreamXXHash64Rotate(accumulator2, 7) + JFByteStreamXXHash64Rotate(accumulator3, 12) + JFByteStreamXXHash64Rotate(accumulator4, 18);
+		retVal = JFByteStreamXXHash64Merge(retVal, accumulator1);
+		retVal = JFByteStreamXXHash64Merge(retVal, accumulator2);
+		retVal = JFByteStreamXXHash64Merge(retVal, accumulator3);
+		retVal = JFByteStreamXXHash64Merge(retVal, accumulator4);
+	}
+	else
+		retVal = seed + JFByteStreamXXHash64Prime5;
+	
+	retVal += (uint64_t)byteStream.length;
+	
+	for(; length >= 8; bytes += 8, length -= 8)
+	{
+		retVal ^= JFByteStreamXXHash64Round(0, JFByteStreamXXHash64Read64(bytes));
+		retVal = JFByteStreamXXHash64Rotate(retVal, 27) * JFByteStreamXXHash64Prime1 + JFByteStreamXXHash64Prime4;
+	}
+	if(length >= 4)
+	{
+		uint32_t value;
+		memcpy(&value, bytes, sizeof(value));
+		retVal ^= (uint64_t)NSSwapLittleIntToHost(value) * JFByteStreamXXHash64Prime1;
+		retVal = JFByteStreamXXHash64Rotate(retVal, 23) * JFByteStreamXXHash64Prime2 + JFByteStreamXXHash64Prime3;
+		bytes += 4;
+		length -= 4;
+	}
+	for(; length > 0; bytes++, length--)
+	{
+		retVal ^= (uint64_t)*bytes * JFByteStreamXXHash64Prime5;
+		retVal = JFByteStreamXXHash64Rotate(retVal, 11) * JFByteStreamXXHash64Prime1;
+	}
+	
+	retVal ^= retVal >> 33;
+	retVal *= JFByteStreamXXHash64Prime2;
+	retVal ^= retVal >> 29;
+	retVal *= JFByteStreamXXHash64Prime3;
+	retVal ^= retVal >> 32;
+	return retVal;
+}
+
+// =================================================================================================
+// MARK: Functions (Search)
+// =================================================================================================
+
+NSUInteger JFByteStreamIndexOfByte(JFByteStream byteStream, Byte value, NSUInteger fromIndex)
+{
+	if(fromIndex >= byteStream.length)
+		return NSNotFound;
+	
+	// The system implementation of `memchr` is already vectorized.
+	const Byte* found = (const Byte*)memchr(byteStream.bytes + fromIndex, value, byteStream.length - fromIndex);
+	return (found ? (NSUInteger)(found - byteStream.bytes) : NSNotFound);
+}
+
+NSUInteger JFByteStreamIndexOfByteStream(JFByteStream byteStream, JFByteStream pattern, NSUInteger fromIndex)
+{
+	NSUInteger length = byteStream.length;
+	NSUInteger patternLength = pattern.length;
+	if((fromIndex > length) || (patternLength > length - fromIndex))
+		return NSNotFound;
+	
+	if(patternLength == 0)
+		return fromIndex;
+	
+	const Byte* bytes = byteStream.bytes;
+	const Byte* patternBytes = pattern.bytes;
+	if(patternLength == 1)
+		return JFByteStreamIndexOfByte(byteStream, patternBytes[0], fromIndex);
+	
+	// The index of the last position where the pattern can start.
+	NSUInteger lastIndex = length - patternLength;
+	NSUInteger index = fromIndex;
+
+#if JFByteStreamVectorEnabled
+	// The candidates are the positions where both the first and the last byte of the pattern match: 16 positions are checked at once, and only the candidates are compared in full.
+	JFByteStreamVector firstByte = JFByteStreamVectorSplat(patternBytes[0]);
+	JFByteStreamVector lastByte = JFByteStreamVectorSplat(patternBytes[patternLength - 1]);
+	uint64_t laneMask = ((uint64_t)1 << JFByteStreamVectorMaskBits) - 1;
+	for(; index + 15 <= lastIndex; index += 16)
+	{
+		uint64_t mask = JFByteStreamVectorMatchesBoth(JFByteStreamVectorLoad(bytes + index), firstByte, JFByteStreamVectorLoad(bytes + index + patternLength - 1), lastByte);
+		while(mask != 0)
+		{
+			NSUInteger offset = (NSUInteger)__builtin_ctzll(mask) / JFByteStreamVectorMaskBits;
+			if(memcmp(bytes + index + offset + 1, patternBytes + 1, patternLength - 2) == 0)
+				return index + offset;
+			mask &= ~(laneMask << (offset * JFByteStreamVectorMaskBits));
+		}
+	}
+#endif
+
+	while(index <= lastIndex)
+	{
+		const Byte* found = (const Byte*)memchr(bytes + index, patternBytes[0], lastIndex - index + 1);
+		if(!found)
+			break;
+		
+		index = (NSUInteger)(found - bytes);
+		if(memcmp(found + 1, patternBytes + 1, patternLength - 1) == 0)
+			return index;
+		index++;
+	}
+	return NSNotFound;
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
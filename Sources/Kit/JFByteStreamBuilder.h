@@ -0,0 +1,256 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFByteStream.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * A region allocator that serves the buffers of many short-lived builders from a few large slabs.
+ * @discussion Allocating from an arena only moves a pointer forward inside the current slab; the memory is given back all at once by resetting or destroying the arena. Arenas are not thread safe.
+ */
+typedef struct JFByteStreamArena JFByteStreamArena;
+
+/**
+ * A growable stream of bytes, used to build a `JFByteStream` incrementally.
+ * @discussion The buffer grows geometrically, so that appending in a loop takes linear time. Once an append fails for lack of memory the builder is marked as failed, and every following append fails without changing its content.
+ */
+typedef struct {
+	
+	/**
+	 * The bytes written so far; `stream.length` is the number of bytes written, not the size of the buffer.
+	 */
+	JFByteStream stream;
+	
+	/**
+	 * The size of the buffer of `stream`, in bytes.
+	 */
+	NSUInteger capacity;
+	
+	/**
+	 * The arena that allocates the buffer, or `NULL` if it is allocated on the heap.
+	 */
+	JFByteStreamArena* _Nullable arena;
+	
+	/**
+	 * `YES` if an append failed for lack of memory, `NO` otherwise.
+	 */
+	BOOL failed;
+} JFByteStreamBuilder;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions (Arena)
+// =================================================================================================
+
+/**
+ * Creates a new arena.
+ * @param slabSize The size of each slab in bytes, or `0` to use the default size (64 KB); bigger buffers get a slab of their own.
+ * @return A new arena, or `NULL` if there is not enough memory.
+ */
+FOUNDATION_EXPORT JFByteStreamArena* _Nullable JFByteStreamArenaCreate(NSUInteger slabSize);
+
+/**
+ * Destroys the given arena, deallocating all the buffers allocated by it.
+ * @param arena The arena to destroy.
+ */
+FOUNDATION_EXPORT void JFByteStreamArenaDestroy(JFByteStreamArena* arena);
+
+/**
+ * Deallocates all the buffers allocated by the given arena at once, keeping its slabs to serve the next ones.
+ * @param arena The arena to reset.
+ * @warning The streams and the builders using the arena must not be used anymore after this call.
+ */
+FOUNDATION_EXPORT void JFByteStreamArenaReset(JFByteStreamArena* arena);
+
+// =================================================================================================
+// MARK: Functions (Builder)
+// =================================================================================================
+
+/**
+ * Creates a new builder whose buffer is allocated on the heap.
+ * @param capacity The initial size of the buffer, in bytes; it can be `0`.
+ * @return A new empty builder; it's marked as failed if the buffer could not be allocated.
+ */
+FOUNDATION_EXPORT JFByteStreamBuilder JFByteStreamBuilderAlloc(NSUInteger capacity);
+
+/**
+ * Creates a new builder whose buffer is allocated by the given arena.
+ * @param arena The arena that allocates the buffer.
+ * @param capacity The initial size of the buffer, in bytes; it can be `0`.
+ * @return A new empty builder; it's marked as failed if the buffer could not be allocated.
+ */
+FOUNDATION_EXPORT JFByteStreamBuilder JFByteStreamBuilderAllocInArena(JFByteStreamArena* arena, NSUInteger capacity);
+
+/**
+ * Appends a single byte to the given builder.
+ * @param builder The builder to modify.
+ * @param value The byte to append.
+ * @return `YES` if the byte has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendByte(JFByteStreamBuilder* builder, Byte value);
+
+/**
+ * Appends the given bytes to the given builder.
+ * @param builder The builder to modify.
+ * @param bytes The bytes to append; they must not belong to the buffer of the builder.
+ * @param length The number of bytes to append.
+ * @return `YES` if the bytes have been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendBytes(JFByteStreamBuilder* builder, const void* _Nullable bytes, NSUInteger length);
+
+/**
+ * Appends the elements of the given stream to the given builder.
+ * @param builder The builder to modify.
+ * @param byteStream The stream to append.
+ * @return `YES` if the stream has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendByteStream(JFByteStreamBuilder* builder, JFByteStream byteStream);
+
+/**
+ * Appends the given signed integer to the given builder as a ZigZag encoded varint, so that small negative values take few bytes too.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendSignedVarint(JFByteStreamBuilder* builder, int64_t value);
+
+/**
+ * Appends the given integer to the given builder in big endian byte order.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendUInt16BigEndian(JFByteStreamBuilder* builder, uint16_t value);
+
+/**
+ * Appends the given integer to the given builder in little endian byte order.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendUInt16LittleEndian(JFByteStreamBuilder* builder, uint16_t value);
+
+/**
+ * Appends the given integer to the given builder in big endian byte order.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendUInt32BigEndian(JFByteStreamBuilder* builder, uint32_t value);
+
+/**
+ * Appends the given integer to the given builder in little endian byte order.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendUInt32LittleEndian(JFByteStreamBuilder* builder, uint32_t value);
+
+/**
+ * Appends the given integer to the given builder in big endian byte order.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendUInt64BigEndian(JFByteStreamBuilder* builder, uint64_t value);
+
+/**
+ * Appends the given integer to the given builder in little endian byte order.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendUInt64LittleEndian(JFByteStreamBuilder* builder, uint64_t value);
+
+/**
+ * Appends the given unsigned integer to the given builder as a varint (LEB128): 7 bits per byte, least significant group first.
+ * @param builder The builder to modify.
+ * @param value The value to append.
+ * @return `YES` if the value has been appended, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderAppendVarint(JFByteStreamBuilder* builder, uint64_t value);
+
+/**
+ * Increases the length of the given builder by the given number of bytes, leaving them uninitialized.
+ * @param builder The builder to modify.
+ * @param length The number of bytes to add.
+ * @return A pointer to the first added byte, which the caller must fill, or `NULL` if there is not enough memory.
+ * @warning The returned pointer is valid only until the next change of the builder.
+ */
+FOUNDATION_EXPORT Byte* _Nullable JFByteStreamBuilderExtend(JFByteStreamBuilder* builder, NSUInteger length);
+
+/**
+ * Hands out the stream built by the given builder, which is left empty and can be reused.
+ * @discussion A stream allocated on the heap is shrunk to its length and must be deallocated using `JFByteStreamFree`; a stream allocated by an arena is a view, valid until the arena is reset or destroyed.
+ * @param builder The builder to empty.
+ * @return The stream built by the given builder.
+ */
+FOUNDATION_EXPORT JFByteStream JFByteStreamBuilderFinish(JFByteStreamBuilder* builder);
+
+/**
+ * Deallocates the buffer of the given builder, which is left empty and can be reused.
+ * @param builder The builder to empty.
+ */
+FOUNDATION_EXPORT void JFByteStreamBuilderFree(JFByteStreamBuilder* builder);
+
+/**
+ * Grows the buffer of the given builder, if needed, so that the given number of bytes can be appended without allocating memory again.
+ * @param builder The builder to modify.
+ * @param length The number of bytes that will be appended.
+ * @return `YES` if the buffer is big enough, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderReserve(JFByteStreamBuilder* builder, NSUInteger length);
+
+/**
+ * Discards the bytes written so far, keeping the buffer of the given builder, and clears its failure.
+ * @param builder The builder to modify.
+ */
+FOUNDATION_EXPORT void JFByteStreamBuilderReset(JFByteStreamBuilder* builder);
+
+/**
+ * Shrinks the buffer of the given builder to its length.
+ * @param builder The builder to modify.
+ * @return `YES` if the buffer has been shrunk, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFByteStreamBuilderShrinkToFit(JFByteStreamBuilder* builder);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
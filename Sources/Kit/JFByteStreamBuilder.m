@@ -0,0 +1,454 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFByteStreamBuilder.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+static NSUInteger const JFByteStreamArenaDefaultSlabSize = 64 * 1024;
+static NSUInteger const JFByteStreamBuilderMinimumCapacity = 64;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+typedef struct JFByteStreamArenaSlab {
+	
+	// The next slab of the same list.
+	struct JFByteStreamArenaSlab* _Nullable next;
+	
+	// The number of bytes of `bytes`.
+	NSUInteger capacity;
+	
+	// The number of bytes of `bytes` already allocated.
+	NSUInteger offset;
+	
+	// The memory served by this slab.
+	Byte bytes[];
+} JFByteStreamArenaSlab;
+
+struct JFByteStreamArena {
+	
+	// The slabs in use: the first one is the slab that serves the next allocations.
+	JFByteStreamArenaSlab* _Nullable slabs;
+	
+	// The size of a standard slab.
+	NSUInteger slabSize;
+	
+	// The standard slabs kept by the last reset, ready to be used again.
+	JFByteStreamArenaSlab* _Nullable spareSlabs;
+};
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions (Arena)
+// =================================================================================================
+
+static JFByteStreamArenaSlab* _Nullable JFByteStreamArenaSlabAlloc(NSUInteger capacity)
+{
+	JFByteStreamArenaSlab* retVal = (JFByteStreamArenaSlab*)malloc(sizeof(JFByteStreamArenaSlab) + capacity);
+	if(!retVal)
+		return NULL;
+	
+	retVal->next = NULL;
+	retVal->capacity = capacity;
+	retVal->offset = 0;
+	return retVal;
+}
+
+static void JFByteStreamArenaSlabFreeList(JFByteStreamArenaSlab* _Nullable slab)
+{
+	while(slab)
+	{
+		JFByteStreamArenaSlab* next = slab->next;
+		free(slab);
+		slab = next;
+	}
+}
+
+static Byte* _Nullable JFByteStreamArenaAllocate(JFByteStreamArena* arena, NSUInteger size)
+{
+	JFByteStreamArenaSlab* slab = arena->slabs;
+	if(slab && (slab->capacity - slab->offset >= size))
+	{
+		Byte* retVal = slab->bytes + slab->offset;
+		slab->offset += size;
+		return retVal;
+	}
+	
+	// Big buffers get a slab of their own, which is placed behind the current one so that it keeps serving the small buffers.
+	if(size > arena->slabSize / 2)
+	{
+		JFByteStreamArenaSlab* bigSlab = JFByteStreamArenaSlabAlloc(size);
+		if(!bigSlab)
+			return NULL;
+		
+		bigSlab->offset = size;
+		if(slab)
+		{
+			bigSlab->next = slab->next;
+			slab->next = bigSlab;
+		}
+		else
+			arena->slabs = bigSlab;
+		return bigSlab->bytes;
+	}
+	
+	JFByteStreamArenaSlab* newSlab = arena->spareSlabs;
+	if(newSlab)
+		arena->spareSlabs = newSlab->next;
+	else
+	{
+		newSlab = JFByteStreamArenaSlabAlloc(arena->slabSize);
+		if(!newSlab)
+			return NULL;
+	}
+	
+	newSlab->next = slab;
+	newSlab->offset = size;
+	arena->slabs = newSlab;
+	return newSlab->bytes;
+}
+
+static BOOL JFByteStreamArenaIsLastAllocation(JFByteStreamArena* arena, Byte* _Nullable bytes, NSUInteger size)
+{
+	JFByteStreamArenaSlab* slab = arena->slabs;
+	return (bytes && slab && (bytes >= slab->bytes) && (bytes + size == slab->bytes + slab->offset));
+}
+
+static void JFByteStreamArenaRelease(JFByteStreamArena* arena, Byte* _Nullable bytes, NSUInteger size)
+{
+	// Only the last allocation can be given back before the next reset.
+	if(JFByteStreamArenaIsLastAllocation(arena, bytes, size))
+		arena->slabs->offset -= size;
+}
+
+static Byte* _Nullable JFByteStreamArenaResize(JFByteStreamArena* arena, Byte* _Nullable bytes, NSUInteger size, NSUInteger usedSize, NSUInteger newSize)
+{
+	// The last allocation can grow or shrink in place, as long as it fits in its slab.
+	if(JFByteStreamArenaIsLastAllocation(arena, bytes, size))
+	{
+		JFByteStreamArenaSlab* slab = arena->slabs;
+		NSUInteger start = (NSUInteger)(bytes - slab->bytes);
+		if(slab->capacity - start >= newSize)
+		{
+			slab->offset = start + newSize;
+			return bytes;
+		}
+	}
+	
+	Byte* retVal = JFByteStreamArenaAllocate(arena, newSize);
+	if(retVal && bytes)
+		memcpy(retVal, bytes, MIN(usedSize, newSize));
+	return retVal;
+}
+
+JFByteStreamArena* _Nullable JFByteStreamArenaCreate(NSUInteger slabSize)
+{
+	JFByteStreamArena* retVal = (JFByteStreamArena*)malloc(sizeof(JFByteStreamArena));
+	if(!retVal)
+		return NULL;
+	
+	retVal->slabs = NULL;
+	retVal->slabSize = ((slabSize > 0) ? slabSize : JFByteStreamArenaDefaultSlabSize);
+	retVal->spareSlabs = NULL;
+	return retVal;
+}
+
+void JFByteStreamArenaDestroy(JFByteStreamArena* arena)
+{
+	JFByteStreamArenaSlabFreeList(arena->slabs);
+	JFByteStreamArenaSlabFreeList(arena->spareSlabs);
+	free(arena);
+}
+
+void JFByteStreamArenaReset(JFByteStreamArena* arena)
+{
+	// The standard slabs are kept for the next allocations, the big ones are deallocated.
+	JFByteStreamArenaSlab* slab = arena->slabs;
+	while(slab)
+	{
+		JFByteStreamArenaSlab* next = slab->next;
+		if(slab->capacity == arena->slabSize)
+		{
+			slab->offset = 0;
+			slab->next = arena->spareSlabs;
+			arena->spareSlabs = slab;
+		}
+		else
+			free(slab);
+		slab = next;
+	}
+	arena->slabs = NULL;
+}
+
+// =================================================================================================
+// MARK: Functions (Builder)
+// =================================================================================================
+
+static BOOL JFByteStreamBuilderResize(JFByteStreamBuilder* builder, NSUInteger capacity)
+{
+	Byte* bytes = builder->stream.bytes;
+	JFByteStreamArena* arena = builder->arena;
+	if(arena)
+		bytes = JFByteStreamArenaResize(arena, bytes, builder->capacity, builder->stream.length, capacity);
+	else
+		bytes = (Byte*)realloc(bytes, capacity * sizeof(Byte));
+	
+	if(!bytes)
+	{
+		builder->failed = YES;
+		return NO;
+	}
+	
+	builder->stream.bytes = bytes;
+	builder->capacity = capacity;
+	return YES;
+}
+
+JFByteStreamBuilder JFByteStreamBuilderAlloc(NSUInteger capacity)
+{
+	JFByteStreamBuilder retVal = {JFByteStreamZero, 0, NULL, NO};
+	if(capacity > 0)
+		JFByteStreamBuilderResize(&retVal, capacity);
+	return retVal;
+}
+
+JFByteStreamBuilder JFByteStreamBuilderAllocInArena(JFByteStreamArena* arena, NSUInteger capacity)
+{
+	JFByteStreamBuilder retVal = {JFByteStreamZero, 0, arena, NO};
+	if(capacity > 0)
+		JFByteStreamBuilderResize(&retVal, capacity);
+	return retVal;
+}
+
+BOOL JFByteStreamBuilderAppendByte(JFByteStreamBuilder* builder, Byte value)
+{
+	if(!builder->failed && (builder->stream.length < builder->capacity))
+	{
+		builder->stream.bytes[builder->stream.length++] = value;
+		return YES;
+	}
+	
+	Byte* bytes = JFByteStreamBuilderExtend(builder, 1);
+	if(!bytes)
+		return NO;
+	
+	*bytes = value;
+	return YES;
+}
+
+BOOL JFByteStreamBuilderAppendBytes(JFByteStreamBuilder* builder, const void* _Nullable bytes, NSUInteger length)
+{
+	if(length == 0)
+		return !builder->failed;
+	
+	Byte* destination = JFByteStreamBuilderExtend(builder, length);
+	if(!destination)
+		return NO;
+	
+	memcpy(destination, bytes, length);
+	return YES;
+}
+
+BOOL JFByteStreamBuilderAppendByteStream(JFByteStreamBuilder* builder, JFByteStream byteStream)
+{
+	return JFByteStreamBuilderAppendBytes(builder, byteStream.bytes, byteStream.length);
+}
+
+BOOL JFByteStreamBuilderAppendSignedVarint(JFByteStreamBuilder* builder, int64_t value)
+{
+	// ZigZag encoding: 0, -1, 1, -2, 2… become 0, 1, 2, 3, 4…
+	return JFByteStreamBuilderAppendVarint(builder, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+BOOL JFByteStreamBuilderAppendUInt16BigEndian(JFByteStreamBuilder* builder, uint16_t value)
+{
+	value = NSSwapHostShortToBig(value);
+	return JFByteStreamBuilderAppendBytes(builder, &value, sizeof(value));
+}
+
+BOOL JFByteStreamBuilderAppendUInt16LittleEndian(JFByteStreamBuilder* builder, uint16_t value)
+{
+	value = NSSwapHostShortToLittle(value);
+	return JFByteStreamBuilderAppendBytes(builder, &value, sizeof(value));
+}
+
+BOOL JFByteStreamBuilderAppendUInt32BigEndian(JFByteStreamBuilder* builder, uint32_t value)
+{
+	value = NSSwapHostIntToBig(value);
+	return JFByteStreamBuilderAppendBytes(builder, &value, sizeof(value));
+}
+
+BOOL JFByteStreamBuilderAppendUInt32LittleEndian(JFByteStreamBuilder* builder, uint32_t value)
+{
+	value = NSSwapHostIntToLittle(value);
+	return JFByteStreamBuilderAppendBytes(builder, &value, sizeof(value));
+}
+
+BOOL JFByteStreamBuilderAppendUInt64BigEndian(JFByteStreamBuilder* builder, uint64_t value)
+{
+	value = NSSwapHostLongLongToBig(value);
+	return JFByteStreamBuilderAppendBytes(builder, &value, sizeof(value));
+}
+
+BOOL JFByteStreamBuilderAppendUInt64LittleEndian(JFByteStreamBuilder* builder, uint64_t value)
+{
+	value = NSSwapHostLongLongToLittle(value);
+	return JFByteStreamBuilderAppendBytes(builder, &value, sizeof(value));
+}
+
+BOOL JFByteStreamBuilderAppendVarint(JFByteStreamBuilder* builder, uint64_t value)
+{
+	Byte buffer[10];
+	NSUInteger length = 0;
+	while(value >= 0x80)
+	{
+		buffer[length++] = (Byte)(value | 0x80);
+		value >>= 7;
+	}
+	buffer[length++] = (Byte)value;
+	return JFByteStreamBuilderAppendBytes(builder, buffer, length);
+}
+
+Byte* _Nullable JFByteStreamBuilderExtend(JFByteStreamBuilder* builder, NSUInteger length)
+{
+	if(!JFByteStreamBuilderReserve(builder, length))
+		return NULL;
+	
+	Byte* retVal = builder->stream.bytes + builder->stream.length;
+	builder->stream.length += length;
+	return retVal;
+}
+
+JFByteStream JFByteStreamBuilderFinish(JFByteStreamBuilder* builder)
+{
+	// If shrinking fails the stream is still valid, only bigger than needed.
+	JFByteStreamBuilderShrinkToFit(builder);
+	
+	// The memory of an arena is given back by the arena itself, not by deallocating the stream.
+	JFByteStream retVal = builder->stream;
+	if(builder->arena)
+		retVal.ownership = JFByteStreamOwnershipNone;
+	
+	builder->stream = JFByteStreamZero;
+	builder->capacity = 0;
+	builder->failed = NO;
+	return retVal;
+}
+
+void JFByteStreamBuilderFree(JFByteStreamBuilder* builder)
+{
+	JFByteStreamArena* arena = builder->arena;
+	if(arena)
+		JFByteStreamArenaRelease(arena, builder->stream.bytes, builder->capacity);
+	else
+		JFByteStreamFree(builder->stream);
+	
+	builder->stream = JFByteStreamZero;
+	builder->capacity = 0;
+	builder->failed = NO;
+}
+
+BOOL JFByteStreamBuilderReserve(JFByteStreamBuilder* builder, NSUInteger length)
+{
+	if(builder->failed)
+		return NO;
+	
+	NSUInteger used = builder->stream.length;
+	if(length <= builder->capacity - used)
+		return YES;
+	
+	if(length > NSUIntegerMax - used)
+	{
+		builder->failed = YES;
+		return NO;
+	}
+	
+	// The buffer at least doubles, so that appending in a loop reallocates it only a logarithmic number of times.
+	NSUInteger capacity = builder->capacity;
+	capacity = ((capacity > NSUIntegerMax / 2) ? NSUIntegerMax : capacity * 2);
+	capacity = MAX(MAX(capacity, used + length), JFByteStreamBuilderMinimumCapacity);
+	return JFByteStreamBuilderResize(builder, capacity);
+}
+
+void JFByteStreamBuilderReset(JFByteStreamBuilder* builder)
+{
+	builder->stream.length = 0;
+	builder->failed = NO;
+}
+
+BOOL JFByteStreamBuilderShrinkToFit(JFByteStreamBuilder* builder)
+{
+	NSUInteger length = builder->stream.length;
+	if(length == builder->capacity)
+		return YES;
+	
+	JFByteStreamArena* arena = builder->arena;
+	if(arena)
+	{
+		// Memory in the middle of a slab can't be given back: only the last allocation can shrink.
+		if(!JFByteStreamArenaIsLastAllocation(arena, builder->stream.bytes, builder->capacity))
+			return NO;
+		
+		arena->slabs->offset -= (builder->capacity - length);
+		builder->capacity = length;
+		return YES;
+	}
+	
+	if(length == 0)
+	{
+		JFByteStreamFree(builder->stream);
+		builder->stream.bytes = NULL;
+		builder->capacity = 0;
+		return YES;
+	}
+	
+	Byte* bytes = (Byte*)realloc(builder->stream.bytes, length * sizeof(Byte));
+	if(!bytes)
+		return NO;
+	
+	builder->stream.bytes = bytes;
+	builder->capacity = length;
+	return YES;
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
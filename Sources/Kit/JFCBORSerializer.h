@@ -0,0 +1,83 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFJSONSerializationAdapter.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * A list of error codes that can be found inside errors created by the class `JFCBORSerializer`.
+ */
+typedef NS_ENUM(NSInteger, JFCBORSerializerError) {
+	
+	/**
+	 * A string can't be converted to UTF-8, for example because it contains an unpaired surrogate.
+	 */
+	JFCBORSerializerErrorInvalidString,
+	
+	/**
+	 * The value can't be encoded, for example an object of a class that is not a JSON value, a dictionary key that is not a string or a value nested too deeply.
+	 */
+	JFCBORSerializerErrorInvalidValue,
+};
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * This JSON serializer converts JSON nodes to and from the Concise Binary Object Representation (CBOR, RFC 8949).
+ * @discussion Numbers keep their exact type (signed and unsigned integers, single and double precision floating point values and booleans) and every string, array and map is encoded with its length up front, so that the decoder can preallocate its containers. When used by a JSON node, data is decoded directly into the node and the node is encoded without converting it to SDK native data objects first.
+ * @warning The string based methods of this serializer use the Base64 representation of the CBOR data.
+ */
+API_AVAILABLE(ios(8.0), macos(10.9))
+@interface JFCBORSerializer : NSObject <JFJSONSerializationAdapter>
+
+// =================================================================================================
+// MARK: Properties - Errors
+// =================================================================================================
+
+/**
+ * The domain of the errors created by the serializer.
+ */
+@property (class, strong, nonatomic, readonly) NSErrorDomain errorDomain;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,805 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFCBORSerializer.h"
+
+#import "JFByteStreamBuilder.h"
+#import "JFErrorFactory.h"
+#import "JFJSONArray_Project.h"
+#import "JFJSONObject_Project.h"
+#import "JFKitLogger.h"
+#import "JFShortcuts.h"
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFCBORSerializer (/* Private */)
+
+// =================================================================================================
+// MARK: Properties - Errors
+// =================================================================================================
+
+@property (class, strong, nonatomic, readonly) JFErrorFactory* errorFactory;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (NSData* _Nullable)dataFromNode:(id _Nullable)node;
+- (NSData* _Nullable)dataFromString:(NSString* _Nullable)string;
+- (BOOL)importData:(NSData* _Nullable)data majorType:(uint8_t)majorType into:(id)container nodes:(BOOL)nodes;
+- (NSString* _Nullable)stringFromData:(NSData* _Nullable)data;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+static NSUInteger const JFCBORMaxDepth = 512;
+
+static uint8_t const JFCBORMajorTypeUnsigned = 0;
+static uint8_t const JFCBORMajorTypeNegative = 1;
+static uint8_t const JFCBORMajorTypeBytes = 2;
+static uint8_t const JFCBORMajorTypeText = 3;
+static uint8_t const JFCBORMajorTypeArray = 4;
+static uint8_t const JFCBORMajorTypeMap = 5;
+static uint8_t const JFCBORMajorTypeTag = 6;
+static uint8_t const JFCBORMajorTypeSimple = 7;
+
+static uint8_t const JFCBORInfoIndefinite = 31;
+
+static uint8_t const JFCBORSimpleFalse = 20;
+static uint8_t const JFCBORSimpleTrue = 21;
+static uint8_t const JFCBORSimpleNull = 22;
+static uint8_t const JFCBORSimpleUndefined = 23;
+static uint8_t const JFCBORSimpleHalf = 25;
+static uint8_t const JFCBORSimpleFloat = 26;
+static uint8_t const JFCBORSimpleDouble = 27;
+
+static uint8_t const JFCBORBreak = 0xFF;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+typedef struct {
+	const uint8_t* bytes;
+	NSUInteger length;
+	NSUInteger offset;
+} JFCBORReader;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions (Encoding)
+// =================================================================================================
+
+static void JFCBORAppendHeader(JFByteStreamBuilder* builder, uint8_t majorType, uint64_t value)
+{
+	uint8_t buffer[9];
+	NSUInteger length;
+	uint8_t initial = (uint8_t)(majorType << 5);
+	if(value < 24)
+	{
+		buffer[0] = initial | (uint8_t)value;
+		length = 1;
+	}
+	else if(value <= UINT8_MAX)
+	{
+		buffer[0] = initial | 24;
+		buffer[1] = (uint8_t)value;
+		length = 2;
+	}
+	else if(value <= UINT16_MAX)
+	{
+		uint16_t swapped = NSSwapHostShortToBig((uint16_t)value);
+		buffer[0] = initial | 25;
+		memcpy(&buffer[1], &swapped, sizeof(swapped));
+		length = 3;
+	}
+	else if(value <= UINT32_MAX)
+	{
+		uint32_t swapped = NSSwapHostIntToBig((uint32_t)value);
+		buffer[0] = initial | 26;
+		memcpy(&buffer[1], &swapped, sizeof(swapped));
+		length = 5;
+	}
+	else
+	{
+		uint64_t swapped = NSSwapHostLongLongToBig(value);
+		buffer[0] = initial | 27;
+		memcpy(&buffer[1], &swapped, sizeof(swapped));
+		length = 9;
+	}
+	JFByteStreamBuilderAppendBytes(builder, buffer, length);
+}
+
+static void JFCBORAppendDouble(JFByteStreamBuilder* builder, double value)
+{
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	bits = NSSwapHostLongLongToBig(bits);
+	uint8_t buffer[9] = {(uint8_t)((JFCBORMajorTypeSimple << 5) | JFCBORSimpleDouble)};
+	memcpy(&buffer[1], &bits, sizeof(bits));
+	JFByteStreamBuilderAppendBytes(builder, buffer, sizeof(buffer));
+}
+
+static void JFCBORAppendInteger(JFByteStreamBuilder* builder, int64_t value)
+{
+	if(value >= 0)
+		JFCBORAppendHeader(builder, JFCBORMajorTypeUnsigned, (uint64_t)value);
+	else
+		JFCBORAppendHeader(builder, JFCBORMajorTypeNegative, (uint64_t)(-1 - value));
+}
+
+static void JFCBORAppendNumber(JFByteStreamBuilder* builder, NSNumber* number)
+{
+	if(CFGetTypeID((__bridge CFTypeRef)number) == CFBooleanGetTypeID())
+	{
+		uint8_t byte = (uint8_t)((JFCBORMajorTypeSimple << 5) | (number.boolValue ? JFCBORSimpleTrue : JFCBORSimpleFalse));
+		JFByteStreamBuilderAppendByte(builder, byte);
+		return;
+	}
+	
+	switch(number.objCType[0])
+	{
+		case 'c':
+		case 'i':
+		case 'l':
+		case 'q':
+		case 's':
+		{
+			JFCBORAppendInteger(builder, number.longLongValue);
+			return;
+		}
+		case 'C':
+		case 'I':
+		case 'L':
+		case 'Q':
+		case 'S':
+		{
+			JFCBORAppendHeader(builder, JFCBORMajorTypeUnsigned, number.unsignedLongLongValue);
+			return;
+		}
+		case 'f':
+		{
+			float value = number.floatValue;
+			uint32_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			bits = NSSwapHostIntToBig(bits);
+			uint8_t buffer[5] = {(uint8_t)((JFCBORMajorTypeSimple << 5) | JFCBORSimpleFloat)};
+			memcpy(&buffer[1], &bits, sizeof(bits));
+			JFByteStreamBuilderAppendBytes(builder, buffer, sizeof(buffer));
+			return;
+		}
+		default:
+		{
+			JFCBORAppendDouble(builder, number.doubleValue);
+			return;
+		}
+	}
+}
+
+static BOOL JFCBORFailWithError(NSInteger errorCode, NSString* description, NSError* __autoreleasing _Nullable * _Nullable outError)
+{
+	if(outError)
+		*outError = [JFCBORSerializer.errorFactory errorWithCode:errorCode description:description];
+	return NO;
+}
+
+static BOOL JFCBORAppendString(JFByteStreamBuilder* builder, NSString* string, NSError* __autoreleasing _Nullable * _Nullable outError)
+{
+	// The length is 0 both for empty strings and for strings that can't be converted.
+	NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+	if((length == 0) && (string.length > 0))
+		return JFCBORFailWithError(JFCBORSerializerErrorInvalidString, @"The string can't be converted to UTF-8.", outError);
+	
+	JFCBORAppendHeader(builder, JFCBORMajorTypeText, length);
+	
+	const char* chars = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+	if(chars)
+	{
+		JFByteStreamBuilderAppendBytes(builder, chars, length);
+		return YES;
+	}
+	
+	Byte* bytes = JFByteStreamBuilderExtend(builder, length);
+	if(!bytes)
+		return YES; // The builder has already been marked as failed.
+	
+	NSUInteger usedLength = 0;
+	if(![string getBytes:bytes maxLength:length usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:NULL] || (usedLength != length))
+		return JFCBORFailWithError(JFCBORSerializerErrorInvalidString, @"The string can't be converted to UTF-8.", outError);
+	
+	return YES;
+}
+
+static BOOL JFCBORAppendValue(JFByteStreamBuilder* builder, id value, NSUInteger depth, NSError* __autoreleasing _Nullable * _Nullable outError)
+{
+	if(depth > JFCBORMaxDepth)
+		return JFCBORFailWithError(JFCBORSerializerErrorInvalidValue, @"The value is nested too deeply.", outError);
+	
+	if([value isKindOfClass:NSString.class])
+		return JFCBORAppendString(builder, (NSString*)value, outError);
+	
+	if([value isKindOfClass:NSNumber.class])
+	{
+		JFCBORAppendNumber(builder, (NSNumber*)value);
+		return YES;
+	}
+	
+	if([value isKindOfClass:NSNull.class])
+	{
+		uint8_t byte = (uint8_t)((JFCBORMajorTypeSimple << 5) | JFCBORSimpleNull);
+		JFByteStreamBuilderAppendByte(builder, byte);
+		return YES;
+	}
+	
+	if([value isKindOfClass:JFJSONArray.class] && (((JFJSONArray*)value).storage != JFJSONArrayStorageObjects))
+	{
+		// Packed numbers are encoded straight from the packed buffer, without boxing them.
+		JFJSONArray* array = (JFJSONArray*)value;
+		BOOL doubles = (array.storage == JFJSONArrayStorageDoubles);
+		NSUInteger count = array.count;
+		JFCBORAppendHeader(builder, JFCBORMajorTypeArray, count);
+		
+		union {
+			int64_t integers[256];
+			double reals[256];
+		} chunk;
+		for(NSUInteger location = 0; location < count; location += 256)
+		{
+			NSRange range = NSMakeRange(location, MIN((NSUInteger)256, count - location));
+			if(doubles ? ![array getDoubles:chunk.reals range:range] : ![array getIntegers:chunk.integers range:range])
+				return JFCBORFailWithError(JFCBORSerializerErrorInvalidValue, @"The packed numbers of the array can't be read.", outError);
+			
+			for(NSUInteger index = 0; index < range.length; index++)
+			{
+				if(doubles)
+					JFCBORAppendDouble(builder, chunk.reals[index]);
+				else
+					JFCBORAppendInteger(builder, chunk.integers[index]);
+			}
+		}
+		return YES;
+	}
+	
+	if([value isKindOfClass:JFJSONArray.class])
+	{
+		__block BOOL retVal = YES;
+		JFCBORAppendHeader(builder, JFCBORMajorTypeArray, ((JFJSONArray*)value).count);
+		[(JFJSONArray*)value enumerateStoredValuesWithOptions:0 usingBlock:^BOOL(NSUInteger index, id<JFJSONValue> item) {
+			retVal = JFCBORAppendValue(builder, item, depth + 1, outError);
+			return !retVal;
+		}];
+		return retVal;
+	}
+	
+	if([value isKindOfClass:NSArray.class])
+	{
+		id<NSFastEnumeration> array = value;
+		JFCBORAppendHeader(builder, JFCBORMajorTypeArray, [value count]);
+		for(id item in array)
+		{
+			if(!JFCBORAppendValue(builder, item, depth + 1, outError))
+				return NO;
+		}
+		return YES;
+	}
+	
+	if([value isKindOfClass:JFJSONObject.class])
+	{
+		__block BOOL retVal = YES;
+		JFCBORAppendHeader(builder, JFCBORMajorTypeMap, ((JFJSONObject*)value).count);
+		[(JFJSONObject*)value enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> item) {
+			retVal = (JFCBORAppendString(builder, key, outError) && JFCBORAppendValue(builder, item, depth + 1, outError));
+			return !retVal;
+		}];
+		return retVal;
+	}
+	
+	if([value isKindOfClass:NSDictionary.class])
+	{
+		__block BOOL retVal = YES;
+		JFCBORAppendHeader(builder, JFCBORMajorTypeMap, ((NSDictionary*)value).count);
+		[(NSDictionary*)value enumerateKeysAndObjectsUsingBlock:^(id key, id item, BOOL* stop) {
+			if(![key isKindOfClass:NSString.class])
+				retVal = JFCBORFailWithError(JFCBORSerializerErrorInvalidValue, @"The key of the dictionary is not a string.", outError);
+			else
+				retVal = (JFCBORAppendString(builder, (NSString*)key, outError) && JFCBORAppendValue(builder, item, depth + 1, outError));
+			*stop = !retVal;
+		}];
+		return retVal;
+	}
+	
+	return JFCBORFailWithError(JFCBORSerializerErrorInvalidValue, [NSString stringWithFormat:@"Objects of class '%@' are not JSON values.", NSStringFromClass([value class])], outError);
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions (Decoding)
+// =================================================================================================
+
+static id _Nullable JFCBORReadValue(JFCBORReader* reader, BOOL nodes, NSUInteger depth);
+
+static double JFCBORDoubleFromHalf(uint16_t half)
+{
+	int exponent = (half >> 10) & 0x1F;
+	int mantissa = half & 0x3FF;
+	double retVal;
+	if(exponent == 0)
+		retVal = ldexp(mantissa, -24);
+	else if(exponent != 31)
+		retVal = ldexp(mantissa + 1024, exponent - 25);
+	else
+		retVal = ((mantissa == 0) ? INFINITY : NAN);
+	return ((half & 0x8000) ? -retVal : retVal);
+}
+
+static BOOL JFCBORReadBreak(JFCBORReader* reader)
+{
+	if((reader->offset >= reader->length) || (reader->bytes[reader->offset] != JFCBORBreak))
+		return NO;
+	
+	reader->offset++;
+	return YES;
+}
+
+static BOOL JFCBORReadHeader(JFCBORReader* reader, uint8_t* majorType, uint8_t* info, uint64_t* value)
+{
+	if(reader->offset >= reader->length)
+		return NO;
+	
+	uint8_t initial = reader->bytes[reader->offset++];
+	*majorType = initial >> 5;
+	*info = initial & 0x1F;
+	
+	NSUInteger size;
+	switch(*info)
+	{
+		case 24:
+			size = 1;
+			break;
+		case 25:
+			size = 2;
+			break;
+		case 26:
+			size = 4;
+			break;
+		case 27:
+			size = 8;
+			break;
+		case 28:
+		case 29:
+		case 30:
+			return NO;
+		case JFCBORInfoIndefinite:
+			*value = 0;
+			return ((*majorType >= JFCBORMajorTypeBytes) && (*majorType != JFCBORMajorTypeTag));
+		default:
+			*value = *info;
+			return YES;
+	}
+	
+	if(reader->length - reader->offset < size)
+		return NO;
+	
+	uint64_t retVal = 0;
+	for(NSUInteger index = 0; index < size; index++)
+		retVal = (retVal << 8) | reader->bytes[reader->offset + index];
+	reader->offset += size;
+	*value = retVal;
+	return YES;
+}
+
+static NSString* _Nullable JFCBORReadString(JFCBORReader* reader, uint8_t info, uint64_t length)
+{
+	if(info != JFCBORInfoIndefinite)
+	{
+		if(length > reader->length - reader->offset)
+			return nil;
+		
+		NSString* retObj = [[NSString alloc] initWithBytes:(reader->bytes + reader->offset) length:(NSUInteger)length encoding:NSUTF8StringEncoding];
+		reader->offset += (NSUInteger)length;
+		return retObj;
+	}
+	
+	NSMutableData* buffer = [NSMutableData new];
+	while(!JFCBORReadBreak(reader))
+	{
+		uint8_t chunkMajorType;
+		uint8_t chunkInfo;
+		uint64_t chunkLength;
+		if(!JFCBORReadHeader(reader, &chunkMajorType, &chunkInfo, &chunkLength) || (chunkMajorType != JFCBORMajorTypeText) || (chunkInfo == JFCBORInfoIndefinite))
+			return nil;
+		
+		if(chunkLength > reader->length - reader->offset)
+			return nil;
+		
+		[buffer appendBytes:(reader->bytes + reader->offset) length:(NSUInteger)chunkLength];
+		reader->offset += (NSUInteger)chunkLength;
+	}
+	return [[NSString alloc] initWithData:buffer encoding:NSUTF8StringEncoding];
+}
+
+static BOOL JFCBORReadPackedArrayContent(JFCBORReader* reader, uint64_t count, JFJSONArray* container)
+{
+	// Arrays of integer numbers, or of double precision floating point numbers, are decoded straight into a packed buffer, without boxing each number; any other content is left to the generic decoder.
+	if((count == 0) || (count > (uint64_t)(reader->length - reader->offset)))
+		return NO;
+	
+	JFCBORReader probe = *reader;
+	NSMutableData* buffer = [NSMutableData dataWithLength:(NSUInteger)count * sizeof(int64_t)];
+	int64_t* integers = (int64_t*)buffer.mutableBytes;
+	double* reals = (double*)buffer.mutableBytes;
+	BOOL doubles = NO;
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		uint8_t majorType;
+		uint8_t info;
+		uint64_t value;
+		if(!JFCBORReadHeader(&probe, &majorType, &info, &value))
+			return NO;
+		
+		if(index == 0)
+			doubles = (majorType == JFCBORMajorTypeSimple);
+		
+		if(doubles)
+		{
+			if((majorType != JFCBORMajorTypeSimple) || (info != JFCBORSimpleDouble))
+				return NO;
+			memcpy(&reals[index], &value, sizeof(double));
+		}
+		else if((majorType == JFCBORMajorTypeUnsigned) && (value <= INT64_MAX))
+			integers[index] = (int64_t)value;
+		else if((majorType == JFCBORMajorTypeNegative) && (value <= INT64_MAX))
+			integers[index] = -1 - (int64_t)value;
+		else
+			return NO;
+	}
+	
+	*reader = probe;
+	if(doubles)
+		[container addDoubles:reals count:(NSUInteger)count];
+	else
+		[container addIntegers:integers count:(NSUInteger)count];
+	return YES;
+}
+
+static BOOL JFCBORReadArrayContent(JFCBORReader* reader, uint8_t info, uint64_t count, id container, BOOL nodes, NSUInteger depth)
+{
+	BOOL indefinite = (info == JFCBORInfoIndefinite);
+	if(nodes && !indefinite && JFCBORReadPackedArrayContent(reader, count, (JFJSONArray*)container))
+		return YES;
+	
+	for(uint64_t index = 0; indefinite || (index < count); index++)
+	{
+		if(indefinite && JFCBORReadBreak(reader))
+			break;
+		
+		id value = JFCBORReadValue(reader, nodes, depth + 1);
+		if(!value)
+			return NO;
+		
+		if(nodes)
+			[(JFJSONArray*)container importValue:value];
+		else
+			[(NSMutableArray*)container addObject:value];
+	}
+	return YES;
+}
+
+static BOOL JFCBORReadMapContent(JFCBORReader* reader, uint8_t info, uint64_t count, id container, BOOL nodes, NSUInteger depth)
+{
+	BOOL indefinite = (info == JFCBORInfoIndefinite);
+	for(uint64_t index = 0; indefinite || (index < count); index++)
+	{
+		if(indefinite && JFCBORReadBreak(reader))
+			break;
+		
+		uint8_t keyMajorType;
+		uint8_t keyInfo;
+		uint64_t keyLength;
+		if(!JFCBORReadHeader(reader, &keyMajorType, &keyInfo, &keyLength) || (keyMajorType != JFCBORMajorTypeText))
+			return NO;
+		
+		NSString* key = JFCBORReadString(reader, keyInfo, keyLength);
+		if(!key)
+			return NO;
+		
+		id value = JFCBORReadValue(reader, nodes, depth + 1);
+		if(!value)
+			return NO;
+		
+		if(nodes)
+			[(JFJSONObject*)container importValue:value forKey:key];
+		else
+			[(NSMutableDictionary*)container setObject:value forKey:key];
+	}
+	return YES;
+}
+
+static id _Nullable JFCBORReadValue(JFCBORReader* reader, BOOL nodes, NSUInteger depth)
+{
+	if(depth > JFCBORMaxDepth)
+		return nil;
+	
+	uint8_t majorType;
+	uint8_t info;
+	uint64_t value;
+	if(!JFCBORReadHeader(reader, &majorType, &info, &value))
+		return nil;
+	
+	// Each element takes at least one byte: never preallocate more than the remaining input could fill.
+	NSUInteger capacity = (NSUInteger)MIN(value, (uint64_t)(reader->length - reader->offset));
+	
+	switch(majorType)
+	{
+		case JFCBORMajorTypeUnsigned:
+			return ((value <= INT64_MAX) ? @((long long)value) : @((unsigned long long)value));
+		case JFCBORMajorTypeNegative:
+			return ((value <= INT64_MAX) ? @(-1 - (long long)value) : @(-1.0 - (double)value));
+		case JFCBORMajorTypeText:
+			return JFCBORReadString(reader, info, value);
+		case JFCBORMajorTypeArray:
+		{
+			id retObj = (nodes ? [[JFJSONArray alloc] initWithCapacity:capacity] : [[NSMutableArray alloc] initWithCapacity:capacity]);
+			return (JFCBORReadArrayContent(reader, info, value, retObj, nodes, depth) ? retObj : nil);
+		}
+		case JFCBORMajorTypeMap:
+		{
+			id retObj = (nodes ? [[JFJSONObject alloc] initWithCapacity:capacity] : [[NSMutableDictionary alloc] initWithCapacity:capacity]);
+			return (JFCBORReadMapContent(reader, info, value, retObj, nodes, depth) ? retObj : nil);
+		}
+		case JFCBORMajorTypeTag:
+			// Tags carry no meaning for JSON nodes: the tagged item is decoded as is.
+			return JFCBORReadValue(reader, nodes, depth + 1);
+		case JFCBORMajorTypeSimple:
+		{
+			switch(info)
+			{
+				case JFCBORSimpleFalse:
+					return @NO;
+				case JFCBORSimpleTrue:
+					return @YES;
+				case JFCBORSimpleNull:
+				case JFCBORSimpleUndefined:
+					return [NSNull null];
+				case JFCBORSimpleHalf:
+					return @((float)JFCBORDoubleFromHalf((uint16_t)value));
+				case JFCBORSimpleFloat:
+				{
+					uint32_t bits = (uint32_t)value;
+					float retVal;
+					memcpy(&retVal, &bits, sizeof(retVal));
+					return @(retVal);
+				}
+				case JFCBORSimpleDouble:
+				{
+					double retVal;
+					memcpy(&retVal, &value, sizeof(retVal));
+					return @(retVal);
+				}
+				default:
+					return nil;
+			}
+		}
+		default:
+			// Byte strings have no JSON counterpart.
+			return nil;
+	}
+}
+
+static BOOL JFCBORReadRoot(NSData* data, uint8_t expectedMajorType, id container, BOOL nodes)
+{
+	JFCBORReader reader = {(const uint8_t*)data.bytes, data.length, 0};
+	
+	uint8_t majorType;
+	uint8_t info;
+	uint64_t value;
+	if(!JFCBORReadHeader(&reader, &majorType, &info, &value) || (majorType != expectedMajorType))
+		return NO;
+	
+	BOOL retVal;
+	if(majorType == JFCBORMajorTypeArray)
+		retVal = JFCBORReadArrayContent(&reader, info, value, container, nodes, 0);
+	else
+		retVal = JFCBORReadMapContent(&reader, info, value, container, nodes, 0);
+	
+	return (retVal && (reader.offset == reader.length));
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFCBORSerializer
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Errors
+// =================================================================================================
+
++ (NSErrorDomain)errorDomain
+{
+	return @"com.jackfelle.cborSerializer";
+}
+
++ (JFErrorFactory*)errorFactory
+{
+	static JFErrorFactory* retObj = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		retObj = [[JFErrorFactory alloc] initWithDomain:self.errorDomain];
+	});
+	return retObj;
+}
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (NSData* _Nullable)dataFromNode:(id _Nullable)node
+{
+	if(!node)
+		return nil;
+	
+	NSError* error = nil;
+	JFByteStreamBuilder builder = JFByteStreamBuilderAlloc(256);
+	if(!JFCBORAppendValue(&builder, node, 0, &error) || builder.failed)
+	{
+		JFByteStreamBuilderFree(&builder);
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to convert JSON node to CBOR data. [node = '%@'; error = '%@']", ClassName, JFStringFromPointer(self), node, error] tags:JFLoggerTagsError];
+		return nil;
+	}
+	
+	// The buffer is handed over to the data object, without copying it.
+	JFByteStream stream = JFByteStreamBuilderFinish(&builder);
+	return [NSData dataWithBytesNoCopy:stream.bytes length:stream.length freeWhenDone:YES];
+}
+
+- (NSData* _Nullable)dataFromString:(NSString* _Nullable)string
+{
+	if(!string)
+		return nil;
+	
+	NSData* retObj = [[NSData alloc] initWithBase64EncodedString:string options:0];
+	if(!retObj)
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to convert Base64 string to CBOR data. [string = '%@']", ClassName, JFStringFromPointer(self), string] tags:JFLoggerTagsError];
+	return retObj;
+}
+
+- (BOOL)importData:(NSData* _Nullable)data majorType:(uint8_t)majorType into:(id)container nodes:(BOOL)nodes
+{
+	if(!data)
+		return NO;
+	
+	if(!JFCBORReadRoot(data, majorType, container, nodes))
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to convert CBOR data to node. [data = '%@']", ClassName, JFStringFromPointer(self), data] tags:JFLoggerTagsError];
+		return NO;
+	}
+	return YES;
+}
+
+- (NSString* _Nullable)stringFromData:(NSData* _Nullable)data
+{
+	return [data base64EncodedStringWithOptions:0];
+}
+
+// =================================================================================================
+// MARK: Methods - Data (Arrays)
+// =================================================================================================
+
+- (NSArray<id<JFJSONConvertibleValue>>* _Nullable)arrayFromData:(NSData* _Nullable)jsonData
+{
+	NSMutableArray<id<JFJSONConvertibleValue>>* retObj = [NSMutableArray<id<JFJSONConvertibleValue>> new];
+	return ([self importData:jsonData majorType:JFCBORMajorTypeArray into:retObj nodes:NO] ? retObj : nil);
+}
+
+- (NSArray<id<JFJSONConvertibleValue>>* _Nullable)arrayFromString:(NSString* _Nullable)jsonString
+{
+	return [self arrayFromData:[self dataFromString:jsonString]];
+}
+
+- (NSData* _Nullable)dataFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array
+{
+	return [self dataFromNode:array];
+}
+
+- (NSString* _Nullable)stringFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array
+{
+	return [self stringFromData:[self dataFromArray:array]];
+}
+
+// =================================================================================================
+// MARK: Methods - Data (Dictionaries)
+// =================================================================================================
+
+- (NSData* _Nullable)dataFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary
+{
+	return [self dataFromNode:dictionary];
+}
+
+- (NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionaryFromData:(NSData* _Nullable)jsonData
+{
+	NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>>* retObj = [NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>> new];
+	return ([self importData:jsonData majorType:JFCBORMajorTypeMap into:retObj nodes:NO] ? retObj : nil);
+}
+
+- (NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionaryFromString:(NSString* _Nullable)jsonString
+{
+	return [self dictionaryFromData:[self dataFromString:jsonString]];
+}
+
+- (NSString* _Nullable)stringFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary
+{
+	return [self stringFromData:[self dataFromDictionary:dictionary]];
+}
+
+// =================================================================================================
+// MARK: Methods - Nodes (Arrays)
+// =================================================================================================
+
+- (NSData* _Nullable)dataFromJSONArray:(JFJSONArray* _Nullable)array
+{
+	return [self dataFromNode:array];
+}
+
+- (BOOL)importData:(NSData* _Nullable)jsonData intoJSONArray:(JFJSONArray*)array
+{
+	return [self importData:jsonData majorType:JFCBORMajorTypeArray into:array nodes:YES];
+}
+
+// =================================================================================================
+// MARK: Methods - Nodes (Objects)
+// =================================================================================================
+
+- (NSData* _Nullable)dataFromJSONObject:(JFJSONObject* _Nullable)object
+{
+	return [self dataFromNode:object];
+}
+
+- (BOOL)importData:(NSData* _Nullable)jsonData intoJSONObject:(JFJSONObject*)object
+{
+	return [self importData:jsonData majorType:JFCBORMajorTypeMap into:object nodes:YES];
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -88,6 +88,26 @@ NS_ASSUME_NONNULL_BEGIN
 	return (self.transition == JFConnectionTransitionResetting);
 }
 
++ (JFStateMachineTransitionTable*)transitionTable
+{
+	static JFStateMachineTransitionTable* retObj = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		// Beginning state, transition, ending state on success, ending state on failure.
+		JFStateMachineTransitionRule rules[] = {
+			{JFConnectionStateReady, JFConnectionTransitionConnecting, JFConnectionStateConnected, JFConnectionStateConnectionLost},
+			{JFConnectionStateConnected, JFConnectionTransitionDisconnecting, JFConnectionStateDisconnected, JFConnectionStateDirty},
+			{JFConnectionStateConnectionLost, JFConnectionTransitionDisconnecting, JFConnectionStateDisconnected, JFConnectionStateDirty},
+			{JFConnectionStateConnected, JFConnectionTransitionLosingConnection, JFConnectionStateConnectionLost, JFConnectionStateConnectionLost},
+			{JFConnectionStateConnectionLost, JFConnectionTransitionReconnecting, JFConnectionStateConnected, JFConnectionStateConnectionLost},
+			{JFConnectionStateDirty, JFConnectionTransitionResetting, JFConnectionStateReady, JFConnectionStateDirty},
+			{JFConnectionStateDisconnected, JFConnectionTransitionResetting, JFConnectionStateReady, JFConnectionStateDirty},
+		};
+		retObj = [[JFStateMachineTransitionTable alloc] initWithRules:rules count:sizeof(rules) / sizeof(rules[0])];
+	});
+	return retObj;
+}
+
 // =================================================================================================
 // MARK: Lifecycle
 // =================================================================================================
@@ -180,107 +200,6 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - State
 // =================================================================================================
 
-- (NSArray<NSNumber*>*)beginningStatesForTransition:(JFStateTransition)transition
-{
-	NSArray<NSNumber*>* retObj;
-	switch(transition)
-	{
-		case JFConnectionTransitionConnecting:
-		{
-			retObj = @[@(JFConnectionStateReady)];
-			break;
-		}
-		case JFConnectionTransitionDisconnecting:
-		{
-			retObj = @[@(JFConnectionStateConnected), @(JFConnectionStateConnectionLost)];
-			break;
-		}
-		case JFConnectionTransitionLosingConnection:
-		{
-			retObj = @[@(JFConnectionStateConnected)];
-			break;
-		}
-		case JFConnectionTransitionReconnecting:
-		{
-			retObj = @[@(JFConnectionStateConnectionLost)];
-			break;
-		}
-		case JFConnectionTransitionResetting:
-		{
-			retObj = @[@(JFConnectionStateDirty), @(JFConnectionStateDisconnected)];
-			break;
-		}
-		default:
-		{
-			retObj = [super beginningStatesForTransition:transition];
-			break;
-		}
-	}
-	return retObj;
-}
-
-- (JFState)endingStateForFailedTransition:(JFStateTransition)transition
-{
-	JFState retVal;
-	switch(transition)
-	{
-		case JFConnectionTransitionConnecting:
-		case JFConnectionTransitionLosingConnection:
-		case JFConnectionTransitionReconnecting:
-		{
-			retVal = JFConnectionStateConnectionLost;
-			break;
-		}
-		case JFConnectionTransitionDisconnecting:
-		case JFConnectionTransitionResetting:
-		{
-			retVal = JFConnectionStateDirty;
-			break;
-		}
-		default:
-		{
-			retVal = [super endingStateForFailedTransition:transition];
-			break;
-		}
-	}
-	return retVal;
-}
-
-- (JFState)endingStateForSucceededTransition:(JFStateTransition)transition
-{
-	JFState retVal;
-	switch(transition)
-	{
-		case JFConnectionTransitionConnecting:
-		case JFConnectionTransitionReconnecting:
-		{
-			retVal = JFConnectionStateConnected;
-			break;
-		}
-		case JFConnectionTransitionDisconnecting:
-		{
-			retVal = JFConnectionStateDisconnected;
-			break;
-		}
-		case JFConnectionTransitionLosingConnection:
-		{
-			retVal = JFConnectionStateConnectionLost;
-			break;
-		}
-		case JFConnectionTransitionResetting:
-		{
-			retVal = JFConnectionStateReady;
-			break;
-		}
-		default:
-		{
-			retVal = [super endingStateForSucceededTransition:transition];
-			break;
-		}
-	}
-	return retVal;
-}
-
 - (NSString* _Nullable)stringFromState:(JFState)state
 {
 	NSString* retObj = nil;
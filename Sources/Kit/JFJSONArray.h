@@ -48,6 +48,56 @@ NS_ASSUME_NONNULL_BEGIN
  */
 typedef BOOL (^JFJSONArrayEnumerationBlock)(NSUInteger index, id<JFJSONValue> value);
 
+/**
+ * A block to select values in the array.
+ * @param index The index of the current value.
+ * @param value The current value.
+ * @return Return `YES` to keep the value, `NO` to discard it.
+ */
+typedef BOOL (^JFJSONArrayFilterBlock)(NSUInteger index, id<JFJSONValue> value);
+
+/**
+ * A block to transform values in the array.
+ * @param index The index of the current value.
+ * @param value The current value.
+ * @return The result of the transformation.
+ */
+typedef id _Nullable (^JFJSONArrayMapBlock)(NSUInteger index, id<JFJSONValue> value);
+
+/**
+ * A block to fold values in the array into a partial result.
+ * @param result The partial result.
+ * @param index The index of the current value.
+ * @param value The current value.
+ * @return The updated partial result.
+ */
+typedef id _Nullable (^JFJSONArrayReduceBlock)(id _Nullable result, NSUInteger index, id<JFJSONValue> value);
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * A list of available layouts used to store the values of a JSON array.
+ */
+typedef NS_ENUM(UInt8, JFJSONArrayStorage)
+{
+	/**
+	 * Each value is stored as an object.
+	 */
+	JFJSONArrayStorageObjects,
+	
+	/**
+	 * All values are integer numbers, stored in a packed buffer of `int64_t` values.
+	 */
+	JFJSONArrayStorageIntegers,
+	
+	/**
+	 * All values are floating point numbers, stored in a packed buffer of `double` values.
+	 */
+	JFJSONArrayStorageDoubles,
+};
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
 
@@ -65,6 +115,12 @@ typedef BOOL (^JFJSONArrayEnumerationBlock)(NSUInteger index, id<JFJSONValue> va
  */
 @property (copy, nonatomic, readonly) NSArray<id<JFJSONConvertibleValue>>* arrayValue;
 
+/**
+ * The layout currently used to store the values of the collection.
+ * @discussion Collections containing only integer numbers, or only floating point numbers, are stored in a packed buffer when imported from SDK native data objects or JSON content, or when filled using the bulk methods; the numbers are boxed only when accessed using the object based methods. Any change that can't be applied to the packed buffer converts the collection to the object based layout.
+ */
+@property (assign, nonatomic, readonly) JFJSONArrayStorage storage;
+
 // =================================================================================================
 // MARK: Lifecycle
 // =================================================================================================
@@ -141,6 +197,22 @@ typedef BOOL (^JFJSONArrayEnumerationBlock)(NSUInteger index, id<JFJSONValue> va
  */
 - (instancetype _Nullable)initWithData:(NSData*)data;
 
+/**
+ * Initializes this instance with the given floating point numbers, stored in a packed buffer.
+ * @param values The floating point numbers to store.
+ * @param count The number of floating point numbers.
+ * @return This instance.
+ */
+- (instancetype)initWithDoubles:(const double*)values count:(NSUInteger)count;
+
+/**
+ * Initializes this instance with the given integer numbers, stored in a packed buffer.
+ * @param values The integer numbers to store.
+ * @param count The number of integer numbers.
+ * @return This instance.
+ */
+- (instancetype)initWithIntegers:(const int64_t*)values count:(NSUInteger)count;
+
 /**
  * Initializes this instance with the given JSON string using the default JSON serializer.
  * @param string The JSON string.
@@ -225,12 +297,44 @@ typedef BOOL (^JFJSONArrayEnumerationBlock)(NSUInteger index, id<JFJSONValue> va
 // MARK: Methods - Data (Numbers)
 // =================================================================================================
 
+/**
+ * Appends the given floating point numbers to the end of the collection.
+ * @discussion If the collection is empty or stored in a packed buffer of floating point numbers, the numbers are appended to the packed buffer; otherwise they are boxed.
+ * @param values The floating point numbers to append.
+ * @param count The number of floating point numbers.
+ */
+- (void)addDoubles:(const double*)values count:(NSUInteger)count;
+
+/**
+ * Appends the given integer numbers to the end of the collection.
+ * @discussion If the collection is empty or stored in a packed buffer of integer numbers, the numbers are appended to the packed buffer; otherwise they are boxed.
+ * @param values The integer numbers to append.
+ * @param count The number of integer numbers.
+ */
+- (void)addIntegers:(const int64_t*)values count:(NSUInteger)count;
+
 /**
  * Appends the given number to the end of the collection.
  * @param value The number to append.
  */
 - (void)addNumber:(NSNumber*)value;
 
+/**
+ * Copies the numbers in the given range into the given buffer, converted to floating point numbers.
+ * @param buffer The buffer to fill; it must be large enough to contain `range.length` values.
+ * @param range The range of the numbers to copy.
+ * @return `YES` if the numbers have been copied, `NO` if the range exceeds the bounds of the collection or it contains a value that is not a number.
+ */
+- (BOOL)getDoubles:(double*)buffer range:(NSRange)range;
+
+/**
+ * Copies the numbers in the given range into the given buffer, converted to integer numbers.
+ * @param buffer The buffer to fill; it must be large enough to contain `range.length` values.
+ * @param range The range of the numbers to copy.
+ * @return `YES` if the numbers have been copied, `NO` if the range exceeds the bounds of the collection or it contains a value that is not a number.
+ */
+- (BOOL)getIntegers:(int64_t*)buffer range:(NSRange)range;
+
 /**
  * Inserts the given number at the given index in the collection, incrementing all subsequent indexes.
  * @param value The number to insert.
@@ -397,6 +501,39 @@ typedef BOOL (^JFJSONArrayEnumerationBlock)(NSUInteger index, id<JFJSONValue> va
  */
 - (NSEnumerator<id<JFJSONValue>>*)valueEnumerator;
 
+// =================================================================================================
+// MARK: Methods - Parallel Processing
+// =================================================================================================
+
+/**
+ * Returns a new array containing the values that pass the test implemented by the given block, in their original order.
+ * @discussion The values are split into chunks of `grainSize` values, which are processed concurrently; the block must be safe to call from multiple threads, and the array must not be changed until the method returns.
+ * @param grainSize The number of values of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param block The block to apply to the values.
+ * @return A new array containing the selected values.
+ */
+- (JFJSONArray*)filterValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONArrayFilterBlock)block;
+
+/**
+ * Returns the results of the given block applied to each value, in the order of the values.
+ * @discussion The values are split into chunks of `grainSize` values, which are processed concurrently; the block must be safe to call from multiple threads, and the array must not be changed until the method returns.
+ * @param grainSize The number of values of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param block The block to apply to the values; `nil` results are stored as `NSNull`, so that each result has the index of its value.
+ * @return The results of the block.
+ */
+- (NSArray*)mapValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONArrayMapBlock)block;
+
+/**
+ * Reduces the values to a single result.
+ * @discussion The values are split into chunks of `grainSize` values: each chunk is folded concurrently by `block`, starting from `initialValue`, then the partial results of the chunks are combined in order by `combineBlock`. The result doesn't depend on how the values are split only if `initialValue` is an identity for `combineBlock` and `combineBlock` is associative. The blocks must be safe to call from multiple threads, and the array must not be changed until the method returns.
+ * @param grainSize The number of values of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param initialValue The value each chunk starts from; it's also the result if the array is empty.
+ * @param block The block that folds a value into a partial result.
+ * @param combineBlock The block that combines the partial results of two adjacent chunks.
+ * @return The result of the reduction.
+ */
+- (id _Nullable)reduceValuesWithGrainSize:(NSUInteger)grainSize initialValue:(id _Nullable)initialValue usingBlock:(JFJSONArrayReduceBlock)block combineBlock:(JFJSONNodeCombineBlock)combineBlock;
+
 // =================================================================================================
 // MARK: Methods - Subscripting
 // =================================================================================================
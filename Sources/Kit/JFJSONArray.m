@@ -24,10 +24,16 @@
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
-#import "JFJSONArray.h"
+#import "JFJSONArray_Project.h"
 
-#import "JFJSONObject.h"
+#import "JFJSONHashing.h"
+#import "JFJSONKeyTable.h"
+#import "JFJSONObject_Project.h"
+#import "JFJSONParallel.h"
 #import "JFJSONSerializer.h"
+#import "JFJSONValueKind.h"
+#import "JFShortcuts.h"
+#import "JFStrings.h"
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
@@ -35,13 +41,68 @@ NS_ASSUME_NONNULL_BEGIN
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+typedef union {
+	int64_t integer;
+	double real;
+} JFJSONArrayPackedValue;
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+static BOOL JFJSONArrayIsNode(id _Nullable value)
+{
+	JFJSONValueKind kind = JFJSONValueKindOf(value);
+	return ((kind == JFJSONValueKindArray) || (kind == JFJSONValueKindObject));
+}
+
+static JFJSONArrayStorage JFJSONArrayStorageForValue(id _Nullable value)
+{
+	if((JFJSONValueKindOf(value) != JFJSONValueKindNumber) || [value isKindOfClass:NSDecimalNumber.class] || (CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID()))
+		return JFJSONArrayStorageObjects;
+	
+	switch(((NSNumber*)value).objCType[0])
+	{
+		case 'c':
+		case 'i':
+		case 'l':
+		case 'q':
+		case 's':
+		case 'C':
+		case 'I':
+		case 'S':
+			return JFJSONArrayStorageIntegers;
+		case 'L':
+		case 'Q':
+			return ((((NSNumber*)value).unsignedLongLongValue <= INT64_MAX) ? JFJSONArrayStorageIntegers : JFJSONArrayStorageObjects);
+		case 'd':
+		case 'f':
+			return JFJSONArrayStorageDoubles;
+		default:
+			return JFJSONArrayStorageObjects;
+	}
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
 @interface JFJSONArray (/* Private */)
 
+// =================================================================================================
+// MARK: Properties - Comparison
+// =================================================================================================
+
+@property (assign, nonatomic, readonly) uint64_t cachedHash;
+
 // =================================================================================================
 // MARK: Properties - Data
 // =================================================================================================
 
-@property (strong, nonatomic, readonly) NSMutableArray<id<JFJSONValue>>* list;
+@property (strong, nonatomic, readonly, nullable) NSMutableArray<id<JFJSONValue>>* list;
+@property (strong, nonatomic, readonly, nullable) NSMutableData* packedData;
 
 // =================================================================================================
 // MARK: Properties - Serialization
@@ -53,14 +114,42 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - Data
 // =================================================================================================
 
-- (void)importFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array;
+- (void)cloneStorage;
+- (void)detachStorage;
+- (void)exposeNode:(id<JFJSONValue>)node;
+- (void)exposeNodes;
+- (void)importFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array keyTable:(JFJSONKeyTable*)keyTable;
+- (BOOL)importPackedFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array;
+
+// =================================================================================================
+// MARK: Methods - Data (Packed values)
+// =================================================================================================
+
+- (void)addPackedValues:(const JFJSONArrayPackedValue*)values count:(NSUInteger)count storage:(JFJSONArrayStorage)storage;
+- (NSNumber*)boxedValueAtIndex:(NSUInteger)index;
+- (NSUInteger)packedCount;
+- (BOOL)storePackedValue:(id<JFJSONValue>)value atIndex:(NSUInteger)index inserting:(BOOL)inserting;
+- (void)unpackValues;
 
 // =================================================================================================
 // MARK: Methods - Data (Values)
 // =================================================================================================
 
+- (void)appendValue:(id<JFJSONValue>)value;
 - (id<JFJSONValue> _Nullable)checkValue:(id _Nullable)value;
 
+// =================================================================================================
+// MARK: Methods - Ownership
+// =================================================================================================
+
+- (void)willChange;
+
+// =================================================================================================
+// MARK: Methods - Parallel Processing
+// =================================================================================================
+
+- (JFJSONParallelValueReader)parallelValueReader;
+
 @end
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -68,11 +157,34 @@ NS_ASSUME_NONNULL_BEGIN
 
 @implementation JFJSONArray
 
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// Set when some of the stored nodes may be referenced outside of this array (handed out by an accessor, or given by the caller): when the storage stops being shared, this array keeps them and the copies get copies of them.
+	BOOL _exposesNodes;
+	
+	// The cached structural hash, or `0` if it must be computed again; the stored nodes handed out by this array tell it before they change (see `nodeWillChange:`), so that it can be reset.
+	uint64_t _hashValue;
+	
+	// Incremented by each change of the packed buffer, to detect changes during fast enumeration.
+	unsigned long _mutations;
+	
+	// The containers that handed out this array or were given it by the caller, created when the first one is added; they are told before this array changes. Containers that no longer store this array are not removed: they only do some needless work.
+	NSHashTable* _owners;
+	
+	// Set when the storage is shared with a copy: it must be cloned before being changed or before handing out any of its nodes.
+	BOOL _sharesStorage;
+}
+
 // =================================================================================================
 // MARK: Properties - Data
 // =================================================================================================
 
 @synthesize list = _list;
+@synthesize packedData = _packedData;
+@synthesize storage = _storage;
 
 // =================================================================================================
 // MARK: Properties - Serialization
@@ -111,12 +223,65 @@ NS_ASSUME_NONNULL_BEGIN
 	}
 }
 
+// =================================================================================================
+// MARK: Properties (Accessors) - Comparison
+// =================================================================================================
+
+- (uint64_t)cachedHash
+{
+	return _hashValue;
+}
+
+- (uint64_t)structuralHash
+{
+	uint64_t retVal = self.cachedHash;
+	if(retVal != 0)
+		return retVal;
+	
+	NSUInteger count = self.count;
+	retVal = JFJSONHashArrayStart(count);
+	switch(self.storage)
+	{
+		case JFJSONArrayStorageDoubles:
+		case JFJSONArrayStorageIntegers:
+		{
+			// Packed numbers are hashed without boxing them, the same way the boxed numbers would be.
+			BOOL doubles = (self.storage == JFJSONArrayStorageDoubles);
+			const JFJSONArrayPackedValue* values = (const JFJSONArrayPackedValue*)self.packedData.bytes;
+			for(NSUInteger index = 0; index < count; index++)
+				retVal = JFJSONHashCombine(retVal, JFJSONHashDouble(doubles ? values[index].real : (double)values[index].integer));
+			break;
+		}
+		default:
+		{
+			for(id<JFJSONValue> value in self.list)
+				retVal = JFJSONHashCombine(retVal, JFJSONHashValue(value));
+			break;
+		}
+	}
+	retVal = JFJSONHashFinalize(retVal);
+	if(retVal == 0)
+		retVal = 1;
+	
+	_hashValue = retVal;
+	return retVal;
+}
+
 // =================================================================================================
 // MARK: Properties (Accessors) - Data
 // =================================================================================================
 
 - (NSArray<id<JFJSONConvertibleValue>>*)arrayValue
 {
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		NSUInteger count = self.packedCount;
+		NSMutableArray<id<JFJSONConvertibleValue>>* retObj = [NSMutableArray<id<JFJSONConvertibleValue>> arrayWithCapacity:count];
+		for(NSUInteger index = 0; index < count; index++)
+			[retObj addObject:[self boxedValueAtIndex:index]];
+		return retObj;
+	}
+	
 	NSMutableArray<id<JFJSONConvertibleValue>>* retObj = [NSMutableArray<id<JFJSONConvertibleValue>> arrayWithArray:self.list];
 	for(NSUInteger index = 0; index < retObj.count; index++)
 	{
@@ -134,12 +299,16 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSUInteger)count
 {
-	return self.list.count;
+	return ((self.storage == JFJSONArrayStorageObjects) ? self.list.count : self.packedCount);
 }
 
 - (NSData* _Nullable)dataValue
 {
-	return [self.serializer dataFromArray:self.arrayValue];
+	id<JFJSONSerializationAdapter> serializer = self.serializer;
+	if([serializer respondsToSelector:@selector(dataFromJSONArray:)])
+		return [serializer dataFromJSONArray:self];
+	
+	return [serializer dataFromArray:self.arrayValue];
 }
 
 - (NSString* _Nullable)stringValue
@@ -158,7 +327,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (instancetype _Nullable)arrayWithData:(NSData* _Nullable)data serializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
 {
-	return (data ? [self arrayWithArray:[(serializer ?: self.defaultSerializer) arrayFromData:data] serializer:serializer] : nil);
+	return (data ? [[self alloc] initWithData:data serializer:serializer] : nil);
 }
 
 + (instancetype _Nullable)arrayWithArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array
@@ -186,6 +355,13 @@ NS_ASSUME_NONNULL_BEGIN
 	return (string ? [self arrayWithArray:[(serializer ?: self.defaultSerializer) arrayFromString:string] serializer:serializer] : nil);
 }
 
+- (void)dealloc
+{
+	// Nobody could tell the copies still sharing the storage about the changes of the nodes handed out by this array anymore: they get copies of them right away.
+	if(_sharesStorage && _exposesNodes)
+		[self cloneStorage];
+}
+
 - (instancetype)init
 {
 	self = [super init];
@@ -196,10 +372,15 @@ NS_ASSUME_NONNULL_BEGIN
 }
 
 - (instancetype)initWithArray:(NSArray<id<JFJSONConvertibleValue>>*)array
+{
+	return [self initWithArray:array keyTable:[JFJSONKeyTable new]];
+}
+
+- (instancetype)initWithArray:(NSArray<id<JFJSONConvertibleValue>>*)array keyTable:(JFJSONKeyTable*)keyTable
 {
 	self = [self initWithCapacity:array.count];
 	
-	[self importFromArray:array];
+	[self importFromArray:array keyTable:keyTable];
 	
 	return self;
 }
@@ -224,15 +405,37 @@ NS_ASSUME_NONNULL_BEGIN
 	
 	_serializer = serializer;
 	
-	NSArray<id<JFJSONConvertibleValue>>* array = [(serializer ?: self.serializer) arrayFromData:data];
+	id<JFJSONSerializationAdapter> adapter = (serializer ?: self.serializer);
+	if([adapter respondsToSelector:@selector(importData:intoJSONArray:)])
+		return ([adapter importData:data intoJSONArray:self] ? self : nil);
+	
+	NSArray<id<JFJSONConvertibleValue>>* array = [adapter arrayFromData:data];
 	if(array)
-		[self importFromArray:array];
+		[self importFromArray:array keyTable:[JFJSONKeyTable new]];
 	else
 		self = nil;
 	
 	return self;
 }
 
+- (instancetype)initWithDoubles:(const double*)values count:(NSUInteger)count
+{
+	self = [self initWithCapacity:0];
+	
+	[self addDoubles:values count:count];
+	
+	return self;
+}
+
+- (instancetype)initWithIntegers:(const int64_t*)values count:(NSUInteger)count
+{
+	self = [self initWithCapacity:0];
+	
+	[self addIntegers:values count:count];
+	
+	return self;
+}
+
 - (instancetype _Nullable)initWithString:(NSString*)string
 {
 	return [self initWithString:string serializer:nil];
@@ -246,7 +449,7 @@ NS_ASSUME_NONNULL_BEGIN
 	
 	NSArray<id<JFJSONConvertibleValue>>* array = [(serializer ?: self.serializer) arrayFromString:string];
 	if(array)
-		[self importFromArray:array];
+		[self importFromArray:array keyTable:[JFJSONKeyTable new]];
 	else
 		self = nil;
 	
@@ -259,7 +462,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSUInteger)hash
 {
-	return self.list.hash;
+	return (NSUInteger)self.structuralHash;
 }
 
 - (BOOL)isEqual:(id _Nullable)object
@@ -272,26 +475,168 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (BOOL)isEqualToJSONArray:(JFJSONArray*)other
 {
-	return [self.list isEqualToArray:other.list];
+	if((self == other) || [self sharesStorageWithJSONArray:other])
+		return YES;
+	
+	// Arrays with different hashes can't be equal: the hashes are compared only when both are already available.
+	uint64_t hash = self.cachedHash;
+	uint64_t otherHash = other.cachedHash;
+	if((hash != 0) && (otherHash != 0) && (hash != otherHash))
+		return NO;
+	
+	JFJSONArrayStorage storage = self.storage;
+	JFJSONArrayStorage otherStorage = other.storage;
+	
+	if((storage == JFJSONArrayStorageObjects) && (otherStorage == JFJSONArrayStorageObjects))
+		return [self.list isEqualToArray:other.list];
+	
+	NSUInteger count = self.count;
+	if(count != other.count)
+		return NO;
+	
+	if(storage == otherStorage)
+	{
+		const JFJSONArrayPackedValue* values = (const JFJSONArrayPackedValue*)self.packedData.bytes;
+		const JFJSONArrayPackedValue* otherValues = (const JFJSONArrayPackedValue*)other.packedData.bytes;
+		for(NSUInteger index = 0; index < count; index++)
+		{
+			BOOL equal = ((storage == JFJSONArrayStorageDoubles) ? (values[index].real == otherValues[index].real) : (values[index].integer == otherValues[index].integer));
+			if(!equal)
+				return NO;
+		}
+		return YES;
+	}
+	
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		if(![[self storedValueAtIndex:index] isEqual:[other storedValueAtIndex:index]])
+			return NO;
+	}
+	return YES;
+}
+
+- (BOOL)sharesStorageWithJSONArray:(JFJSONArray*)other
+{
+	if(self.storage != other.storage)
+		return NO;
+	
+	NSMutableArray<id<JFJSONValue>>* list = self.list;
+	if(list)
+		return (list == other.list);
+	
+	NSMutableData* packedData = self.packedData;
+	return (packedData && (packedData == other.packedData));
 }
 
 // =================================================================================================
 // MARK: Methods - Data
 // =================================================================================================
 
-- (void)importFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array
+- (void)cloneStorage
 {
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		_packedData = [self.packedData mutableCopy];
+		return;
+	}
+	
+	// The nodes that may have been handed out by this array stay with it, so the copies still sharing the old storage get copies of them instead; otherwise, this array takes the copies, and nobody else knows about its nodes anymore.
+	NSMutableArray<id<JFJSONValue>>* list = self.list;
+	NSMutableArray<id<JFJSONValue>>* clone = [list mutableCopy];
+	NSMutableArray<id<JFJSONValue>>* target = (_exposesNodes ? list : clone);
+	for(NSUInteger index = 0; index < target.count; index++)
+	{
+		id value = [target objectAtIndex:index];
+		if(JFJSONArrayIsNode(value))
+			[target replaceObjectAtIndex:index withObject:[value copy]];
+	}
+	_list = clone;
+}
+
+- (void)detachStorage
+{
+	if(!_sharesStorage)
+		return;
+	
+	_sharesStorage = NO;
+	[self cloneStorage];
+}
+
+- (void)exposeNode:(id<JFJSONValue>)node
+{
+	_exposesNodes = YES;
+	[(id)node addOwner:self];
+}
+
+- (void)exposeNodes
+{
+	[self detachStorage];
+	for(id value in self.list)
+	{
+		if(JFJSONArrayIsNode(value))
+			[self exposeNode:value];
+	}
+}
+
+- (void)importValue:(id<JFJSONValue>)value
+{
+	[self willChange];
+	[self detachStorage];
+	
+	value = [self checkValue:value];
+	if(value)
+		[self appendValue:value];
+}
+
+- (void)importFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array keyTable:(JFJSONKeyTable*)keyTable
+{
+	if((self.count == 0) && [self importPackedFromArray:array])
+		return;
+	
+	// Objects that are elements of the same array usually are records with the same keys: they can share the same key layout.
+	BOOL sharesKeyLayouts = JFJSONObject.sharesKeyLayouts;
 	for(NSUInteger index = 0; index < array.count; index++)
 	{
 		id value = [array objectAtIndex:index];
 		if([value isKindOfClass:[NSArray class]])
-			value = [[JFJSONArray alloc] initWithArray:value];
+			value = [[JFJSONArray alloc] initWithArray:value keyTable:keyTable];
 		else if([value isKindOfClass:[NSDictionary class]])
-			value = [[JFJSONObject alloc] initWithDictionary:value];
-		[self addValue:value];
+			value = [[JFJSONObject alloc] initWithDictionary:value keyTable:keyTable sharingLayout:sharesKeyLayouts];
+		
+		value = [self checkValue:value];
+		if(value)
+			[self appendValue:value];
 	}
 }
 
+- (BOOL)importPackedFromArray:(NSArray<id<JFJSONConvertibleValue>>* _Nullable)array
+{
+	NSUInteger count = array.count;
+	JFJSONArrayStorage storage = JFJSONArrayStorageForValue(array.firstObject);
+	if((count == 0) || (storage == JFJSONArrayStorageObjects))
+		return NO;
+	
+	NSMutableData* data = [[NSMutableData alloc] initWithLength:(count * sizeof(JFJSONArrayPackedValue))];
+	JFJSONArrayPackedValue* values = (JFJSONArrayPackedValue*)data.mutableBytes;
+	NSUInteger index = 0;
+	for(id value in array)
+	{
+		if(JFJSONArrayStorageForValue(value) != storage)
+			return NO;
+		
+		if(storage == JFJSONArrayStorageDoubles)
+			values[index].real = ((NSNumber*)value).doubleValue;
+		else
+			values[index].integer = ((NSNumber*)value).longLongValue;
+		index++;
+	}
+	
+	_list = nil;
+	_packedData = data;
+	_storage = storage;
+	return YES;
+}
+
 // =================================================================================================
 // MARK: Methods - Data (Arrays)
 // =================================================================================================
@@ -304,7 +649,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (JFJSONArray* _Nullable)arrayAtIndex:(NSUInteger)index
 {
 	id<JFJSONValue> retVal = [self valueAtIndex:index];
-	return ((retVal && [retVal isKindOfClass:[JFJSONArray class]]) ? (JFJSONArray*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindArray) ? (JFJSONArray*)retVal : nil);
 }
 
 - (void)insertArray:(JFJSONArray*)value atIndex:(NSUInteger)index
@@ -317,6 +662,91 @@ NS_ASSUME_NONNULL_BEGIN
 	[self replaceWithValue:value atIndex:index];
 }
 
+// =================================================================================================
+// MARK: Methods - Data (Packed values)
+// =================================================================================================
+
+- (void)addPackedValues:(const JFJSONArrayPackedValue*)values count:(NSUInteger)count storage:(JFJSONArrayStorage)storage
+{
+	if(count == 0)
+		return;
+	
+	[self willChange];
+	
+	_hashValue = 0;
+	if(self.count == 0)
+	{
+		_list = nil;
+		_packedData = [NSMutableData new];
+		_sharesStorage = NO;
+		_storage = storage;
+	}
+	else
+		[self detachStorage];
+	
+	if(self.storage != storage)
+	{
+		// The numbers can't share the packed buffer with the current values: they are boxed.
+		[self unpackValues];
+		NSMutableArray<id<JFJSONValue>>* list = self.list;
+		for(NSUInteger index = 0; index < count; index++)
+			[list addObject:((storage == JFJSONArrayStorageDoubles) ? @(values[index].real) : @(values[index].integer))];
+		return;
+	}
+	
+	[self.packedData appendBytes:values length:(count * sizeof(JFJSONArrayPackedValue))];
+	_mutations++;
+}
+
+- (NSNumber*)boxedValueAtIndex:(NSUInteger)index
+{
+	JFJSONArrayPackedValue value = ((const JFJSONArrayPackedValue*)self.packedData.bytes)[index];
+	return ((self.storage == JFJSONArrayStorageDoubles) ? @(value.real) : @(value.integer));
+}
+
+- (NSUInteger)packedCount
+{
+	return self.packedData.length / sizeof(JFJSONArrayPackedValue);
+}
+
+- (BOOL)storePackedValue:(id<JFJSONValue>)value atIndex:(NSUInteger)index inserting:(BOOL)inserting
+{
+	JFJSONArrayStorage storage = self.storage;
+	if(JFJSONArrayStorageForValue(value) != storage)
+		return NO;
+	
+	NSUInteger count = self.packedCount;
+	if((index > count) || (!inserting && (index == count)))
+		return NO;
+	
+	JFJSONArrayPackedValue packedValue;
+	if(storage == JFJSONArrayStorageDoubles)
+		packedValue.real = ((NSNumber*)value).doubleValue;
+	else
+		packedValue.integer = ((NSNumber*)value).longLongValue;
+	
+	NSRange range = NSMakeRange(index * sizeof(JFJSONArrayPackedValue), (inserting ? 0 : sizeof(JFJSONArrayPackedValue)));
+	[self.packedData replaceBytesInRange:range withBytes:&packedValue length:sizeof(JFJSONArrayPackedValue)];
+	_mutations++;
+	return YES;
+}
+
+- (void)unpackValues
+{
+	if(self.storage == JFJSONArrayStorageObjects)
+		return;
+	
+	NSUInteger count = self.packedCount;
+	NSMutableArray<id<JFJSONValue>>* list = [[NSMutableArray<id<JFJSONValue>> alloc] initWithCapacity:count];
+	for(NSUInteger index = 0; index < count; index++)
+		[list addObject:[self boxedValueAtIndex:index]];
+	
+	_list = list;
+	_mutations++;
+	_packedData = nil;
+	_storage = JFJSONArrayStorageObjects;
+}
+
 // =================================================================================================
 // MARK: Methods - Data (Null)
 // =================================================================================================
@@ -334,7 +764,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (BOOL)isNullAtIndex:(NSUInteger)index
 {
 	id<JFJSONValue> retVal = [self valueAtIndex:index];
-	return (retVal && [retVal isKindOfClass:[NSNull class]]);
+	return (JFJSONValueKindOf(retVal) == JFJSONValueKindNull);
 }
 
 - (void)replaceWithNullAtIndex:(NSUInteger)index
@@ -346,11 +776,89 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - Data (Numbers)
 // =================================================================================================
 
+- (void)addDoubles:(const double*)values count:(NSUInteger)count
+{
+	[self addPackedValues:(const JFJSONArrayPackedValue*)values count:count storage:JFJSONArrayStorageDoubles];
+}
+
+- (void)addIntegers:(const int64_t*)values count:(NSUInteger)count
+{
+	[self addPackedValues:(const JFJSONArrayPackedValue*)values count:count storage:JFJSONArrayStorageIntegers];
+}
+
 - (void)addNumber:(NSNumber*)value
 {
 	[self addValue:value];
 }
 
+- (BOOL)getDoubles:(double*)buffer range:(NSRange)range
+{
+	if(NSMaxRange(range) > self.count)
+		return NO;
+	
+	switch(self.storage)
+	{
+		case JFJSONArrayStorageDoubles:
+		{
+			[self.packedData getBytes:buffer range:NSMakeRange(range.location * sizeof(JFJSONArrayPackedValue), range.length * sizeof(JFJSONArrayPackedValue))];
+			return YES;
+		}
+		case JFJSONArrayStorageIntegers:
+		{
+			const JFJSONArrayPackedValue* values = (const JFJSONArrayPackedValue*)self.packedData.bytes;
+			for(NSUInteger index = 0; index < range.length; index++)
+				buffer[index] = (double)values[range.location + index].integer;
+			return YES;
+		}
+		default:
+		{
+			NSArray<id<JFJSONValue>>* list = self.list;
+			for(NSUInteger index = 0; index < range.length; index++)
+			{
+				id value = [list objectAtIndex:(range.location + index)];
+				if(JFJSONValueKindOf(value) != JFJSONValueKindNumber)
+					return NO;
+				buffer[index] = ((NSNumber*)value).doubleValue;
+			}
+			return YES;
+		}
+	}
+}
+
+- (BOOL)getIntegers:(int64_t*)buffer range:(NSRange)range
+{
+	if(NSMaxRange(range) > self.count)
+		return NO;
+	
+	switch(self.storage)
+	{
+		case JFJSONArrayStorageIntegers:
+		{
+			[self.packedData getBytes:buffer range:NSMakeRange(range.location * sizeof(JFJSONArrayPackedValue), range.length * sizeof(JFJSONArrayPackedValue))];
+			return YES;
+		}
+		case JFJSONArrayStorageDoubles:
+		{
+			const JFJSONArrayPackedValue* values = (const JFJSONArrayPackedValue*)self.packedData.bytes;
+			for(NSUInteger index = 0; index < range.length; index++)
+				buffer[index] = (int64_t)values[range.location + index].real;
+			return YES;
+		}
+		default:
+		{
+			NSArray<id<JFJSONValue>>* list = self.list;
+			for(NSUInteger index = 0; index < range.length; index++)
+			{
+				id value = [list objectAtIndex:(range.location + index)];
+				if(JFJSONValueKindOf(value) != JFJSONValueKindNumber)
+					return NO;
+				buffer[index] = ((NSNumber*)value).longLongValue;
+			}
+			return YES;
+		}
+	}
+}
+
 - (void)insertNumber:(NSNumber*)value atIndex:(NSUInteger)index
 {
 	[self insertValue:value atIndex:index];
@@ -359,7 +867,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSNumber* _Nullable)numberAtIndex:(NSUInteger)index
 {
 	id<JFJSONValue> retVal = [self valueAtIndex:index];
-	return ((retVal && [retVal isKindOfClass:[NSNumber class]]) ? (NSNumber*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindNumber) ? (NSNumber*)retVal : nil);
 }
 
 - (void)replaceWithNumber:(NSNumber*)value atIndex:(NSUInteger)index
@@ -384,7 +892,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (JFJSONObject* _Nullable)objectAtIndex:(NSUInteger)index
 {
 	id<JFJSONValue> retVal = [self valueAtIndex:index];
-	return ((retVal && [retVal isKindOfClass:[JFJSONObject class]]) ? (JFJSONObject*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindObject) ? (JFJSONObject*)retVal : nil);
 }
 
 - (void)replaceWithObject:(JFJSONObject*)value atIndex:(NSUInteger)index
@@ -414,7 +922,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSString* _Nullable)stringAtIndex:(NSUInteger)index
 {
 	id<JFJSONValue> retVal = [self valueAtIndex:index];
-	return ((retVal && [retVal isKindOfClass:[NSString class]]) ? (NSString*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindString) ? (NSString*)retVal : nil);
 }
 
 // =================================================================================================
@@ -424,67 +932,187 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)addValue:(id<JFJSONValue>)value
 {
 	value = [self checkValue:value];
-	if(value)
-		[self.list addObject:value];
+	if(!value)
+		return;
+	
+	[self willChange];
+	[self detachStorage];
+	if(JFJSONArrayIsNode(value))
+		[self exposeNode:value];
+	
+	[self appendValue:value];
 }
 
-- (id<JFJSONValue> _Nullable)checkValue:(id _Nullable)value
+- (void)appendValue:(id<JFJSONValue>)value
 {
-	if(!value || [value conformsToProtocol:@protocol(JFJSONValue)])
-		return value;
+	_hashValue = 0;
 	
-	// NB: sometimes the protocol check is not enough, maybe due to cluster classes.
-	
-	static NSArray<Class>* conformingClasses = nil;
-	static dispatch_once_t onceToken;
-	dispatch_once(&onceToken, ^{
-		conformingClasses = @[JFJSONArray.class, JFJSONObject.class, NSNull.class, NSNumber.class, NSString.class];
-	});
-	
-	for(Class conformingClass in conformingClasses)
+	if(self.storage != JFJSONArrayStorageObjects)
 	{
-		if([value isKindOfClass:conformingClass])
-			return value;
+		if([self storePackedValue:value atIndex:self.packedCount inserting:YES])
+			return;
+		[self unpackValues];
 	}
 	
-	return nil;
+	[self.list addObject:value];
+}
+
+- (id<JFJSONValue> _Nullable)checkValue:(id _Nullable)value
+{
+	return ((JFJSONValueKindOf(value) == JFJSONValueKindNone) ? nil : value);
 }
 
 - (void)insertValue:(id<JFJSONValue>)value atIndex:(NSUInteger)index
 {
 	value = [self checkValue:value];
-	if(value)
-		[self.list insertObject:value atIndex:index];
+	if(!value)
+		return;
+	
+	[self willChange];
+	[self detachStorage];
+	if(JFJSONArrayIsNode(value))
+		[self exposeNode:value];
+	
+	_hashValue = 0;
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		if([self storePackedValue:value atIndex:index inserting:YES])
+			return;
+		[self unpackValues];
+	}
+	
+	[self.list insertObject:value atIndex:index];
 }
 
 - (void)removeAllValues
 {
+	[self willChange];
+	
+	// The copies sharing the storage must first get copies of the nodes handed out by this array.
+	if(_exposesNodes)
+		[self detachStorage];
+	
+	_exposesNodes = NO;
+	_hashValue = 0;
+	
+	if((self.storage != JFJSONArrayStorageObjects) || _sharesStorage)
+	{
+		// There is no need to clone the storage just to empty it.
+		_list = [NSMutableArray<id<JFJSONValue>> new];
+		_mutations++;
+		_packedData = nil;
+		_sharesStorage = NO;
+		_storage = JFJSONArrayStorageObjects;
+		return;
+	}
+	
 	[self.list removeAllObjects];
 }
 
 - (void)removeValueAtIndex:(NSUInteger)index
 {
+	[self willChange];
+	[self detachStorage];
+	_hashValue = 0;
+	
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		if(index < self.packedCount)
+		{
+			[self.packedData replaceBytesInRange:NSMakeRange(index * sizeof(JFJSONArrayPackedValue), sizeof(JFJSONArrayPackedValue)) withBytes:NULL length:0];
+			_mutations++;
+			return;
+		}
+		[self unpackValues];
+	}
+	
 	[self.list removeObjectAtIndex:index];
 }
 
 - (void)replaceWithValue:(id<JFJSONValue>)value atIndex:(NSUInteger)index
 {
 	value = [self checkValue:value];
-	if(value)
-		[self.list replaceObjectAtIndex:index withObject:value];
+	if(!value)
+		return;
+	
+	[self willChange];
+	[self detachStorage];
+	if(JFJSONArrayIsNode(value))
+		[self exposeNode:value];
+	
+	_hashValue = 0;
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		if([self storePackedValue:value atIndex:index inserting:NO])
+			return;
+		[self unpackValues];
+	}
+	
+	[self.list replaceObjectAtIndex:index withObject:value];
+}
+
+- (id<JFJSONValue>)storedValueAtIndex:(NSUInteger)index
+{
+	if(self.storage == JFJSONArrayStorageObjects)
+		return [self.list objectAtIndex:index];
+	
+	NSUInteger count = self.packedCount;
+	if(index >= count)
+		@throw [NSException exceptionWithName:NSRangeException reason:[NSString stringWithFormat:@"%@<%@>: Index out of bounds. [index = '%@'; count = '%@']", ClassName, JFStringFromPointer(self), JFStringFromNSUInteger(index), JFStringFromNSUInteger(count)] userInfo:nil];
+	
+	return [self boxedValueAtIndex:index];
 }
 
 - (id<JFJSONValue> _Nullable)valueAtIndex:(NSUInteger)index
 {
-	return [self.list objectAtIndex:index];
+	id<JFJSONValue> retObj = [self storedValueAtIndex:index];
+	if(!JFJSONArrayIsNode(retObj))
+		return retObj;
+	
+	// The node is about to be handed out: if it is shared with a copy, it may be replaced by its own copy first.
+	if(_sharesStorage)
+	{
+		[self detachStorage];
+		retObj = [self storedValueAtIndex:index];
+	}
+	
+	[self exposeNode:retObj];
+	return retObj;
 }
 
 // =================================================================================================
 // MARK: Methods - Enumeration
 // =================================================================================================
 
+- (void)enumerateStoredValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONArrayEnumerationBlock)block
+{
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		for(NSUInteger index = 0, count = self.packedCount; index < count; index++)
+		{
+			NSUInteger position = ((options & NSEnumerationReverse) ? (count - index - 1) : index);
+			if(block(position, [self boxedValueAtIndex:position]))
+				return;
+		}
+		return;
+	}
+	
+	[self.list enumerateObjectsWithOptions:(options & ~NSEnumerationConcurrent) usingBlock:^(id<JFJSONValue> value, NSUInteger index, BOOL* stop) {
+		*stop = block(index, value);
+	}];
+}
+
 - (void)enumerateValuesAtIndexes:(NSIndexSet*)indexes options:(NSEnumerationOptions)options usingBlock:(JFJSONArrayEnumerationBlock)block
 {
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		[indexes enumerateIndexesWithOptions:options usingBlock:^(NSUInteger index, BOOL* stop) {
+			*stop = block(index, [self storedValueAtIndex:index]);
+		}];
+		return;
+	}
+	
+	[self exposeNodes];
 	[self.list enumerateObjectsAtIndexes:indexes options:options usingBlock:^(id<JFJSONValue> value, NSUInteger index, BOOL* stop) {
 		*stop = block(index, value);
 	}];
@@ -492,13 +1120,18 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)enumerateValuesUsingBlock:(JFJSONArrayEnumerationBlock)block
 {
-	[self.list enumerateObjectsUsingBlock:^(id<JFJSONValue> value, NSUInteger index, BOOL* stop) {
-		*stop = block(index, value);
-	}];
+	[self enumerateValuesWithOptions:0 usingBlock:block];
 }
 
 - (void)enumerateValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONArrayEnumerationBlock)block
 {
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		[self enumerateValuesAtIndexes:[NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, self.packedCount)] options:options usingBlock:block];
+		return;
+	}
+	
+	[self exposeNodes];
 	[self.list enumerateObjectsWithOptions:options usingBlock:^(id<JFJSONValue> value, NSUInteger index, BOOL* stop) {
 		*stop = block(index, value);
 	}];
@@ -506,12 +1139,91 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSEnumerator<id<JFJSONValue>>*)reverseValueEnumerator
 {
-	return [self.list reverseObjectEnumerator];
+	[self exposeNodes];
+	return ((self.storage == JFJSONArrayStorageObjects) ? [self.list reverseObjectEnumerator] : [self.arrayValue reverseObjectEnumerator]);
 }
 
 - (NSEnumerator<id<JFJSONValue>>*)valueEnumerator
 {
-	return [self.list objectEnumerator];
+	[self exposeNodes];
+	return ((self.storage == JFJSONArrayStorageObjects) ? [self.list objectEnumerator] : [self.arrayValue objectEnumerator]);
+}
+
+// =================================================================================================
+// MARK: Methods - Ownership
+// =================================================================================================
+
+- (void)addOwner:(id)owner
+{
+	if(!_owners)
+		_owners = [NSHashTable weakObjectsHashTable];
+	[_owners addObject:owner];
+}
+
+- (void)nodeWillChange:(id<JFJSONValue>)node
+{
+	// The owners are told first, so that they can copy this array while it still shares the node; then the copies sharing the storage get their own copy of the node, as this array keeps it.
+	[self willChange];
+	[self detachStorage];
+}
+
+- (void)willChange
+{
+	// The hashes cached along the path leading to this array are reset as well.
+	_hashValue = 0;
+	for(id owner in _owners.allObjects)
+		[owner nodeWillChange:self];
+}
+
+// =================================================================================================
+// MARK: Methods - Parallel Processing
+// =================================================================================================
+
+- (JFJSONArray*)filterValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONArrayFilterBlock)block
+{
+	JFJSONParallelValueReader reader = [self parallelValueReader];
+	NSIndexSet* indexes = JFJSONParallelFilter(self.count, grainSize, ^BOOL(NSUInteger index) {
+		return block(index, reader(index));
+	});
+	
+	JFJSONArray* retObj = [[JFJSONArray alloc] initWithCapacity:indexes.count];
+	[indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL* stop) {
+		[retObj addValue:reader(index)];
+	}];
+	return retObj;
+}
+
+- (NSArray*)mapValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONArrayMapBlock)block
+{
+	JFJSONParallelValueReader reader = [self parallelValueReader];
+	return JFJSONParallelMap(self.count, grainSize, ^id _Nullable(NSUInteger index) {
+		return block(index, reader(index));
+	});
+}
+
+- (JFJSONParallelValueReader)parallelValueReader
+{
+	// Packed values are boxed on the fly, which only reads the packed buffer; stored nodes are about to be handed out to the blocks, so they are exposed once, before the workers start.
+	if(self.storage != JFJSONArrayStorageObjects)
+	{
+		return ^id<JFJSONValue>(NSUInteger index) {
+			return [self boxedValueAtIndex:index];
+		};
+	}
+	
+	[self exposeNodes];
+	NSArray<id<JFJSONValue>>* list = self.list;
+	return ^id<JFJSONValue>(NSUInteger index) {
+		return [list objectAtIndex:index];
+	};
+}
+
+- (id _Nullable)reduceValuesWithGrainSize:(NSUInteger)grainSize initialValue:(id _Nullable)initialValue usingBlock:(JFJSONArrayReduceBlock)block combineBlock:(JFJSONNodeCombineBlock)combineBlock
+{
+	JFJSONParallelValueReader reader = [self parallelValueReader];
+	return JFJSONParallelReduce(self.count, grainSize, initialValue, ^id _Nullable(id _Nullable result, NSUInteger index) {
+		return block(result, index, reader(index));
+	}, combineBlock);
 }
 
 // =================================================================================================
@@ -534,21 +1246,14 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (id)copyWithZone:(NSZone* _Nullable)zone
 {
-	JFJSONArray* retObj = [self.class new];
-	NSMutableArray<id<JFJSONValue>>* list = retObj.list;
-	for(id<JFJSONValue> value in self.list) {
-		if([value isKindOfClass:JFJSONArray.class]) {
-			[list addObject:[(JFJSONArray*)value copy]];
-		} else if([value isKindOfClass:JFJSONObject.class]) {
-			[list addObject:[(JFJSONObject*)value copy]];
-		} else if([value isKindOfClass:NSNull.class]) {
-			[list addObject:[(NSNull*)value copy]];
-		} else if([value isKindOfClass:NSNumber.class]) {
-			[list addObject:[(NSNumber*)value copy]];
-		} else if([value isKindOfClass:NSString.class]) {
-			[list addObject:[(NSString*)value copy]];
-		}
-	}
+	// The copy shares the storage of this array, nodes included, until either of them is changed, or until one of the nodes handed out by this array is about to change: the copy is then left with copies of those nodes (see `cloneStorage`).
+	JFJSONArray* retObj = [[self.class alloc] initWithCapacity:0];
+	retObj->_hashValue = _hashValue;
+	retObj->_list = self.list;
+	retObj->_packedData = self.packedData;
+	retObj->_storage = self.storage;
+	retObj->_sharesStorage = YES;
+	_sharesStorage = YES;
 	return retObj;
 }
 
@@ -558,7 +1263,24 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState*)state objects:(__unsafe_unretained id _Nullable [])buffer count:(NSUInteger)len
 {
-	return [self.list countByEnumeratingWithState:state objects:buffer count:len];
+	if(self.storage == JFJSONArrayStorageObjects)
+	{
+		if(state->state == 0)
+			[self exposeNodes];
+		return [self.list countByEnumeratingWithState:state objects:buffer count:len];
+	}
+	
+	// The numbers are boxed one batch at a time: they are autoreleased, so that they outlive the batch.
+	NSUInteger count = self.packedCount;
+	NSUInteger index = (NSUInteger)state->state;
+	NSUInteger retVal = ((index < count) ? MIN(len, count - index) : 0);
+	for(NSUInteger offset = 0; offset < retVal; offset++)
+		buffer[offset] = (__bridge id)CFAutorelease(CFBridgingRetain([self boxedValueAtIndex:(index + offset)]));
+	
+	state->itemsPtr = buffer;
+	state->mutationsPtr = &_mutations;
+	state->state = index + retVal;
+	return retVal;
 }
 
 @end
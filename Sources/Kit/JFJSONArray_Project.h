@@ -0,0 +1,122 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <JFKit/JFJSONArray.h>
+
+@class JFJSONKeyTable;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONArray (/* Project */)
+
+// =================================================================================================
+// MARK: Properties - Comparison
+// =================================================================================================
+
+/**
+ * A 64 bit hash of the content of this array, computed over its values in order: equal arrays have the same structural hash, whatever the storage of their numbers.
+ * @discussion The hash is cached and computed again only after this array changes; the hashes of the nested nodes are cached as well, so that changing a nested node only affects the path leading to it.
+ */
+@property (assign, nonatomic, readonly) uint64_t structuralHash;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithArray:(NSArray<id<JFJSONConvertibleValue>>*)array keyTable:(JFJSONKeyTable*)keyTable;
+
+// =================================================================================================
+// MARK: Methods - Comparison
+// =================================================================================================
+
+/**
+ * Returns whether this array and the given one share the same storage, as happens after a copy until either of them is changed: arrays sharing their storage are equal.
+ * @discussion Unlike `isEqualToJSONArray:`, this method never visits the stored values, nor computes any hash. A `NO` result does not mean that the arrays differ.
+ * @param other The array to check.
+ * @return `YES` if the arrays share their storage, `NO` otherwise.
+ */
+- (BOOL)sharesStorageWithJSONArray:(JFJSONArray*)other;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+/**
+ * Adds the given value, created by an importer, at the end of the array.
+ * @discussion Unlike `addValue:`, this method assumes that nobody else references the given value, so that copies of this array can keep sharing its storage.
+ * @param value The value to add.
+ */
+- (void)importValue:(id<JFJSONValue>)value;
+
+/**
+ * Returns the stored value at the given index, without handing it out.
+ * @discussion Unlike `valueAtIndex:`, this method does not detach this array from the storage shared with its copies: the returned node must not be changed, and must be copied to be kept.
+ * @param index The index of the value.
+ * @return The stored value at the given index.
+ */
+- (id<JFJSONValue>)storedValueAtIndex:(NSUInteger)index;
+
+// =================================================================================================
+// MARK: Methods - Enumeration
+// =================================================================================================
+
+/**
+ * Applies a given block to the stored values, without handing them out.
+ * @discussion Unlike `enumerateValuesWithOptions:usingBlock:`, this method does not detach this array from the storage shared with its copies: the nodes passed to the block must not be changed, nor kept after the enumeration.
+ * @param options Enumeration options.
+ * @param block A block to operate on entries in the JSON array.
+ */
+- (void)enumerateStoredValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONArrayEnumerationBlock)block;
+
+
+// =================================================================================================
+// MARK: Methods - Ownership
+// =================================================================================================
+
+/**
+ * Registers the given container as an owner of this array: the owners are told before this array changes, using `nodeWillChange:`.
+ * @discussion The owners are referenced weakly. Containers register themselves when they hand out this array or are given it by the caller, so that they can stop sharing it with their copies before it changes.
+ * @param owner The container to register.
+ */
+- (void)addOwner:(id)owner;
+
+/**
+ * Tells this array that the given node, stored inside of it, is about to change.
+ * @param node The node that is about to change.
+ */
+- (void)nodeWillChange:(id<JFJSONValue>)node;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,308 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFJSONArray.h>
+#import <JFKit/JFJSONObject.h>
+
+@class JFJSONDecoder;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * A list of error codes that can be found inside errors created by the class `JFJSONDecoder`.
+ */
+typedef NS_ENUM(NSInteger, JFJSONDecoderError) {
+	
+	/**
+	 * The data is not valid JSON content, or its root is not of the expected kind.
+	 */
+	JFJSONDecoderErrorInvalidData,
+	
+	/**
+	 * A required field has no value, or its value is `null`.
+	 */
+	JFJSONDecoderErrorMissingValue,
+	
+	/**
+	 * The value of a field does not match the type declared by the field.
+	 */
+	JFJSONDecoderErrorTypeMismatch,
+};
+
+/**
+ * A list of the types of value a field can decode.
+ */
+typedef NS_ENUM(UInt8, JFJSONFieldType)
+{
+	/**
+	 * A JSON array, assigned to the property as a `JFJSONArray`.
+	 */
+	JFJSONFieldTypeArray,
+	
+	/**
+	 * A JSON object, decoded into a model object by the decoder of the field.
+	 */
+	JFJSONFieldTypeModel,
+	
+	/**
+	 * A JSON array of objects, each one decoded into a model object by the decoder of the field; assigned to the property as an `NSArray`.
+	 */
+	JFJSONFieldTypeModelArray,
+	
+	/**
+	 * A JSON number (or boolean), assigned to the property as an `NSNumber` or converted to the scalar type of the property.
+	 */
+	JFJSONFieldTypeNumber,
+	
+	/**
+	 * A JSON object, assigned to the property as a `JFJSONObject`.
+	 */
+	JFJSONFieldTypeObject,
+	
+	/**
+	 * A JSON string, assigned to the property as an `NSString`.
+	 */
+	JFJSONFieldTypeString,
+	
+	/**
+	 * Any JSON value, assigned to the property as it is (nodes are assigned as `JFJSONArray` and `JFJSONObject` instances).
+	 */
+	JFJSONFieldTypeValue,
+};
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * The `JFJSONField` class describes how a property of a model object is filled: the key path of the value inside the JSON object, the expected type of the value and what to do when the value is missing or `null`.
+ * @discussion Key paths are made of keys separated by dots, like `author.name`. By default a field is required, so a missing value is an error; a field with a default value assigns the default value instead, while an optional field leaves the property untouched.
+ */
+@interface JFJSONField : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * The decoder used to decode the value of the field, if the type of the field is `JFJSONFieldTypeModel` or `JFJSONFieldTypeModelArray`.
+ */
+@property (strong, nonatomic, readonly, nullable) JFJSONDecoder* decoder;
+
+/**
+ * The value assigned to the property when the value of the field is missing or `null`; scalar properties expect an `NSNumber`.
+ */
+@property (strong, nonatomic, readonly, nullable) id defaultValue;
+
+/**
+ * The dot separated key path of the value inside the JSON object.
+ */
+@property (copy, nonatomic, readonly) NSString* keyPath;
+
+/**
+ * Returns `YES` if a missing or `null` value is not an error.
+ */
+@property (assign, nonatomic, readonly, getter=isOptional) BOOL optional;
+
+/**
+ * The name of the property of the model object that receives the value.
+ */
+@property (copy, nonatomic, readonly) NSString* property;
+
+/**
+ * The expected type of the value.
+ */
+@property (assign, nonatomic, readonly) JFJSONFieldType type;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+/**
+ * Creates a new required field whose value is decoded into a model object by the given decoder.
+ * @param property The name of the property.
+ * @param keyPath The key path of the value.
+ * @param decoder The decoder of the value.
+ * @return A new field.
+ */
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath decoder:(JFJSONDecoder*)decoder;
+
+/**
+ * Creates a new required field whose value is an array of objects, each one decoded into a model object by the given decoder.
+ * @param property The name of the property.
+ * @param keyPath The key path of the value.
+ * @param decoder The decoder of the elements of the array.
+ * @return A new field.
+ */
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath elementDecoder:(JFJSONDecoder*)decoder;
+
+/**
+ * Creates a new required field.
+ * @param property The name of the property.
+ * @param keyPath The key path of the value.
+ * @param type The expected type of the value; it can't be `JFJSONFieldTypeModel` nor `JFJSONFieldTypeModelArray`.
+ * @return A new field.
+ */
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type;
+
+/**
+ * Creates a new field that assigns the given default value when its value is missing or `null`.
+ * @param property The name of the property.
+ * @param keyPath The key path of the value.
+ * @param type The expected type of the value; it can't be `JFJSONFieldTypeModel` nor `JFJSONFieldTypeModelArray`.
+ * @param defaultValue The default value.
+ * @return A new field.
+ */
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type defaultValue:(id)defaultValue;
+
+/**
+ * Creates a new optional field.
+ * @param property The name of the property.
+ * @param keyPath The key path of the value.
+ * @param type The expected type of the value; it can't be `JFJSONFieldTypeModel` nor `JFJSONFieldTypeModelArray`.
+ * @return A new field.
+ */
++ (instancetype)optionalFieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes this instance with the given values.
+ * @param property The name of the property.
+ * @param keyPath The key path of the value.
+ * @param type The expected type of the value.
+ * @param decoder The decoder of the value; it's required if `type` is `JFJSONFieldTypeModel` or `JFJSONFieldTypeModelArray`, ignored otherwise.
+ * @param defaultValue The default value, if any.
+ * @param optional `YES` if a missing or `null` value is not an error.
+ * @return This instance.
+ */
+- (instancetype)initWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type decoder:(JFJSONDecoder* _Nullable)decoder defaultValue:(id _Nullable)defaultValue optional:(BOOL)optional NS_DESIGNATED_INITIALIZER;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * The `JFJSONDecoder` class fills model objects with the values found inside JSON objects, following a schema made of `JFJSONField` instances.
+ * @discussion The schema is compiled when the decoder is created: the properties are resolved once through the runtime, and the key paths sharing a prefix are merged, so that each record is decoded in a single pass that visits every key only once. While decoding a collection of records, the position of each key inside the storage layout shared by the records is remembered, so that the values of records with the same set of keys are read by index. JSON data can be decoded directly, without building a tree of `JFJSONObject` and `JFJSONArray` instances.
+ * Model objects are created using `init`; the properties must be writable and are assigned using their setters. Properties of scalar types (integers, floating point numbers and booleans) can only be filled by fields of type `JFJSONFieldTypeNumber`.
+ * @warning Instances of this class are immutable and can be used concurrently.
+ */
+@interface JFJSONDecoder : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * The fields of the schema.
+ */
+@property (copy, nonatomic, readonly) NSArray<JFJSONField*>* fields;
+
+/**
+ * The class of the model objects.
+ */
+@property (strong, nonatomic, readonly) Class modelClass;
+
+// =================================================================================================
+// MARK: Properties - Errors
+// =================================================================================================
+
+/**
+ * The domain of the errors created by the decoders.
+ */
+@property (class, strong, nonatomic, readonly) NSErrorDomain errorDomain;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+/**
+ * Creates a new decoder with the given schema.
+ * @param modelClass The class of the model objects.
+ * @param fields The fields of the schema.
+ * @return A new decoder, or `nil` if the schema does not match the model class.
+ */
++ (instancetype _Nullable)decoderWithModelClass:(Class)modelClass fields:(NSArray<JFJSONField*>*)fields;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes this instance with the given schema.
+ * @param modelClass The class of the model objects.
+ * @param fields The fields of the schema.
+ * @return This instance, or `nil` if the schema does not match the model class (for example if a property does not exist, is read-only or can't hold the type of its field).
+ */
+- (instancetype _Nullable)initWithModelClass:(Class)modelClass fields:(NSArray<JFJSONField*>*)fields NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - Decoding
+// =================================================================================================
+
+/**
+ * Decodes each object of the given array into a new model object.
+ * @param array The array of JSON objects to decode.
+ * @param outError The error that occurred while decoding, if any.
+ * @return The decoded model objects, or `nil` if an error occurred.
+ */
+- (NSArray* _Nullable)decodeArray:(JFJSONArray*)array error:(NSError* __autoreleasing _Nullable *)outError;
+
+/**
+ * Parses the given JSON data, whose root must be an array of objects, and decodes each object into a new model object.
+ * @param data The UTF-8 encoded JSON data.
+ * @param outError The error that occurred while decoding, if any.
+ * @return The decoded model objects, or `nil` if an error occurred.
+ */
+- (NSArray* _Nullable)decodeArrayFromData:(NSData*)data error:(NSError* __autoreleasing _Nullable *)outError;
+
+/**
+ * Decodes the given object into a new model object.
+ * @param object The JSON object to decode.
+ * @param outError The error that occurred while decoding, if any.
+ * @return The decoded model object, or `nil` if an error occurred.
+ */
+- (id _Nullable)decodeObject:(JFJSONObject*)object error:(NSError* __autoreleasing _Nullable *)outError;
+
+/**
+ * Parses the given JSON data, whose root must be an object, and decodes it into a new model object.
+ * @param data The UTF-8 encoded JSON data.
+ * @param outError The error that occurred while decoding, if any.
+ * @return The decoded model object, or `nil` if an error occurred.
+ */
+- (id _Nullable)decodeObjectFromData:(NSData*)data error:(NSError* __autoreleasing _Nullable *)outError;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
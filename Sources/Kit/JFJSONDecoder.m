@@ -0,0 +1,934 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONDecoder.h"
+
+#import <objc/runtime.h>
+
+#import "JFErrorFactory.h"
+#import "JFJSONArray_Project.h"
+#import "JFJSONDocument.h"
+#import "JFJSONKeyTable.h"
+#import "JFJSONObject_Project.h"
+#import "JFJSONValueKind.h"
+#import "JFKitLogger.h"
+#import "JFShortcuts.h"
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * A field resolved against the model class: the setter of its property and the type of the property are looked up only once, when the decoder is created.
+ */
+typedef struct
+{
+	/**
+	 * The decoder of the value, if the field decodes model objects.
+	 */
+	__unsafe_unretained JFJSONDecoder* _Nullable decoder;
+	
+	/**
+	 * The value assigned when the value of the field is missing or `null`.
+	 */
+	__unsafe_unretained id _Nullable defaultValue;
+	
+	/**
+	 * The type encoding of the property (the first character of the `T` attribute).
+	 */
+	char encoding;
+	
+	/**
+	 * The implementation of the setter of the property.
+	 */
+	IMP implementation;
+	
+	/**
+	 * The key path of the field, used when reporting errors.
+	 */
+	__unsafe_unretained NSString* keyPath;
+	
+	/**
+	 * `YES` if a missing or `null` value is not an error.
+	 */
+	BOOL optional;
+	
+	/**
+	 * The selector of the setter of the property.
+	 */
+	SEL setter;
+	
+	/**
+	 * The expected type of the value.
+	 */
+	JFJSONFieldType type;
+} JFJSONDecoderEntry;
+
+/**
+ * A key shared by the key paths of one or more fields: the key paths are merged into a tree whose nodes are stored in breadth-first order, so the children of each node are contiguous and every key is looked up only once per record.
+ */
+typedef struct
+{
+	/**
+	 * The number of children of the node.
+	 */
+	NSUInteger childrenCount;
+	
+	/**
+	 * The number of fields whose key path ends with the node.
+	 */
+	NSUInteger entriesCount;
+	
+	/**
+	 * The index of the first child of the node.
+	 */
+	NSUInteger firstChild;
+	
+	/**
+	 * The index of the first field whose key path ends with the node.
+	 */
+	NSUInteger firstEntry;
+	
+	/**
+	 * The key of the node; `nil` for the root.
+	 */
+	__unsafe_unretained NSString* _Nullable key;
+	
+	/**
+	 * The key path leading to the node, used when reporting errors.
+	 */
+	__unsafe_unretained NSString* path;
+} JFJSONDecoderNode;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONDecoder (/* Private */)
+
+// =================================================================================================
+// MARK: Properties - Errors
+// =================================================================================================
+
+@property (class, strong, nonatomic, readonly) JFErrorFactory* errorFactory;
+
+// =================================================================================================
+// MARK: Properties - Schema
+// =================================================================================================
+
+@property (assign, nonatomic, readonly) const JFJSONDecoderEntry* entries;
+@property (assign, nonatomic, readonly) NSUInteger entriesCount;
+@property (assign, nonatomic, readonly) const JFJSONDecoderNode* nodes;
+@property (assign, nonatomic, readonly) NSUInteger nodesCount;
+
+// =================================================================================================
+// MARK: Methods - Schema
+// =================================================================================================
+
+- (BOOL)resolveEntry:(JFJSONDecoderEntry*)entry withField:(JFJSONField*)field;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * The state of a single decoding call: it remembers, for each node of the schema, the storage layout of the last object visited and the positions of the keys of its children inside it, so that records sharing the same layout are read by index.
+ */
+@interface JFJSONDecoderSession : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@property (strong, nonatomic, readonly) JFJSONDecoder* decoder;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithDecoder:(JFJSONDecoder*)decoder NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - Decoding
+// =================================================================================================
+
+- (NSArray* _Nullable)decodeArray:(id<JFJSONNode>)array error:(NSError* __autoreleasing _Nullable *)outError;
+- (id _Nullable)decodeObject:(id<JFJSONNode>)object error:(NSError* __autoreleasing _Nullable *)outError;
+- (BOOL)fillModel:(id)model withMissingNode:(NSUInteger)nodeIndex error:(NSError* __autoreleasing _Nullable *)outError;
+- (BOOL)fillModel:(id)model withNode:(NSUInteger)nodeIndex container:(id<JFJSONNode>)container error:(NSError* __autoreleasing _Nullable *)outError;
+- (BOOL)fillModel:(id)model withValue:(id<JFJSONValue> _Nullable)value entry:(NSUInteger)entryIndex error:(NSError* __autoreleasing _Nullable *)outError;
+- (JFJSONDecoderSession*)sessionForEntry:(NSUInteger)entryIndex;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+static JFJSONValueKind JFJSONDecoderKindOf(id _Nullable value)
+{
+	JFJSONValueKind retVal = JFJSONValueKindOf(value);
+	if(retVal == JFJSONValueKindOther)
+	{
+		if([value isKindOfClass:JFJSONDocumentArray.class])
+			retVal = JFJSONValueKindArray;
+		else if([value isKindOfClass:JFJSONDocumentObject.class])
+			retVal = JFJSONValueKindObject;
+	}
+	return retVal;
+}
+
+static id<JFJSONValue> JFJSONDecoderNodeValue(id<JFJSONValue> value)
+{
+	// Tree nodes are copied, so that the model objects never share mutable state with the decoded records; copies share their storage until either side changes. Document nodes are converted, so that the model objects don't keep the whole document alive.
+	switch(JFJSONValueKindOf(value))
+	{
+		case JFJSONValueKindArray:
+		case JFJSONValueKindObject:
+			return [(NSObject*)value copy];
+		case JFJSONValueKindOther:
+		{
+			if([(NSObject*)value isKindOfClass:JFJSONDocumentArray.class])
+				return [[JFJSONArray alloc] initWithArray:((JFJSONDocumentArray*)value).arrayValue];
+			if([(NSObject*)value isKindOfClass:JFJSONDocumentObject.class])
+				return [[JFJSONObject alloc] initWithDictionary:((JFJSONDocumentObject*)value).dictionaryValue];
+			return value;
+		}
+		default:
+			return value;
+	}
+}
+
+static void JFJSONDecoderSetValue(id model, const JFJSONDecoderEntry* entry, id _Nullable value)
+{
+	IMP implementation = entry->implementation;
+	SEL setter = entry->setter;
+	switch(entry->encoding)
+	{
+		case '@':
+			((void (*)(id, SEL, id _Nullable))implementation)(model, setter, value);
+			break;
+		case 'B':
+			((void (*)(id, SEL, bool))implementation)(model, setter, [(NSNumber*)value boolValue]);
+			break;
+		case 'c':
+			((void (*)(id, SEL, char))implementation)(model, setter, [(NSNumber*)value charValue]);
+			break;
+		case 'C':
+			((void (*)(id, SEL, unsigned char))implementation)(model, setter, [(NSNumber*)value unsignedCharValue]);
+			break;
+		case 'd':
+			((void (*)(id, SEL, double))implementation)(model, setter, [(NSNumber*)value doubleValue]);
+			break;
+		case 'f':
+			((void (*)(id, SEL, float))implementation)(model, setter, [(NSNumber*)value floatValue]);
+			break;
+		case 'i':
+			((void (*)(id, SEL, int))implementation)(model, setter, [(NSNumber*)value intValue]);
+			break;
+		case 'I':
+			((void (*)(id, SEL, unsigned int))implementation)(model, setter, [(NSNumber*)value unsignedIntValue]);
+			break;
+		case 'l':
+			((void (*)(id, SEL, long))implementation)(model, setter, [(NSNumber*)value longValue]);
+			break;
+		case 'L':
+			((void (*)(id, SEL, unsigned long))implementation)(model, setter, [(NSNumber*)value unsignedLongValue]);
+			break;
+		case 'q':
+			((void (*)(id, SEL, long long))implementation)(model, setter, [(NSNumber*)value longLongValue]);
+			break;
+		case 'Q':
+			((void (*)(id, SEL, unsigned long long))implementation)(model, setter, [(NSNumber*)value unsignedLongLongValue]);
+			break;
+		case 's':
+			((void (*)(id, SEL, short))implementation)(model, setter, [(NSNumber*)value shortValue]);
+			break;
+		case 'S':
+			((void (*)(id, SEL, unsigned short))implementation)(model, setter, [(NSNumber*)value unsignedShortValue]);
+			break;
+		default:
+			break;
+	}
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONField
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize decoder = _decoder;
+@synthesize defaultValue = _defaultValue;
+@synthesize keyPath = _keyPath;
+@synthesize optional = _optional;
+@synthesize property = _property;
+@synthesize type = _type;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath decoder:(JFJSONDecoder*)decoder
+{
+	return [[self alloc] initWithProperty:property keyPath:keyPath type:JFJSONFieldTypeModel decoder:decoder defaultValue:nil optional:NO];
+}
+
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath elementDecoder:(JFJSONDecoder*)decoder
+{
+	return [[self alloc] initWithProperty:property keyPath:keyPath type:JFJSONFieldTypeModelArray decoder:decoder defaultValue:nil optional:NO];
+}
+
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type
+{
+	return [[self alloc] initWithProperty:property keyPath:keyPath type:type decoder:nil defaultValue:nil optional:NO];
+}
+
++ (instancetype)fieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type defaultValue:(id)defaultValue
+{
+	return [[self alloc] initWithProperty:property keyPath:keyPath type:type decoder:nil defaultValue:defaultValue optional:YES];
+}
+
++ (instancetype)optionalFieldWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type
+{
+	return [[self alloc] initWithProperty:property keyPath:keyPath type:type decoder:nil defaultValue:nil optional:YES];
+}
+
+- (instancetype)initWithProperty:(NSString*)property keyPath:(NSString*)keyPath type:(JFJSONFieldType)type decoder:(JFJSONDecoder* _Nullable)decoder defaultValue:(id _Nullable)defaultValue optional:(BOOL)optional
+{
+	self = [super init];
+	
+	_decoder = decoder;
+	_defaultValue = defaultValue;
+	_keyPath = [keyPath copy];
+	_optional = optional;
+	_property = [property copy];
+	_type = type;
+	
+	return self;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDecoder
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// The keys and key paths of the nodes, kept alive for the lifetime of the decoder.
+	NSMutableArray<NSString*>* _strings;
+}
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize fields = _fields;
+@synthesize modelClass = _modelClass;
+
+// =================================================================================================
+// MARK: Properties - Schema
+// =================================================================================================
+
+@synthesize entries = _entries;
+@synthesize entriesCount = _entriesCount;
+@synthesize nodes = _nodes;
+@synthesize nodesCount = _nodesCount;
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Errors
+// =================================================================================================
+
++ (NSErrorDomain)errorDomain
+{
+	return @"com.jackfelle.jsonDecoder";
+}
+
++ (JFErrorFactory*)errorFactory
+{
+	static JFErrorFactory* retObj = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		retObj = [[JFErrorFactory alloc] initWithDomain:self.errorDomain];
+	});
+	return retObj;
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
++ (instancetype _Nullable)decoderWithModelClass:(Class)modelClass fields:(NSArray<JFJSONField*>*)fields
+{
+	return [[self alloc] initWithModelClass:modelClass fields:fields];
+}
+
+- (void)dealloc
+{
+	free((void*)_entries);
+	free((void*)_nodes);
+}
+
+- (instancetype _Nullable)initWithModelClass:(Class)modelClass fields:(NSArray<JFJSONField*>*)fields
+{
+	self = [super init];
+	
+	_fields = [fields copy];
+	_modelClass = modelClass;
+	_strings = [NSMutableArray<NSString*> new];
+	
+	// Merges the key paths into a tree: each tree node is a mutable dictionary holding its children by key (in insertion order, to keep the decoding order stable) and the indexes of the fields ending with it.
+	NSMutableArray<NSMutableDictionary*>* treeNodes = [NSMutableArray<NSMutableDictionary*> new];
+	NSMutableDictionary* root = [@{@"children": [NSMutableArray new], @"fields": [NSMutableArray new], @"path": @""} mutableCopy];
+	[treeNodes addObject:root];
+	
+	NSArray<JFJSONField*>* fieldsCopy = _fields;
+	for(NSUInteger index = 0; index < fieldsCopy.count; index++)
+	{
+		JFJSONField* field = fieldsCopy[index];
+		NSArray<NSString*>* keys = [field.keyPath componentsSeparatedByString:@"."];
+		NSMutableDictionary* node = root;
+		for(NSString* key in keys)
+		{
+			if(key.length == 0)
+			{
+				[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Invalid key path. [keyPath = '%@']", ClassName, JFStringFromPointer(self), field.keyPath] tags:JFLoggerTagsError];
+				return nil;
+			}
+			
+			NSMutableDictionary* child = nil;
+			for(NSMutableDictionary* candidate in node[@"children"])
+			{
+				if([candidate[@"key"] isEqualToString:key])
+				{
+					child = candidate;
+					break;
+				}
+			}
+			if(!child)
+			{
+				NSString* path = ([node[@"path"] length] > 0) ? [NSString stringWithFormat:@"%@.%@", node[@"path"], key] : key;
+				child = [@{@"children": [NSMutableArray new], @"fields": [NSMutableArray new], @"key": key, @"path": path} mutableCopy];
+				[node[@"children"] addObject:child];
+			}
+			node = child;
+		}
+		[node[@"fields"] addObject:@(index)];
+	}
+	
+	// Flattens the tree in breadth-first order.
+	for(NSUInteger index = 0; index < treeNodes.count; index++)
+		[treeNodes addObjectsFromArray:treeNodes[index][@"children"]];
+	
+	NSUInteger entriesCount = fieldsCopy.count;
+	NSUInteger nodesCount = treeNodes.count;
+	JFJSONDecoderEntry* entries = calloc(MAX(entriesCount, 1), sizeof(JFJSONDecoderEntry));
+	JFJSONDecoderNode* nodes = calloc(nodesCount, sizeof(JFJSONDecoderNode));
+	if(!entries || !nodes)
+	{
+		free(entries);
+		free(nodes);
+		return nil;
+	}
+	_entries = entries;
+	_entriesCount = entriesCount;
+	_nodes = nodes;
+	_nodesCount = nodesCount;
+	
+	NSUInteger nextChild = 1;
+	NSUInteger nextEntry = 0;
+	for(NSUInteger index = 0; index < nodesCount; index++)
+	{
+		NSDictionary* treeNode = treeNodes[index];
+		JFJSONDecoderNode* node = &nodes[index];
+		
+		NSString* key = treeNode[@"key"];
+		NSString* path = treeNode[@"path"];
+		if(key)
+			[_strings addObject:key];
+		[_strings addObject:path];
+		node->key = key;
+		node->path = path;
+		
+		NSArray<NSMutableDictionary*>* children = treeNode[@"children"];
+		node->childrenCount = children.count;
+		node->firstChild = nextChild;
+		nextChild += children.count;
+		
+		NSArray<NSNumber*>* fieldIndexes = treeNode[@"fields"];
+		node->entriesCount = fieldIndexes.count;
+		node->firstEntry = nextEntry;
+		for(NSNumber* fieldIndex in fieldIndexes)
+		{
+			if(![self resolveEntry:&entries[nextEntry++] withField:fieldsCopy[fieldIndex.unsignedIntegerValue]])
+				return nil;
+		}
+	}
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Decoding
+// =================================================================================================
+
+- (NSArray* _Nullable)decodeArray:(JFJSONArray*)array error:(NSError* __autoreleasing _Nullable *)outError
+{
+	return [[[JFJSONDecoderSession alloc] initWithDecoder:self] decodeArray:array error:outError];
+}
+
+- (NSArray* _Nullable)decodeArrayFromData:(NSData*)data error:(NSError* __autoreleasing _Nullable *)outError
+{
+	// The data is parsed into a document, whose nodes are read in place: the records are never turned into a tree of JSON objects.
+	id<JFJSONValue> root = [JFJSONDocument documentWithData:data].root;
+	if(![(NSObject*)root isKindOfClass:JFJSONDocumentArray.class])
+	{
+		if(outError)
+			*outError = [self.class.errorFactory errorWithCode:JFJSONDecoderErrorInvalidData description:@"The data does not contain a JSON array."];
+		return nil;
+	}
+	
+	return [[[JFJSONDecoderSession alloc] initWithDecoder:self] decodeArray:(JFJSONDocumentArray*)root error:outError];
+}
+
+- (id _Nullable)decodeObject:(JFJSONObject*)object error:(NSError* __autoreleasing _Nullable *)outError
+{
+	return [[[JFJSONDecoderSession alloc] initWithDecoder:self] decodeObject:object error:outError];
+}
+
+- (id _Nullable)decodeObjectFromData:(NSData*)data error:(NSError* __autoreleasing _Nullable *)outError
+{
+	id<JFJSONValue> root = [JFJSONDocument documentWithData:data].root;
+	if(![(NSObject*)root isKindOfClass:JFJSONDocumentObject.class])
+	{
+		if(outError)
+			*outError = [self.class.errorFactory errorWithCode:JFJSONDecoderErrorInvalidData description:@"The data does not contain a JSON object."];
+		return nil;
+	}
+	
+	return [[[JFJSONDecoderSession alloc] initWithDecoder:self] decodeObject:(JFJSONDocumentObject*)root error:outError];
+}
+
+// =================================================================================================
+// MARK: Methods - Schema
+// =================================================================================================
+
+- (BOOL)resolveEntry:(JFJSONDecoderEntry*)entry withField:(JFJSONField*)field
+{
+	Class modelClass = self.modelClass;
+	NSString* name = field.property;
+	
+	objc_property_t property = ((name.length > 0) ? class_getProperty(modelClass, name.UTF8String) : NULL);
+	if(!property)
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Property not found. [property = '%@']", ClassName, JFStringFromPointer(self), name] tags:JFLoggerTagsError];
+		return NO;
+	}
+	
+	char* attribute = property_copyAttributeValue(property, "R");
+	if(attribute)
+	{
+		free(attribute);
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Property is read-only. [property = '%@']", ClassName, JFStringFromPointer(self), name] tags:JFLoggerTagsError];
+		return NO;
+	}
+	
+	attribute = property_copyAttributeValue(property, "S");
+	SEL setter;
+	if(attribute)
+		setter = sel_registerName(attribute);
+	else
+		setter = NSSelectorFromString([NSString stringWithFormat:@"set%@%@:", [name substringToIndex:1].uppercaseString, [name substringFromIndex:1]]);
+	free(attribute);
+	
+	if(![modelClass instancesRespondToSelector:setter])
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Property setter not found. [property = '%@']", ClassName, JFStringFromPointer(self), name] tags:JFLoggerTagsError];
+		return NO;
+	}
+	
+	attribute = property_copyAttributeValue(property, "T");
+	char encoding = (attribute ? attribute[0] : '\0');
+	free(attribute);
+	
+	if((encoding == '\0') || !strchr("@BcCdfiIlLqQsS", encoding))
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Property type not supported. [property = '%@']", ClassName, JFStringFromPointer(self), name] tags:JFLoggerTagsError];
+		return NO;
+	}
+	
+	JFJSONFieldType type = field.type;
+	id defaultValue = field.defaultValue;
+	if((encoding != '@') && ((type != JFJSONFieldTypeNumber) || (defaultValue && ![defaultValue isKindOfClass:NSNumber.class])))
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Scalar properties can only be filled by number fields. [property = '%@']", ClassName, JFStringFromPointer(self), name] tags:JFLoggerTagsError];
+		return NO;
+	}
+	
+	JFJSONDecoder* decoder = field.decoder;
+	if(((type == JFJSONFieldTypeModel) || (type == JFJSONFieldTypeModelArray)) && !decoder)
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Missing decoder. [property = '%@']", ClassName, JFStringFromPointer(self), name] tags:JFLoggerTagsError];
+		return NO;
+	}
+	
+	// The entry doesn't retain its objects: they are retained by the field, which is retained by the decoder.
+	entry->decoder = decoder;
+	entry->defaultValue = defaultValue;
+	entry->encoding = encoding;
+	entry->implementation = class_getMethodImplementation(modelClass, setter);
+	entry->keyPath = field.keyPath;
+	entry->optional = field.isOptional;
+	entry->setter = setter;
+	entry->type = type;
+	
+	return YES;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDecoderSession
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// The schema entries of the decoder.
+	const JFJSONDecoderEntry* _entries;
+	
+	// The position of the key of each node inside the layout cached by its parent.
+	NSUInteger* _indexes;
+	
+	// The schema nodes of the decoder.
+	const JFJSONDecoderNode* _nodes;
+	
+	// The sessions of the decoders of the entries, created when first needed.
+	NSMutableDictionary<NSNumber*, JFJSONDecoderSession*>* _Nullable _sessions;
+	
+	// The last layout visited by each node (retained), or `NULL`.
+	const void* _Nullable * _shapes;
+}
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize decoder = _decoder;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (void)dealloc
+{
+	NSUInteger count = _decoder.nodesCount;
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		if(_shapes[index])
+			CFRelease(_shapes[index]);
+	}
+	free(_indexes);
+	free((void*)_shapes);
+}
+
+- (instancetype)initWithDecoder:(JFJSONDecoder*)decoder
+{
+	self = [super init];
+	
+	NSUInteger count = decoder.nodesCount;
+	
+	_decoder = decoder;
+	_entries = decoder.entries;
+	_indexes = calloc(count, sizeof(NSUInteger));
+	_nodes = decoder.nodes;
+	_shapes = calloc(count, sizeof(void*));
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Decoding
+// =================================================================================================
+
+- (NSArray* _Nullable)decodeArray:(id<JFJSONNode>)array error:(NSError* __autoreleasing _Nullable *)outError
+{
+	BOOL isTree = (JFJSONValueKindOf(array) == JFJSONValueKindArray);
+	NSUInteger count = array.count;
+	
+	NSMutableArray* retObj = [NSMutableArray arrayWithCapacity:count];
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		id<JFJSONValue> value = (isTree ? [(JFJSONArray*)array storedValueAtIndex:index] : [(JFJSONDocumentArray*)array valueAtIndex:index]);
+		
+		NSError* error = nil;
+		id model = nil;
+		if(JFJSONDecoderKindOf(value) == JFJSONValueKindObject)
+			model = [self decodeObject:(id<JFJSONNode>)value error:&error];
+		
+		if(!model)
+		{
+			if(outError)
+			{
+				JFErrorFactory* errorFactory = JFJSONDecoder.errorFactory;
+				if(error)
+					*outError = [errorFactory errorWithCode:error.code description:[NSString stringWithFormat:@"Failed to decode the element at index '%@'.", JFStringFromNSUInteger(index)] underlyingError:error];
+				else
+					*outError = [errorFactory errorWithCode:JFJSONDecoderErrorTypeMismatch description:[NSString stringWithFormat:@"The element at index '%@' is not an object.", JFStringFromNSUInteger(index)]];
+			}
+			return nil;
+		}
+		
+		[retObj addObject:model];
+	}
+	return [retObj copy];
+}
+
+- (id _Nullable)decodeObject:(id<JFJSONNode>)object error:(NSError* __autoreleasing _Nullable *)outError
+{
+	id retObj = [[self.decoder.modelClass alloc] init];
+	if(![self fillModel:retObj withNode:0 container:object error:outError])
+		return nil;
+	
+	return retObj;
+}
+
+- (BOOL)fillModel:(id)model withMissingNode:(NSUInteger)nodeIndex error:(NSError* __autoreleasing _Nullable *)outError
+{
+	const JFJSONDecoderNode* node = &_nodes[nodeIndex];
+	
+	for(NSUInteger index = node->firstEntry; index < node->firstEntry + node->entriesCount; index++)
+	{
+		if(![self fillModel:model withValue:nil entry:index error:outError])
+			return NO;
+	}
+	
+	for(NSUInteger index = node->firstChild; index < node->firstChild + node->childrenCount; index++)
+	{
+		if(![self fillModel:model withMissingNode:index error:outError])
+			return NO;
+	}
+	
+	return YES;
+}
+
+- (BOOL)fillModel:(id)model withNode:(NSUInteger)nodeIndex container:(id<JFJSONNode>)container error:(NSError* __autoreleasing _Nullable *)outError
+{
+	const JFJSONDecoderNode* node = &_nodes[nodeIndex];
+	NSUInteger firstChild = node->firstChild;
+	NSUInteger lastChild = firstChild + node->childrenCount;
+	
+	BOOL isTree = (JFJSONValueKindOf(container) == JFJSONValueKindObject);
+	JFJSONObjectShape* shape = (isTree ? ((JFJSONObject*)container).shape : nil);
+	if(shape && ((__bridge const void*)shape != _shapes[nodeIndex]))
+	{
+		// The layout is different from the one of the previous record: the positions of the keys are looked up again.
+		if(_shapes[nodeIndex])
+			CFRelease(_shapes[nodeIndex]);
+		_shapes[nodeIndex] = CFBridgingRetain(shape);
+		
+		for(NSUInteger index = firstChild; index < lastChild; index++)
+			_indexes[index] = [shape indexOfKey:_nodes[index].key];
+	}
+	
+	for(NSUInteger index = firstChild; index < lastChild; index++)
+	{
+		const JFJSONDecoderNode* child = &_nodes[index];
+		
+		id<JFJSONValue> value;
+		if(shape)
+		{
+			NSUInteger position = _indexes[index];
+			value = ((position == NSNotFound) ? nil : [(JFJSONObject*)container storedValueAtShapeIndex:position]);
+		}
+		else if(isTree)
+			value = [(JFJSONObject*)container storedValueForKey:child->key];
+		else
+			value = [(JFJSONDocumentObject*)container valueForKey:child->key];
+		
+		for(NSUInteger entry = child->firstEntry; entry < child->firstEntry + child->entriesCount; entry++)
+		{
+			if(![self fillModel:model withValue:value entry:entry error:outError])
+				return NO;
+		}
+		
+		if(child->childrenCount == 0)
+			continue;
+		
+		JFJSONValueKind kind = JFJSONDecoderKindOf(value);
+		if(kind == JFJSONValueKindObject)
+		{
+			if(![self fillModel:model withNode:index container:(id<JFJSONNode>)value error:outError])
+				return NO;
+		}
+		else if(!value || (kind == JFJSONValueKindNull))
+		{
+			if(![self fillModel:model withMissingNode:index error:outError])
+				return NO;
+		}
+		else
+		{
+			if(outError)
+				*outError = [JFJSONDecoder.errorFactory errorWithCode:JFJSONDecoderErrorTypeMismatch description:[NSString stringWithFormat:@"The value for key path '%@' is not an object.", child->path]];
+			return NO;
+		}
+	}
+	
+	return YES;
+}
+
+- (BOOL)fillModel:(id)model withValue:(id<JFJSONValue> _Nullable)value entry:(NSUInteger)entryIndex error:(NSError* __autoreleasing _Nullable *)outError
+{
+	const JFJSONDecoderEntry* entry = &_entries[entryIndex];
+	
+	JFJSONValueKind kind = JFJSONDecoderKindOf(value);
+	if(!value || (kind == JFJSONValueKindNull))
+	{
+		if(entry->defaultValue)
+		{
+			JFJSONDecoderSetValue(model, entry, entry->defaultValue);
+			return YES;
+		}
+		
+		if(entry->optional)
+			return YES;
+		
+		if(outError)
+			*outError = [JFJSONDecoder.errorFactory errorWithCode:JFJSONDecoderErrorMissingValue description:[NSString stringWithFormat:@"Missing value for key path '%@'.", entry->keyPath]];
+		return NO;
+	}
+	
+	JFJSONValueKind expectedKind;
+	switch(entry->type)
+	{
+		case JFJSONFieldTypeArray:
+		case JFJSONFieldTypeModelArray:
+			expectedKind = JFJSONValueKindArray;
+			break;
+		case JFJSONFieldTypeModel:
+		case JFJSONFieldTypeObject:
+			expectedKind = JFJSONValueKindObject;
+			break;
+		case JFJSONFieldTypeNumber:
+			expectedKind = JFJSONValueKindNumber;
+			break;
+		case JFJSONFieldTypeString:
+			expectedKind = JFJSONValueKindString;
+			break;
+		default:
+			expectedKind = kind;
+			break;
+	}
+	
+	if(kind != expectedKind)
+	{
+		if(outError)
+			*outError = [JFJSONDecoder.errorFactory errorWithCode:JFJSONDecoderErrorTypeMismatch description:[NSString stringWithFormat:@"The value for key path '%@' is not of the expected type.", entry->keyPath]];
+		return NO;
+	}
+	
+	id decodedValue;
+	switch(entry->type)
+	{
+		case JFJSONFieldTypeModel:
+		case JFJSONFieldTypeModelArray:
+		{
+			NSError* error = nil;
+			JFJSONDecoderSession* session = [self sessionForEntry:entryIndex];
+			if(entry->type == JFJSONFieldTypeModel)
+				decodedValue = [session decodeObject:(id<JFJSONNode>)value error:&error];
+			else
+				decodedValue = [session decodeArray:(id<JFJSONNode>)value error:&error];
+			
+			if(!decodedValue)
+			{
+				if(outError)
+					*outError = [JFJSONDecoder.errorFactory errorWithCode:error.code description:[NSString stringWithFormat:@"Failed to decode the value for key path '%@'.", entry->keyPath] underlyingError:error];
+				return NO;
+			}
+			break;
+		}
+		case JFJSONFieldTypeNumber:
+		case JFJSONFieldTypeString:
+			decodedValue = value;
+			break;
+		default:
+			decodedValue = JFJSONDecoderNodeValue(value);
+			break;
+	}
+	
+	JFJSONDecoderSetValue(model, entry, decodedValue);
+	return YES;
+}
+
+- (JFJSONDecoderSession*)sessionForEntry:(NSUInteger)entryIndex
+{
+	NSMutableDictionary<NSNumber*, JFJSONDecoderSession*>* sessions = _sessions;
+	if(!sessions)
+	{
+		sessions = [NSMutableDictionary<NSNumber*, JFJSONDecoderSession*> new];
+		_sessions = sessions;
+	}
+	
+	NSNumber* key = @(entryIndex);
+	JFJSONDecoderSession* retObj = sessions[key];
+	if(!retObj)
+	{
+		retObj = [[JFJSONDecoderSession alloc] initWithDecoder:(JFJSONDecoder*)_entries[entryIndex].decoder];
+		sessions[key] = retObj;
+	}
+	return retObj;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
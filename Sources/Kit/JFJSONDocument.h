@@ -0,0 +1,339 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFJSONArray.h>
+#import <JFKit/JFJSONNode.h>
+#import <JFKit/JFJSONObject.h>
+
+@class JFJSONDocumentArray;
+@class JFJSONDocumentObject;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * The `JFJSONDocument` class parses JSON data into a read-only tree stored in a single memory block owned by the document: the structure of the tree, its strings and its numbers are laid out contiguously, so that parsing performs a handful of allocations and releasing the document frees the whole tree at once.
+ * @discussion The nodes of the tree (instances of `JFJSONDocumentArray` and `JFJSONDocumentObject`) are lightweight views created only when accessed, and they keep the document alive; strings and numbers are created when read. Looking up a key scans the keys of the object, so documents are best suited to reading large payloads once or a few times; use `JFJSONObject` and `JFJSONArray` for content that needs to be changed or queried repeatedly by key.
+ * @warning Documents and their nodes are immutable and can be read concurrently.
+ */
+@interface JFJSONDocument : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * The root value of the document: either a node (`JFJSONDocumentArray` or `JFJSONDocumentObject`), or a scalar value.
+ */
+@property (strong, nonatomic, readonly) id<JFJSONValue> root;
+
+// =================================================================================================
+// MARK: Properties - Memory
+// =================================================================================================
+
+/**
+ * The size in bytes of the memory block holding the tree.
+ */
+@property (assign, nonatomic, readonly) NSUInteger size;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+/**
+ * A convenient constructor that parses the given JSON data into a new document.
+ * @param data The UTF-8 encoded JSON data.
+ * @return A new document, or `nil` if `data` does not contain valid JSON content.
+ */
++ (instancetype _Nullable)documentWithData:(NSData*)data;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes this instance by parsing the given JSON data.
+ * @param data The UTF-8 encoded JSON data.
+ * @return This instance, or `nil` if `data` does not contain valid JSON content.
+ */
+- (instancetype _Nullable)initWithData:(NSData*)data NS_DESIGNATED_INITIALIZER;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * The `JFJSONDocumentArray` class is a read-only view of an array stored in a JSON document.
+ * @discussion Initializing an instance with JSON data or string parses a new document and returns its root, if it is an array.
+ */
+@interface JFJSONDocumentArray : NSObject <JFJSONNode, NSCopying, NSFastEnumeration>
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * Converts the array to SDK native data objects and returns the result.
+ */
+@property (copy, nonatomic, readonly) NSArray<id<JFJSONConvertibleValue>>* arrayValue;
+
+/**
+ * The document containing the array.
+ */
+@property (strong, nonatomic, readonly) JFJSONDocument* document;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init NS_UNAVAILABLE;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+/**
+ * Returns the array at the given index.
+ * @param index The index of the value.
+ * @return The array at the given index, or `nil` if the value at the given index is not an array.
+ */
+- (JFJSONDocumentArray* _Nullable)arrayAtIndex:(NSUInteger)index;
+
+/**
+ * Checks whether the value at the given index is `null`.
+ * @param index The index of the value.
+ * @return `YES` if the value at the given index is `null`, `NO` otherwise.
+ */
+- (BOOL)isNullAtIndex:(NSUInteger)index;
+
+/**
+ * Returns the number at the given index.
+ * @param index The index of the value.
+ * @return The number at the given index, or `nil` if the value at the given index is not a number.
+ */
+- (NSNumber* _Nullable)numberAtIndex:(NSUInteger)index;
+
+/**
+ * Returns the object at the given index.
+ * @param index The index of the value.
+ * @return The object at the given index, or `nil` if the value at the given index is not an object.
+ */
+- (JFJSONDocumentObject* _Nullable)objectAtIndex:(NSUInteger)index;
+
+/**
+ * Returns the string at the given index.
+ * @param index The index of the value.
+ * @return The string at the given index, or `nil` if the value at the given index is not a string.
+ */
+- (NSString* _Nullable)stringAtIndex:(NSUInteger)index;
+
+/**
+ * Returns the value at the given index.
+ * @param index The index of the value.
+ * @return The value at the given index.
+ * @warning Raises an `NSRangeException` if `index` is out of bounds.
+ */
+- (id<JFJSONValue>)valueAtIndex:(NSUInteger)index;
+
+// =================================================================================================
+// MARK: Methods - Enumeration
+// =================================================================================================
+
+/**
+ * Executes a given block using each value in the array, starting with the first one and continuing through the array to the last one.
+ * @param block The block to apply to the values in the array.
+ */
+- (void)enumerateValuesUsingBlock:(JFJSONArrayEnumerationBlock)block;
+
+/**
+ * Executes a given block using each value in the array.
+ * @param options A bit mask that specifies the options for the enumeration; concurrent enumeration is not supported and is performed serially.
+ * @param block The block to apply to the values in the array.
+ */
+- (void)enumerateValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONArrayEnumerationBlock)block;
+
+/**
+ * Returns an enumerator object that lets you access each value in the array.
+ * @return An enumerator object that lets you access each value in the array.
+ */
+- (NSEnumerator<id<JFJSONValue>>*)valueEnumerator;
+
+// =================================================================================================
+// MARK: Methods - Subscripting
+// =================================================================================================
+
+/**
+ * Returns the value at the given index.
+ * @param index The index of the value.
+ * @return The value at the given index.
+ */
+- (id<JFJSONValue>)objectAtIndexedSubscript:(NSUInteger)index;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * The `JFJSONDocumentObject` class is a read-only view of an object stored in a JSON document.
+ * @discussion Initializing an instance with JSON data or string parses a new document and returns its root, if it is an object.
+ */
+@interface JFJSONDocumentObject : NSObject <JFJSONNode, NSCopying, NSFastEnumeration>
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * Returns all the keys of the object, in document order.
+ */
+@property (copy, nonatomic, readonly) NSArray<NSString*>* allKeys;
+
+/**
+ * Returns all the values of the object, in document order.
+ */
+@property (copy, nonatomic, readonly) NSArray<id<JFJSONValue>>* allValues;
+
+/**
+ * Converts the object to SDK native data objects and returns the result.
+ */
+@property (copy, nonatomic, readonly) NSDictionary<NSString*, id<JFJSONConvertibleValue>>* dictionaryValue;
+
+/**
+ * The document containing the object.
+ */
+@property (strong, nonatomic, readonly) JFJSONDocument* document;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init NS_UNAVAILABLE;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+/**
+ * Returns the array associated with the given key.
+ * @param key The key of the value.
+ * @return The array associated with the given key, or `nil` if the value is missing or is not an array.
+ */
+- (JFJSONDocumentArray* _Nullable)arrayForKey:(NSString*)key;
+
+/**
+ * Checks whether the object contains a value associated with the given key.
+ * @param key The key of the value.
+ * @return `YES` if the object contains a value associated with the given key, `NO` otherwise.
+ */
+- (BOOL)hasValueForKey:(NSString*)key;
+
+/**
+ * Checks whether the value associated with the given key is `null`.
+ * @param key The key of the value.
+ * @return `YES` if the value associated with the given key is `null`, `NO` otherwise.
+ */
+- (BOOL)isNullForKey:(NSString*)key;
+
+/**
+ * Returns the number associated with the given key.
+ * @param key The key of the value.
+ * @return The number associated with the given key, or `nil` if the value is missing or is not a number.
+ */
+- (NSNumber* _Nullable)numberForKey:(NSString*)key;
+
+/**
+ * Returns the object associated with the given key.
+ * @param key The key of the value.
+ * @return The object associated with the given key, or `nil` if the value is missing or is not an object.
+ */
+- (JFJSONDocumentObject* _Nullable)objectForKey:(NSString*)key NS_SWIFT_NAME(object(forKey:));
+
+/**
+ * Returns the string associated with the given key.
+ * @param key The key of the value.
+ * @return The string associated with the given key, or `nil` if the value is missing or is not a string.
+ */
+- (NSString* _Nullable)stringForKey:(NSString*)key;
+
+/**
+ * Returns the value associated with the given key.
+ * @param key The key of the value.
+ * @return The value associated with the given key, or `nil` if the object does not contain the given key.
+ */
+- (id<JFJSONValue> _Nullable)valueForKey:(NSString*)key;
+
+// =================================================================================================
+// MARK: Methods - Enumeration
+// =================================================================================================
+
+/**
+ * Applies a given block to the entries of the object, in document order.
+ * @param block The block to apply to the entries of the object.
+ */
+- (void)enumerateKeysAndValuesUsingBlock:(JFJSONObjectEnumerationBlock)block;
+
+/**
+ * Applies a given block to the entries of the object.
+ * @param options A bit mask that specifies the options for the enumeration; concurrent enumeration is not supported and is performed serially.
+ * @param block The block to apply to the entries of the object.
+ */
+- (void)enumerateKeysAndValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONObjectEnumerationBlock)block;
+
+/**
+ * Returns an enumerator object that lets you access each key of the object.
+ * @return An enumerator object that lets you access each key of the object.
+ */
+- (NSEnumerator<NSString*>*)keyEnumerator;
+
+/**
+ * Returns an enumerator object that lets you access each value of the object.
+ * @return An enumerator object that lets you access each value of the object.
+ */
+- (NSEnumerator<id<JFJSONValue>>*)valueEnumerator;
+
+// =================================================================================================
+// MARK: Methods - Subscripting
+// =================================================================================================
+
+/**
+ * Returns the value associated with the given key.
+ * @param key The key of the value.
+ * @return The value associated with the given key, or `nil` if the object does not contain the given key.
+ */
+- (id<JFJSONValue> _Nullable)objectForKeyedSubscript:(NSString*)key;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,1579 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONDocument.h"
+
+#import "JFJSONSerializer.h"
+#import "JFKitLogger.h"
+#import "JFNumberConversion.h"
+#import "JFShortcuts.h"
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+// The maximum nesting level of arrays and objects accepted by the parser.
+static const NSUInteger JFJSONDocumentMaxDepth = 512;
+
+// The mask selecting the payload of a tape word; the tag is stored in the top byte.
+static const uint64_t JFJSONDocumentPayloadMask = 0x00FFFFFFFFFFFFFFULL;
+
+// The number of bits the tag is shifted by inside a tape word.
+static const unsigned int JFJSONDocumentTagShift = 56;
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * The kinds of values stored in the tape of a document.
+ * Arrays and objects take two words: the first holds the index of the word following the container, the second holds the number of elements (or entries, each made of a key followed by its value); their content follows.
+ * Strings take one word holding the offset of their bytes inside the strings area. Numbers take two words, the second holding their bits. The other values take one word.
+ */
+typedef NS_ENUM(UInt8, JFJSONDocumentTag)
+{
+	/**
+	 * An array.
+	 */
+	JFJSONDocumentTagArray = 1,
+	
+	/**
+	 * A floating point number.
+	 */
+	JFJSONDocumentTagDouble,
+	
+	/**
+	 * The literal `false`.
+	 */
+	JFJSONDocumentTagFalse,
+	
+	/**
+	 * An integer number that fits in 64 bits.
+	 */
+	JFJSONDocumentTagInteger,
+	
+	/**
+	 * The literal `null`.
+	 */
+	JFJSONDocumentTagNull,
+	
+	/**
+	 * An object.
+	 */
+	JFJSONDocumentTagObject,
+	
+	/**
+	 * A string.
+	 */
+	JFJSONDocumentTagString,
+	
+	/**
+	 * The literal `true`.
+	 */
+	JFJSONDocumentTagTrue,
+};
+
+/**
+ * The state of the parser while building the tape and the strings area of a document.
+ */
+typedef struct
+{
+	/**
+	 * The JSON data being parsed.
+	 */
+	const uint8_t* bytes;
+	
+	/**
+	 * The current nesting level.
+	 */
+	NSUInteger depth;
+	
+	/**
+	 * The length of the JSON data.
+	 */
+	NSUInteger length;
+	
+	/**
+	 * The position of the next byte to parse.
+	 */
+	NSUInteger position;
+	
+	/**
+	 * The strings area: each string is stored as its length (4 bytes), followed by its UTF-8 bytes and by a terminating null byte.
+	 */
+	uint8_t* _Nullable strings;
+	
+	/**
+	 * The allocated size of the strings area.
+	 */
+	NSUInteger stringsCapacity;
+	
+	/**
+	 * The used size of the strings area.
+	 */
+	NSUInteger stringsLength;
+	
+	/**
+	 * The words describing the tree.
+	 */
+	uint64_t* _Nullable tape;
+	
+	/**
+	 * The allocated number of words of the tape.
+	 */
+	NSUInteger tapeCapacity;
+	
+	/**
+	 * The used number of words of the tape.
+	 */
+	NSUInteger tapeCount;
+} JFJSONDocumentParser;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+static id<JFJSONConvertibleValue> JFJSONDocumentConvertibleValue(const uint64_t* tape, const char* strings, NSUInteger index);
+static BOOL JFJSONDocumentParseValue(JFJSONDocumentParser* parser);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+static inline NSUInteger JFJSONDocumentPayload(const uint64_t* tape, NSUInteger index)
+{
+	return (NSUInteger)(tape[index] & JFJSONDocumentPayloadMask);
+}
+
+static inline JFJSONDocumentTag JFJSONDocumentTagAt(const uint64_t* tape, NSUInteger index)
+{
+	return (JFJSONDocumentTag)(tape[index] >> JFJSONDocumentTagShift);
+}
+
+static inline uint64_t JFJSONDocumentWord(JFJSONDocumentTag tag, uint64_t payload)
+{
+	return (((uint64_t)tag << JFJSONDocumentTagShift) | payload);
+}
+
+static inline NSUInteger JFJSONDocumentNextIndex(const uint64_t* tape, NSUInteger index)
+{
+	switch(JFJSONDocumentTagAt(tape, index))
+	{
+		case JFJSONDocumentTagArray:
+		case JFJSONDocumentTagObject:
+			return JFJSONDocumentPayload(tape, index);
+		case JFJSONDocumentTagDouble:
+		case JFJSONDocumentTagInteger:
+			return index + 2;
+		default:
+			return index + 1;
+	}
+}
+
+static NSNumber* JFJSONDocumentNumber(const uint64_t* tape, NSUInteger index)
+{
+	uint64_t bits = tape[index + 1];
+	if(JFJSONDocumentTagAt(tape, index) == JFJSONDocumentTagInteger)
+		return [NSNumber numberWithLongLong:(int64_t)bits];
+	
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return [NSNumber numberWithDouble:value];
+}
+
+static NSString* JFJSONDocumentString(const char* strings, NSUInteger offset)
+{
+	uint32_t length;
+	memcpy(&length, strings + offset, sizeof(length));
+	return ([[NSString alloc] initWithBytes:(strings + offset + sizeof(length)) length:length encoding:NSUTF8StringEncoding] ?: @"");
+}
+
+static BOOL JFJSONDocumentStringEquals(const char* strings, NSUInteger offset, const char* bytes, size_t length)
+{
+	uint32_t storedLength;
+	memcpy(&storedLength, strings + offset, sizeof(storedLength));
+	return ((storedLength == length) && (memcmp(strings + offset + sizeof(storedLength), bytes, length) == 0));
+}
+
+static id<JFJSONValue> JFJSONDocumentScalar(const uint64_t* tape, const char* strings, NSUInteger index)
+{
+	switch(JFJSONDocumentTagAt(tape, index))
+	{
+		case JFJSONDocumentTagDouble:
+		case JFJSONDocumentTagInteger:
+			return JFJSONDocumentNumber(tape, index);
+		case JFJSONDocumentTagFalse:
+			return @NO;
+		case JFJSONDocumentTagString:
+			return JFJSONDocumentString(strings, JFJSONDocumentPayload(tape, index));
+		case JFJSONDocumentTagTrue:
+			return @YES;
+		default:
+			return [NSNull null];
+	}
+}
+
+static id<JFJSONConvertibleValue> JFJSONDocumentConvertibleValue(const uint64_t* tape, const char* strings, NSUInteger index)
+{
+	JFJSONDocumentTag tag = JFJSONDocumentTagAt(tape, index);
+	if(tag == JFJSONDocumentTagArray)
+	{
+		NSUInteger count = (NSUInteger)tape[index + 1];
+		NSMutableArray<id<JFJSONConvertibleValue>>* retObj = [[NSMutableArray<id<JFJSONConvertibleValue>> alloc] initWithCapacity:count];
+		for(NSUInteger child = index + 2, offset = 0; offset < count; offset++, child = JFJSONDocumentNextIndex(tape, child))
+			[retObj addObject:JFJSONDocumentConvertibleValue(tape, strings, child)];
+		return retObj;
+	}
+	
+	if(tag == JFJSONDocumentTagObject)
+	{
+		// When a key is repeated, the first entry wins, as it does when looking up the key.
+		NSUInteger count = (NSUInteger)tape[index + 1];
+		NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>>* retObj = [[NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>> alloc] initWithCapacity:count];
+		for(NSUInteger child = index + 2, offset = 0; offset < count; offset++)
+		{
+			NSString* key = JFJSONDocumentString(strings, JFJSONDocumentPayload(tape, child));
+			child++;
+			if(![retObj objectForKey:key])
+				[retObj setObject:JFJSONDocumentConvertibleValue(tape, strings, child) forKey:key];
+			child = JFJSONDocumentNextIndex(tape, child);
+		}
+		return retObj;
+	}
+	
+	return JFJSONDocumentScalar(tape, strings, index);
+}
+
+static NSUInteger JFJSONDocumentFindKey(const uint64_t* tape, const char* strings, NSUInteger index, NSString* key)
+{
+	const char* bytes = CFStringGetCStringPtr((__bridge CFStringRef)key, kCFStringEncodingUTF8);
+	if(!bytes)
+		bytes = key.UTF8String;
+	if(!bytes)
+		return NSNotFound;
+	
+	size_t length = strlen(bytes);
+	NSUInteger count = (NSUInteger)tape[index + 1];
+	for(NSUInteger child = index + 2, offset = 0; offset < count; offset++)
+	{
+		if(JFJSONDocumentStringEquals(strings, JFJSONDocumentPayload(tape, child), bytes, length))
+			return child + 1;
+		child = JFJSONDocumentNextIndex(tape, child + 1);
+	}
+	return NSNotFound;
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+static BOOL JFJSONDocumentParserAppend(JFJSONDocumentParser* parser, uint64_t word)
+{
+	if(parser->tapeCount == parser->tapeCapacity)
+	{
+		NSUInteger capacity = MAX(parser->tapeCapacity * 2, (NSUInteger)64);
+		uint64_t* tape = realloc(parser->tape, capacity * sizeof(uint64_t));
+		if(!tape)
+			return NO;
+		parser->tape = tape;
+		parser->tapeCapacity = capacity;
+	}
+	parser->tape[parser->tapeCount++] = word;
+	return YES;
+}
+
+static BOOL JFJSONDocumentParserReserveStrings(JFJSONDocumentParser* parser, NSUInteger length)
+{
+	if(parser->stringsCapacity - parser->stringsLength >= length)
+		return YES;
+	
+	NSUInteger capacity = MAX(MAX(parser->stringsCapacity * 2, parser->stringsLength + length), (NSUInteger)256);
+	uint8_t* strings = realloc(parser->strings, capacity);
+	if(!strings)
+		return NO;
+	parser->strings = strings;
+	parser->stringsCapacity = capacity;
+	return YES;
+}
+
+static void JFJSONDocumentParserSkipWhitespace(JFJSONDocumentParser* parser)
+{
+	const uint8_t* bytes = parser->bytes;
+	NSUInteger length = parser->length;
+	NSUInteger position = parser->position;
+	while((position < length) && ((bytes[position] == ' ') || (bytes[position] == '\n') || (bytes[position] == '\r') || (bytes[position] == '\t')))
+		position++;
+	parser->position = position;
+}
+
+static NSUInteger JFJSONDocumentUTF8SequenceLength(const uint8_t* bytes, NSUInteger length)
+{
+	// Returns the length of the well formed UTF-8 sequence at the beginning of the given bytes, or `0` if it is malformed.
+	uint8_t lead = bytes[0];
+	NSUInteger retVal;
+	uint8_t lower = 0x80;
+	uint8_t upper = 0xBF;
+	if((lead >= 0xC2) && (lead <= 0xDF))
+		retVal = 2;
+	else if((lead >= 0xE0) && (lead <= 0xEF))
+	{
+		retVal = 3;
+		if(lead == 0xE0)
+			lower = 0xA0;
+		else if(lead == 0xED)
+			upper = 0x9F;
+	}
+	else if((lead >= 0xF0) && (lead <= 0xF4))
+	{
+		retVal = 4;
+		if(lead == 0xF0)
+			lower = 0x90;
+		else if(lead == 0xF4)
+			upper = 0x8F;
+	}
+	else
+		return 0;
+	
+	if(length < retVal)
+		return 0;
+	
+	if((bytes[1] < lower) || (bytes[1] > upper))
+		return 0;
+	
+	for(NSUInteger index = 2; index < retVal; index++)
+	{
+		if((bytes[index] & 0xC0) != 0x80)
+			return 0;
+	}
+	return retVal;
+}
+
+static BOOL JFJSONDocumentParseHex(const uint8_t* bytes, uint32_t* value)
+{
+	uint32_t retVal = 0;
+	for(NSUInteger index = 0; index < 4; index++)
+	{
+		uint8_t byte = bytes[index];
+		retVal <<= 4;
+		if((byte >= '0') && (byte <= '9'))
+			retVal |= (uint32_t)(byte - '0');
+		else if((byte >= 'a') && (byte <= 'f'))
+			retVal |= (uint32_t)(byte - 'a' + 10);
+		else if((byte >= 'A') && (byte <= 'F'))
+			retVal |= (uint32_t)(byte - 'A' + 10);
+		else
+			return NO;
+	}
+	*value = retVal;
+	return YES;
+}
+
+static BOOL JFJSONDocumentParseString(JFJSONDocumentParser* parser)
+{
+	const uint8_t* bytes = parser->bytes;
+	NSUInteger length = parser->length;
+	NSUInteger start = parser->position + 1;
+	
+	// Finds the closing quote first: the decoded string is never longer than its escaped form, so its room can be reserved once.
+	NSUInteger end = start;
+	while((end < length) && (bytes[end] != '"'))
+		end += ((bytes[end] == '\\') ? 2 : 1);
+	if(end >= length)
+		return NO;
+	
+	uint32_t storedLength = 0;
+	if((end - start > UINT32_MAX) || !JFJSONDocumentParserReserveStrings(parser, sizeof(storedLength) + (end - start) + 1))
+		return NO;
+	
+	NSUInteger offset = parser->stringsLength;
+	uint8_t* destination = parser->strings + offset + sizeof(storedLength);
+	NSUInteger written = 0;
+	for(NSUInteger position = start; position < end;)
+	{
+		uint8_t byte = bytes[position];
+		if(byte < 0x20)
+			return NO;
+		
+		if(byte < 0x80)
+		{
+			if(byte != '\\')
+			{
+				destination[written++] = byte;
+				position++;
+				continue;
+			}
+			
+			uint8_t escape = bytes[position + 1];
+			position += 2;
+			switch(escape)
+			{
+				case '"':
+				case '\\':
+				case '/':
+					destination[written++] = escape;
+					continue;
+				case 'b':
+					destination[written++] = '\b';
+					continue;
+				case 'f':
+					destination[written++] = '\f';
+					continue;
+				case 'n':
+					destination[written++] = '\n';
+					continue;
+				case 'r':
+					destination[written++] = '\r';
+					continue;
+				case 't':
+					destination[written++] = '\t';
+					continue;
+				case 'u':
+					break;
+				default:
+					return NO;
+			}
+			
+			uint32_t codePoint;
+			if((position + 4 > end) || !JFJSONDocumentParseHex(bytes + position, &codePoint))
+				return NO;
+			position += 4;
+			
+			if((codePoint >= 0xD800) && (codePoint <= 0xDBFF))
+			{
+				uint32_t lowSurrogate;
+				if((position + 6 > end) || (bytes[position] != '\\') || (bytes[position + 1] != 'u') || !JFJSONDocumentParseHex(bytes + position + 2, &lowSurrogate) || (lowSurrogate < 0xDC00) || (lowSurrogate > 0xDFFF))
+					return NO;
+				position += 6;
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+			}
+			else if((codePoint >= 0xDC00) && (codePoint <= 0xDFFF))
+				return NO;
+			
+			if(codePoint < 0x80)
+				destination[written++] = (uint8_t)codePoint;
+			else if(codePoint < 0x800)
+			{
+				destination[written++] = (uint8_t)(0xC0 | (codePoint >> 6));
+				destination[written++] = (uint8_t)(0x80 | (codePoint & 0x3F));
+			}
+			else if(codePoint < 0x10000)
+			{
+				destination[written++] = (uint8_t)(0xE0 | (codePoint >> 12));
+				destination[written++] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+				destination[written++] = (uint8_t)(0x80 | (codePoint & 0x3F));
+			}
+			else
+			{
+				destination[written++] = (uint8_t)(0xF0 | (codePoint >> 18));
+				destination[written++] = (uint8_t)(0x80 | ((codePoint >> 12) & 0x3F));
+				destination[written++] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+				destination[written++] = (uint8_t)(0x80 | (codePoint & 0x3F));
+			}
+			continue;
+		}
+		
+		NSUInteger sequenceLength = JFJSONDocumentUTF8SequenceLength(bytes + position, end - position);
+		if(sequenceLength == 0)
+			return NO;
+		memcpy(destination + written, bytes + position, sequenceLength);
+		written += sequenceLength;
+		position += sequenceLength;
+	}
+	destination[written] = 0;
+	
+	storedLength = (uint32_t)written;
+	memcpy(parser->strings + offset, &storedLength, sizeof(storedLength));
+	parser->stringsLength = offset + sizeof(storedLength) + written + 1;
+	parser->position = end + 1;
+	
+	return JFJSONDocumentParserAppend(parser, JFJSONDocumentWord(JFJSONDocumentTagString, offset));
+}
+
+static BOOL JFJSONDocumentParseNumber(JFJSONDocumentParser* parser)
+{
+	const uint8_t* bytes = parser->bytes;
+	NSUInteger length = parser->length;
+	NSUInteger start = parser->position;
+	NSUInteger position = start;
+	
+	BOOL isNegative = ((position < length) && (bytes[position] == '-'));
+	if(isNegative)
+		position++;
+	
+	if((position >= length) || (bytes[position] < '0') || (bytes[position] > '9'))
+		return NO;
+	
+	// The integer part is accumulated while validating it; it's only used if the number has neither a fraction nor an exponent and fits in 64 bits.
+	uint64_t magnitude = 0;
+	BOOL overflows = NO;
+	if(bytes[position] == '0')
+		position++;
+	else
+	{
+		while((position < length) && (bytes[position] >= '0') && (bytes[position] <= '9'))
+		{
+			uint64_t digit = (uint64_t)(bytes[position] - '0');
+			if(magnitude > (UINT64_MAX - digit) / 10)
+				overflows = YES;
+			else
+				magnitude = magnitude * 10 + digit;
+			position++;
+		}
+	}
+	
+	BOOL isInteger = YES;
+	if((position < length) && (bytes[position] == '.'))
+	{
+		isInteger = NO;
+		position++;
+		NSUInteger digits = position;
+		while((position < length) && (bytes[position] >= '0') && (bytes[position] <= '9'))
+			position++;
+		if(position == digits)
+			return NO;
+	}
+	
+	if((position < length) && ((bytes[position] == 'e') || (bytes[position] == 'E')))
+	{
+		isInteger = NO;
+		position++;
+		if((position < length) && ((bytes[position] == '+') || (bytes[position] == '-')))
+			position++;
+		NSUInteger digits = position;
+		while((position < length) && (bytes[position] >= '0') && (bytes[position] <= '9'))
+			position++;
+		if(position == digits)
+			return NO;
+	}
+	parser->position = position;
+	
+	uint64_t limit = (isNegative ? ((uint64_t)INT64_MAX + 1) : (uint64_t)INT64_MAX);
+	if(isInteger && !overflows && (magnitude <= limit))
+	{
+		uint64_t bits = (isNegative ? (0 - magnitude) : magnitude);
+		return (JFJSONDocumentParserAppend(parser, JFJSONDocumentWord(JFJSONDocumentTagInteger, 0)) && JFJSONDocumentParserAppend(parser, bits));
+	}
+	
+	double value;
+	if(!JFNumberConversionParseDouble((const char*)(bytes + start), position - start, &value))
+		return NO;
+	
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return (JFJSONDocumentParserAppend(parser, JFJSONDocumentWord(JFJSONDocumentTagDouble, 0)) && JFJSONDocumentParserAppend(parser, bits));
+}
+
+static BOOL JFJSONDocumentParseLiteral(JFJSONDocumentParser* parser, const char* literal, JFJSONDocumentTag tag)
+{
+	size_t length = strlen(literal);
+	if((parser->length - parser->position < length) || (memcmp(parser->bytes + parser->position, literal, length) != 0))
+		return NO;
+	
+	parser->position += length;
+	return JFJSONDocumentParserAppend(parser, JFJSONDocumentWord(tag, 0));
+}
+
+static BOOL JFJSONDocumentParseContainer(JFJSONDocumentParser* parser, BOOL isObject)
+{
+	if(++parser->depth > JFJSONDocumentMaxDepth)
+		return NO;
+	
+	// The header is patched once the container is closed: the tape index following the container is only known at that point.
+	NSUInteger index = parser->tapeCount;
+	if(!JFJSONDocumentParserAppend(parser, 0) || !JFJSONDocumentParserAppend(parser, 0))
+		return NO;
+	
+	uint8_t closing = (isObject ? '}' : ']');
+	parser->position++;
+	JFJSONDocumentParserSkipWhitespace(parser);
+	
+	uint64_t count = 0;
+	if((parser->position < parser->length) && (parser->bytes[parser->position] == closing))
+		parser->position++;
+	else
+	{
+		while(YES)
+		{
+			if(isObject)
+			{
+				if((parser->position >= parser->length) || (parser->bytes[parser->position] != '"') || !JFJSONDocumentParseString(parser))
+					return NO;
+				
+				JFJSONDocumentParserSkipWhitespace(parser);
+				if((parser->position >= parser->length) || (parser->bytes[parser->position] != ':'))
+					return NO;
+				parser->position++;
+				JFJSONDocumentParserSkipWhitespace(parser);
+			}
+			
+			if(!JFJSONDocumentParseValue(parser))
+				return NO;
+			count++;
+			
+			JFJSONDocumentParserSkipWhitespace(parser);
+			if(parser->position >= parser->length)
+				return NO;
+			
+			uint8_t byte = parser->bytes[parser->position++];
+			if(byte == closing)
+				break;
+			if(byte != ',')
+				return NO;
+			JFJSONDocumentParserSkipWhitespace(parser);
+		}
+	}
+	
+	parser->tape[index] = JFJSONDocumentWord((isObject ? JFJSONDocumentTagObject : JFJSONDocumentTagArray), parser->tapeCount);
+	parser->tape[index + 1] = count;
+	parser->depth--;
+	return YES;
+}
+
+static BOOL JFJSONDocumentParseValue(JFJSONDocumentParser* parser)
+{
+	if(parser->position >= parser->length)
+		return NO;
+	
+	switch(parser->bytes[parser->position])
+	{
+		case '"':
+			return JFJSONDocumentParseString(parser);
+		case '[':
+			return JFJSONDocumentParseContainer(parser, NO);
+		case '{':
+			return JFJSONDocumentParseContainer(parser, YES);
+		case 'f':
+			return JFJSONDocumentParseLiteral(parser, "false", JFJSONDocumentTagFalse);
+		case 'n':
+			return JFJSONDocumentParseLiteral(parser, "null", JFJSONDocumentTagNull);
+		case 't':
+			return JFJSONDocumentParseLiteral(parser, "true", JFJSONDocumentTagTrue);
+		default:
+			return JFJSONDocumentParseNumber(parser);
+	}
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONDocument (/* Private */)
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@property (assign, nonatomic, readonly) const char* strings;
+@property (assign, nonatomic, readonly) const uint64_t* tape;
+
+// =================================================================================================
+// MARK: Properties - Serialization
+// =================================================================================================
+
+@property (class, strong, nonatomic, readonly, nullable) id<JFJSONSerializationAdapter> defaultSerializer;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (id<JFJSONValue>)valueAtIndex:(NSUInteger)index;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONDocumentArray (/* Private */)
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithDocument:(JFJSONDocument*)document index:(NSUInteger)index;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (NSUInteger)tapeIndexAtIndex:(NSUInteger)index;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONDocumentObject (/* Private */)
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithDocument:(JFJSONDocument*)document index:(NSUInteger)index;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * An enumerator walking the children of a container stored in a document.
+ */
+@interface JFJSONDocumentEnumerator : NSEnumerator
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithDocument:(JFJSONDocument*)document index:(NSUInteger)index keys:(BOOL)keys;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDocument
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// The memory block holding the tape, immediately followed by the strings area; freeing it releases the whole tree.
+	void* _block;
+}
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize strings = _strings;
+@synthesize tape = _tape;
+
+// =================================================================================================
+// MARK: Properties - Memory
+// =================================================================================================
+
+@synthesize size = _size;
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Data
+// =================================================================================================
+
+- (id<JFJSONValue>)root
+{
+	return [self valueAtIndex:0];
+}
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Serialization
+// =================================================================================================
+
++ (id<JFJSONSerializationAdapter> _Nullable)defaultSerializer
+{
+	static id<JFJSONSerializationAdapter> retObj = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		if(@available(iOS 8.0, macOS 10.7, *))
+			retObj = [JFJSONSerializer new];
+	});
+	return retObj;
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
++ (instancetype _Nullable)documentWithData:(NSData*)data
+{
+	return [[self alloc] initWithData:data];
+}
+
+- (instancetype _Nullable)initWithData:(NSData*)data
+{
+	self = [super init];
+	
+	JFJSONDocumentParser parser = {0};
+	parser.bytes = data.bytes;
+	parser.length = data.length;
+	
+	// Skips the byte order mark, if any.
+	if((parser.length >= 3) && (memcmp(parser.bytes, "\xEF\xBB\xBF", 3) == 0))
+		parser.position = 3;
+	
+	JFJSONDocumentParserSkipWhitespace(&parser);
+	BOOL succeeded = JFJSONDocumentParseValue(&parser);
+	if(succeeded)
+	{
+		JFJSONDocumentParserSkipWhitespace(&parser);
+		succeeded = (parser.position == parser.length);
+	}
+	
+	// The strings area is appended to the tape, so that the whole tree lives in a single memory block.
+	NSUInteger tapeSize = parser.tapeCount * sizeof(uint64_t);
+	void* block = (succeeded ? realloc(parser.tape, tapeSize + parser.stringsLength) : NULL);
+	if(!block)
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to parse JSON data. [position = '%@']", ClassName, JFStringFromPointer(self), JFStringFromNSUInteger(parser.position)] tags:JFLoggerTagsError];
+		free(parser.strings);
+		free(parser.tape);
+		return nil;
+	}
+	
+	if(parser.stringsLength > 0)
+		memcpy((uint8_t*)block + tapeSize, parser.strings, parser.stringsLength);
+	free(parser.strings);
+	
+	_block = block;
+	_size = tapeSize + parser.stringsLength;
+	_strings = (const char*)block + tapeSize;
+	_tape = block;
+	
+	return self;
+}
+
+- (void)dealloc
+{
+	free(_block);
+}
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (id<JFJSONValue>)valueAtIndex:(NSUInteger)index
+{
+	switch(JFJSONDocumentTagAt(self.tape, index))
+	{
+		case JFJSONDocumentTagArray:
+			return [[JFJSONDocumentArray alloc] initWithDocument:self index:index];
+		case JFJSONDocumentTagObject:
+			return [[JFJSONDocumentObject alloc] initWithDocument:self index:index];
+		default:
+			return JFJSONDocumentScalar(self.tape, self.strings, index);
+	}
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDocumentArray
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// The number of elements of the array.
+	NSUInteger _count;
+	
+	// The tape index of the array.
+	NSUInteger _index;
+	
+	// The tape indexes of the elements, built the first time an element is accessed by index; elements have variable width, so they can't be located without walking the array.
+	NSUInteger* _Nullable _offsets;
+	
+	// The strings area of the document.
+	const char* _strings;
+	
+	// The tape of the document.
+	const uint64_t* _tape;
+}
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize document = _document;
+
+// =================================================================================================
+// MARK: Properties - Serialization
+// =================================================================================================
+
+@synthesize serializer = _serializer;
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Data
+// =================================================================================================
+
+- (NSArray<id<JFJSONConvertibleValue>>*)arrayValue
+{
+	return (NSArray<id<JFJSONConvertibleValue>>*)JFJSONDocumentConvertibleValue(_tape, _strings, _index);
+}
+
+- (NSUInteger)count
+{
+	return _count;
+}
+
+- (NSData* _Nullable)dataValue
+{
+	return [self.serializer dataFromArray:self.arrayValue];
+}
+
+- (NSString* _Nullable)stringValue
+{
+	return [self.serializer stringFromArray:self.arrayValue];
+}
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Serialization
+// =================================================================================================
+
+- (id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	@synchronized(self)
+	{
+		return (_serializer ?: JFJSONDocument.defaultSerializer);
+	}
+}
+
+- (void)setSerializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	@synchronized(self)
+	{
+		_serializer = serializer;
+	}
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithDocument:(JFJSONDocument*)document index:(NSUInteger)index
+{
+	self = [super init];
+	
+	_document = document;
+	_index = index;
+	_strings = document.strings;
+	_tape = document.tape;
+	_count = (NSUInteger)_tape[index + 1];
+	
+	return self;
+}
+
+- (instancetype _Nullable)initWithData:(NSData*)data serializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	// The data is always parsed into a new document; the serializer is only used to convert the array back to JSON.
+	JFJSONDocument* document = [JFJSONDocument documentWithData:data];
+	if(!document || (JFJSONDocumentTagAt(document.tape, 0) != JFJSONDocumentTagArray))
+		return nil;
+	
+	self = [self initWithDocument:document index:0];
+	_serializer = serializer;
+	return self;
+}
+
+- (instancetype _Nullable)initWithString:(NSString*)string serializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	NSData* data = [string dataUsingEncoding:NSUTF8StringEncoding];
+	return (data ? [self initWithData:data serializer:serializer] : nil);
+}
+
+- (void)dealloc
+{
+	free(_offsets);
+}
+
+// =================================================================================================
+// MARK: Methods - Comparison
+// =================================================================================================
+
+- (NSUInteger)hash
+{
+	return _count;
+}
+
+- (BOOL)isEqual:(id _Nullable)object
+{
+	if(![object isKindOfClass:JFJSONDocumentArray.class])
+		return NO;
+	
+	JFJSONDocumentArray* other = object;
+	if((other->_tape == _tape) && (other->_index == _index))
+		return YES;
+	
+	return ((other->_count == _count) && [self.arrayValue isEqualToArray:other.arrayValue]);
+}
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (JFJSONDocumentArray* _Nullable)arrayAtIndex:(NSUInteger)index
+{
+	NSUInteger tapeIndex = [self tapeIndexAtIndex:index];
+	if((tapeIndex == NSNotFound) || (JFJSONDocumentTagAt(_tape, tapeIndex) != JFJSONDocumentTagArray))
+		return nil;
+	
+	return [[JFJSONDocumentArray alloc] initWithDocument:self.document index:tapeIndex];
+}
+
+- (BOOL)isNullAtIndex:(NSUInteger)index
+{
+	NSUInteger tapeIndex = [self tapeIndexAtIndex:index];
+	return ((tapeIndex != NSNotFound) && (JFJSONDocumentTagAt(_tape, tapeIndex) == JFJSONDocumentTagNull));
+}
+
+- (NSNumber* _Nullable)numberAtIndex:(NSUInteger)index
+{
+	NSUInteger tapeIndex = [self tapeIndexAtIndex:index];
+	if(tapeIndex == NSNotFound)
+		return nil;
+	
+	switch(JFJSONDocumentTagAt(_tape, tapeIndex))
+	{
+		case JFJSONDocumentTagDouble:
+		case JFJSONDocumentTagInteger:
+			return JFJSONDocumentNumber(_tape, tapeIndex);
+		case JFJSONDocumentTagFalse:
+			return @NO;
+		case JFJSONDocumentTagTrue:
+			return @YES;
+		default:
+			return nil;
+	}
+}
+
+- (JFJSONDocumentObject* _Nullable)objectAtIndex:(NSUInteger)index
+{
+	NSUInteger tapeIndex = [self tapeIndexAtIndex:index];
+	if((tapeIndex == NSNotFound) || (JFJSONDocumentTagAt(_tape, tapeIndex) != JFJSONDocumentTagObject))
+		return nil;
+	
+	return [[JFJSONDocumentObject alloc] initWithDocument:self.document index:tapeIndex];
+}
+
+- (NSString* _Nullable)stringAtIndex:(NSUInteger)index
+{
+	NSUInteger tapeIndex = [self tapeIndexAtIndex:index];
+	if((tapeIndex == NSNotFound) || (JFJSONDocumentTagAt(_tape, tapeIndex) != JFJSONDocumentTagString))
+		return nil;
+	
+	return JFJSONDocumentString(_strings, JFJSONDocumentPayload(_tape, tapeIndex));
+}
+
+- (NSUInteger)tapeIndexAtIndex:(NSUInteger)index
+{
+	if(index >= _count)
+		return NSNotFound;
+	
+	if(index == 0)
+		return _index + 2;
+	
+	@synchronized(self)
+	{
+		if(!_offsets)
+		{
+			NSUInteger* offsets = malloc(_count * sizeof(NSUInteger));
+			if(!offsets)
+				return NSNotFound;
+			
+			for(NSUInteger child = _index + 2, offset = 0; offset < _count; offset++, child = JFJSONDocumentNextIndex(_tape, child))
+				offsets[offset] = child;
+			_offsets = offsets;
+		}
+		return _offsets[index];
+	}
+}
+
+- (id<JFJSONValue>)valueAtIndex:(NSUInteger)index
+{
+	NSUInteger tapeIndex = [self tapeIndexAtIndex:index];
+	if(tapeIndex == NSNotFound)
+		@throw [NSException exceptionWithName:NSRangeException reason:[NSString stringWithFormat:@"Index '%@' out of bounds '%@'.", JFStringFromNSUInteger(index), JFStringFromNSUInteger(_count)] userInfo:nil];
+	
+	return [self.document valueAtIndex:tapeIndex];
+}
+
+// =================================================================================================
+// MARK: Methods - Enumeration
+// =================================================================================================
+
+- (void)enumerateValuesUsingBlock:(JFJSONArrayEnumerationBlock)block
+{
+	[self enumerateValuesWithOptions:0 usingBlock:block];
+}
+
+- (void)enumerateValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONArrayEnumerationBlock)block
+{
+	JFJSONDocument* document = self.document;
+	if(options & NSEnumerationReverse)
+	{
+		for(NSUInteger index = _count; index > 0; index--)
+		{
+			if(block(index - 1, [document valueAtIndex:[self tapeIndexAtIndex:(index - 1)]]))
+				return;
+		}
+		return;
+	}
+	
+	for(NSUInteger child = _index + 2, index = 0; index < _count; index++, child = JFJSONDocumentNextIndex(_tape, child))
+	{
+		if(block(index, [document valueAtIndex:child]))
+			return;
+	}
+}
+
+- (NSEnumerator<id<JFJSONValue>>*)valueEnumerator
+{
+	return [[JFJSONDocumentEnumerator alloc] initWithDocument:self.document index:_index keys:NO];
+}
+
+// =================================================================================================
+// MARK: Methods - Subscripting
+// =================================================================================================
+
+- (id<JFJSONValue>)objectAtIndexedSubscript:(NSUInteger)index
+{
+	return [self valueAtIndex:index];
+}
+
+// =================================================================================================
+// MARK: Methods (NSCopying)
+// =================================================================================================
+
+- (id)copyWithZone:(NSZone* _Nullable)zone
+{
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods (NSFastEnumeration)
+// =================================================================================================
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState*)state objects:(__unsafe_unretained id _Nullable [])buffer count:(NSUInteger)len
+{
+	// The state holds the tape index of the next element, the first extra value holds the number of elements already returned; values are autoreleased, so that they outlive the batch.
+	if(state->state == 0)
+		state->state = _index + 2;
+	
+	JFJSONDocument* document = self.document;
+	NSUInteger child = (NSUInteger)state->state;
+	NSUInteger index = (NSUInteger)state->extra[1];
+	NSUInteger retVal = ((index < _count) ? MIN(len, _count - index) : 0);
+	for(NSUInteger offset = 0; offset < retVal; offset++, child = JFJSONDocumentNextIndex(_tape, child))
+		buffer[offset] = (__bridge id)CFAutorelease(CFBridgingRetain([document valueAtIndex:child]));
+	
+	state->extra[1] = index + retVal;
+	state->itemsPtr = buffer;
+	state->mutationsPtr = &state->extra[0];
+	state->state = child;
+	return retVal;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDocumentObject
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// The number of entries of the object.
+	NSUInteger _count;
+	
+	// The tape index of the object.
+	NSUInteger _index;
+	
+	// The strings area of the document.
+	const char* _strings;
+	
+	// The tape of the document.
+	const uint64_t* _tape;
+}
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize document = _document;
+
+// =================================================================================================
+// MARK: Properties - Serialization
+// =================================================================================================
+
+@synthesize serializer = _serializer;
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Data
+// =================================================================================================
+
+- (NSArray<NSString*>*)allKeys
+{
+	NSMutableArray<NSString*>* retObj = [[NSMutableArray<NSString*> alloc] initWithCapacity:_count];
+	for(NSUInteger child = _index + 2, offset = 0; offset < _count; offset++, child = JFJSONDocumentNextIndex(_tape, child + 1))
+		[retObj addObject:JFJSONDocumentString(_strings, JFJSONDocumentPayload(_tape, child))];
+	return retObj;
+}
+
+- (NSArray<id<JFJSONValue>>*)allValues
+{
+	JFJSONDocument* document = self.document;
+	NSMutableArray<id<JFJSONValue>>* retObj = [[NSMutableArray<id<JFJSONValue>> alloc] initWithCapacity:_count];
+	for(NSUInteger child = _index + 2, offset = 0; offset < _count; offset++, child = JFJSONDocumentNextIndex(_tape, child + 1))
+		[retObj addObject:[document valueAtIndex:(child + 1)]];
+	return retObj;
+}
+
+- (NSUInteger)count
+{
+	return _count;
+}
+
+- (NSData* _Nullable)dataValue
+{
+	return [self.serializer dataFromDictionary:self.dictionaryValue];
+}
+
+- (NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)dictionaryValue
+{
+	return (NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)JFJSONDocumentConvertibleValue(_tape, _strings, _index);
+}
+
+- (NSString* _Nullable)stringValue
+{
+	return [self.serializer stringFromDictionary:self.dictionaryValue];
+}
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Serialization
+// =================================================================================================
+
+- (id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	@synchronized(self)
+	{
+		return (_serializer ?: JFJSONDocument.defaultSerializer);
+	}
+}
+
+- (void)setSerializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	@synchronized(self)
+	{
+		_serializer = serializer;
+	}
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithDocument:(JFJSONDocument*)document index:(NSUInteger)index
+{
+	self = [super init];
+	
+	_document = document;
+	_index = index;
+	_strings = document.strings;
+	_tape = document.tape;
+	_count = (NSUInteger)_tape[index + 1];
+	
+	return self;
+}
+
+- (instancetype _Nullable)initWithData:(NSData*)data serializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	// The data is always parsed into a new document; the serializer is only used to convert the object back to JSON.
+	JFJSONDocument* document = [JFJSONDocument documentWithData:data];
+	if(!document || (JFJSONDocumentTagAt(document.tape, 0) != JFJSONDocumentTagObject))
+		return nil;
+	
+	self = [self initWithDocument:document index:0];
+	_serializer = serializer;
+	return self;
+}
+
+- (instancetype _Nullable)initWithString:(NSString*)string serializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
+{
+	NSData* data = [string dataUsingEncoding:NSUTF8StringEncoding];
+	return (data ? [self initWithData:data serializer:serializer] : nil);
+}
+
+// =================================================================================================
+// MARK: Methods - Comparison
+// =================================================================================================
+
+- (NSUInteger)hash
+{
+	return _count;
+}
+
+- (BOOL)isEqual:(id _Nullable)object
+{
+	if(![object isKindOfClass:JFJSONDocumentObject.class])
+		return NO;
+	
+	JFJSONDocumentObject* other = object;
+	if((other->_tape == _tape) && (other->_index == _index))
+		return YES;
+	
+	return ((other->_count == _count) && [self.dictionaryValue isEqualToDictionary:other.dictionaryValue]);
+}
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (JFJSONDocumentArray* _Nullable)arrayForKey:(NSString*)key
+{
+	NSUInteger tapeIndex = JFJSONDocumentFindKey(_tape, _strings, _index, key);
+	if((tapeIndex == NSNotFound) || (JFJSONDocumentTagAt(_tape, tapeIndex) != JFJSONDocumentTagArray))
+		return nil;
+	
+	return [[JFJSONDocumentArray alloc] initWithDocument:self.document index:tapeIndex];
+}
+
+- (BOOL)hasValueForKey:(NSString*)key
+{
+	return (JFJSONDocumentFindKey(_tape, _strings, _index, key) != NSNotFound);
+}
+
+- (BOOL)isNullForKey:(NSString*)key
+{
+	NSUInteger tapeIndex = JFJSONDocumentFindKey(_tape, _strings, _index, key);
+	return ((tapeIndex != NSNotFound) && (JFJSONDocumentTagAt(_tape, tapeIndex) == JFJSONDocumentTagNull));
+}
+
+- (NSNumber* _Nullable)numberForKey:(NSString*)key
+{
+	NSUInteger tapeIndex = JFJSONDocumentFindKey(_tape, _strings, _index, key);
+	if(tapeIndex == NSNotFound)
+		return nil;
+	
+	switch(JFJSONDocumentTagAt(_tape, tapeIndex))
+	{
+		case JFJSONDocumentTagDouble:
+		case JFJSONDocumentTagInteger:
+			return JFJSONDocumentNumber(_tape, tapeIndex);
+		case JFJSONDocumentTagFalse:
+			return @NO;
+		case JFJSONDocumentTagTrue:
+			return @YES;
+		default:
+			return nil;
+	}
+}
+
+- (JFJSONDocumentObject* _Nullable)objectForKey:(NSString*)key
+{
+	NSUInteger tapeIndex = JFJSONDocumentFindKey(_tape, _strings, _index, key);
+	if((tapeIndex == NSNotFound) || (JFJSONDocumentTagAt(_tape, tapeIndex) != JFJSONDocumentTagObject))
+		return nil;
+	
+	return [[JFJSONDocumentObject alloc] initWithDocument:self.document index:tapeIndex];
+}
+
+- (NSString* _Nullable)stringForKey:(NSString*)key
+{
+	NSUInteger tapeIndex = JFJSONDocumentFindKey(_tape, _strings, _index, key);
+	if((tapeIndex == NSNotFound) || (JFJSONDocumentTagAt(_tape, tapeIndex) != JFJSONDocumentTagString))
+		return nil;
+	
+	return JFJSONDocumentString(_strings, JFJSONDocumentPayload(_tape, tapeIndex));
+}
+
+- (id<JFJSONValue> _Nullable)valueForKey:(NSString*)key
+{
+	NSUInteger tapeIndex = JFJSONDocumentFindKey(_tape, _strings, _index, key);
+	return ((tapeIndex == NSNotFound) ? nil : [self.document valueAtIndex:tapeIndex]);
+}
+
+// =================================================================================================
+// MARK: Methods - Enumeration
+// =================================================================================================
+
+- (void)enumerateKeysAndValuesUsingBlock:(JFJSONObjectEnumerationBlock)block
+{
+	[self enumerateKeysAndValuesWithOptions:0 usingBlock:block];
+}
+
+- (void)enumerateKeysAndValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONObjectEnumerationBlock)block
+{
+	JFJSONDocument* document = self.document;
+	if(options & NSEnumerationReverse)
+	{
+		NSMutableData* keyIndexes = [[NSMutableData alloc] initWithLength:(_count * sizeof(NSUInteger))];
+		NSUInteger* indexes = keyIndexes.mutableBytes;
+		for(NSUInteger child = _index + 2, offset = 0; offset < _count; offset++, child = JFJSONDocumentNextIndex(_tape, child + 1))
+			indexes[offset] = child;
+		
+		for(NSUInteger offset = _count; offset > 0; offset--)
+		{
+			NSUInteger child = indexes[offset - 1];
+			if(block(JFJSONDocumentString(_strings, JFJSONDocumentPayload(_tape, child)), [document valueAtIndex:(child + 1)]))
+				return;
+		}
+		return;
+	}
+	
+	for(NSUInteger child = _index + 2, offset = 0; offset < _count; offset++, child = JFJSONDocumentNextIndex(_tape, child + 1))
+	{
+		if(block(JFJSONDocumentString(_strings, JFJSONDocumentPayload(_tape, child)), [document valueAtIndex:(child + 1)]))
+			return;
+	}
+}
+
+- (NSEnumerator<NSString*>*)keyEnumerator
+{
+	return [[JFJSONDocumentEnumerator alloc] initWithDocument:self.document index:_index keys:YES];
+}
+
+- (NSEnumerator<id<JFJSONValue>>*)valueEnumerator
+{
+	return [[JFJSONDocumentEnumerator alloc] initWithDocument:self.document index:_index keys:NO];
+}
+
+// =================================================================================================
+// MARK: Methods - Subscripting
+// =================================================================================================
+
+- (id<JFJSONValue> _Nullable)objectForKeyedSubscript:(NSString*)key
+{
+	return [self valueForKey:key];
+}
+
+// =================================================================================================
+// MARK: Methods (NSCopying)
+// =================================================================================================
+
+- (id)copyWithZone:(NSZone* _Nullable)zone
+{
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods (NSFastEnumeration)
+// =================================================================================================
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState*)state objects:(__unsafe_unretained id _Nullable [])buffer count:(NSUInteger)len
+{
+	// Enumerates the keys, like dictionaries do: the state holds the tape index of the next entry, the first extra value holds the number of entries already returned.
+	if(state->state == 0)
+		state->state = _index + 2;
+	
+	NSUInteger child = (NSUInteger)state->state;
+	NSUInteger index = (NSUInteger)state->extra[1];
+	NSUInteger retVal = ((index < _count) ? MIN(len, _count - index) : 0);
+	for(NSUInteger offset = 0; offset < retVal; offset++, child = JFJSONDocumentNextIndex(_tape, child + 1))
+		buffer[offset] = (__bridge id)CFAutorelease(CFBridgingRetain(JFJSONDocumentString(_strings, JFJSONDocumentPayload(_tape, child))));
+	
+	state->extra[1] = index + retVal;
+	state->itemsPtr = buffer;
+	state->mutationsPtr = &state->extra[0];
+	state->state = child;
+	return retVal;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDocumentEnumerator
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// The tape index of the next child.
+	NSUInteger _child;
+	
+	// The document containing the enumerated container.
+	JFJSONDocument* _document;
+	
+	// Set when the enumerated container is an object: its entries are made of a key followed by a value.
+	BOOL _isObject;
+	
+	// Set when the keys of an object must be returned instead of its values.
+	BOOL _keys;
+	
+	// The number of children still to return.
+	NSUInteger _remaining;
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithDocument:(JFJSONDocument*)document index:(NSUInteger)index keys:(BOOL)keys
+{
+	self = [super init];
+	
+	const uint64_t* tape = document.tape;
+	_child = index + 2;
+	_document = document;
+	_isObject = (JFJSONDocumentTagAt(tape, index) == JFJSONDocumentTagObject);
+	_keys = keys;
+	_remaining = (NSUInteger)tape[index + 1];
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods (NSEnumerator)
+// =================================================================================================
+
+- (id _Nullable)nextObject
+{
+	if(_remaining == 0)
+		return nil;
+	
+	JFJSONDocument* document = _document;
+	const uint64_t* tape = document.tape;
+	NSUInteger child = _child;
+	_remaining--;
+	
+	if(!_isObject)
+	{
+		_child = JFJSONDocumentNextIndex(tape, child);
+		return [document valueAtIndex:child];
+	}
+	
+	_child = JFJSONDocumentNextIndex(tape, child + 1);
+	return (_keys ? JFJSONDocumentString(document.strings, JFJSONDocumentPayload(tape, child)) : [document valueAtIndex:(child + 1)]);
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
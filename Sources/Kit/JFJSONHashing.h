@@ -0,0 +1,102 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+/**
+ * Returns the running hash to use to start hashing a JSON array containing the given number of values: the hashes of the values must then be mixed in order using `JFJSONHashCombine`, and the result must be passed to `JFJSONHashFinalize`.
+ * @param count The number of values.
+ * @return The initial running hash of the array.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashArrayStart(NSUInteger count);
+
+/**
+ * Mixes the given value into the given running hash; the result depends on the order in which the values are mixed.
+ * @param hash The running hash.
+ * @param value The value to mix.
+ * @return The updated running hash.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashCombine(uint64_t hash, uint64_t value);
+
+/**
+ * Returns the hash of a number with the given value; integers and floating point numbers that compare equal get the same hash.
+ * @param value The value of the number.
+ * @return The hash of the number.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashDouble(double value);
+
+/**
+ * Returns the hash of an entry of a JSON object: the hashes of the entries can be summed to get a hash that does not depend on the order of the keys.
+ * @param keyHash The hash of the key.
+ * @param valueHash The hash of the value.
+ * @return The hash of the entry.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashEntry(uint64_t keyHash, uint64_t valueHash);
+
+/**
+ * Spreads the bits of the given running hash, so that similar contents end up with very different hashes.
+ * @param hash The running hash.
+ * @return The final hash.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashFinalize(uint64_t hash);
+
+/**
+ * Returns the structural hash of a JSON object containing the given number of entries.
+ * @param entriesHash The sum of the hashes of the entries.
+ * @param count The number of entries.
+ * @return The structural hash of the object.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashObject(uint64_t entriesHash, NSUInteger count);
+
+/**
+ * Returns the hash of the given string, computed over all of its UTF-16 code units.
+ * @param string The string to hash.
+ * @return The hash of the string.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashString(NSString* string);
+
+/**
+ * Returns the structural hash of the given JSON value: values that are equal get the same hash.
+ * @param value The value to hash.
+ * @return The hash of the value.
+ */
+FOUNDATION_EXPORT uint64_t JFJSONHashValue(id _Nullable value);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,182 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONHashing.h"
+
+#import "JFJSONArray_Project.h"
+#import "JFJSONObject_Project.h"
+#import "JFJSONValueKind.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+// The primes of the xxHash64 algorithm.
+static const uint64_t JFJSONHashPrime1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t JFJSONHashPrime2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t JFJSONHashPrime3 = 0x165667B19E3779F9ULL;
+static const uint64_t JFJSONHashPrime4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t JFJSONHashPrime5 = 0x27D4EB2F165667C5ULL;
+
+// The seeds used for each kind of value, so that values of different kinds are unlikely to collide.
+static const uint64_t JFJSONHashSeedArray = JFJSONHashPrime5 + 1;
+static const uint64_t JFJSONHashSeedNull = JFJSONHashPrime5 + 2;
+static const uint64_t JFJSONHashSeedNumber = JFJSONHashPrime5 + 3;
+static const uint64_t JFJSONHashSeedObject = JFJSONHashPrime5 + 4;
+static const uint64_t JFJSONHashSeedString = JFJSONHashPrime5 + 5;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+static inline uint64_t JFJSONHashRotate(uint64_t value, int bits)
+{
+	return ((value << bits) | (value >> (64 - bits)));
+}
+
+static inline uint64_t JFJSONHashRound(uint64_t accumulator, uint64_t input)
+{
+	accumulator += input * JFJSONHashPrime2;
+	accumulator = JFJSONHashRotate(accumulator, 31);
+	return accumulator * JFJSONHashPrime1;
+}
+
+uint64_t JFJSONHashArrayStart(NSUInteger count)
+{
+	return JFJSONHashSeedArray + count;
+}
+
+uint64_t JFJSONHashCombine(uint64_t hash, uint64_t value)
+{
+	hash ^= JFJSONHashRound(0, value);
+	return JFJSONHashRotate(hash, 27) * JFJSONHashPrime1 + JFJSONHashPrime4;
+}
+
+uint64_t JFJSONHashDouble(double value)
+{
+	// Both zeros compare equal, so they must share the same bits.
+	if(value == 0)
+		value = 0;
+	
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return JFJSONHashFinalize(JFJSONHashCombine(JFJSONHashSeedNumber, bits));
+}
+
+uint64_t JFJSONHashEntry(uint64_t keyHash, uint64_t valueHash)
+{
+	return JFJSONHashFinalize(JFJSONHashCombine(keyHash, valueHash));
+}
+
+uint64_t JFJSONHashFinalize(uint64_t hash)
+{
+	hash ^= hash >> 33;
+	hash *= JFJSONHashPrime2;
+	hash ^= hash >> 29;
+	hash *= JFJSONHashPrime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+uint64_t JFJSONHashObject(uint64_t entriesHash, NSUInteger count)
+{
+	return JFJSONHashFinalize(JFJSONHashCombine(JFJSONHashSeedObject + count, entriesHash));
+}
+
+uint64_t JFJSONHashString(NSString* string)
+{
+	CFStringRef cfString = (__bridge CFStringRef)string;
+	CFIndex length = CFStringGetLength(cfString);
+	uint64_t retVal = JFJSONHashSeedString + (uint64_t)length;
+	
+	// The code units are mixed four at a time; the buffer holds a multiple of four code units, so that the result does not depend on how the string is stored.
+	UniChar buffer[256];
+	const UniChar* characters = CFStringGetCharactersPtr(cfString);
+	for(CFIndex location = 0; location < length;)
+	{
+		CFIndex chunkLength = length - location;
+		const UniChar* chunk;
+		if(characters)
+			chunk = characters + location;
+		else
+		{
+			chunkLength = MIN(chunkLength, (CFIndex)(sizeof(buffer) / sizeof(UniChar)));
+			CFStringGetCharacters(cfString, CFRangeMake(location, chunkLength), buffer);
+			chunk = buffer;
+		}
+		
+		for(CFIndex index = 0; index < chunkLength; index += 4)
+		{
+			uint64_t lane = 0;
+			for(CFIndex offset = 0; (offset < 4) && (index + offset < chunkLength); offset++)
+				lane |= ((uint64_t)chunk[index + offset] << (16 * offset));
+			retVal = JFJSONHashCombine(retVal, lane);
+		}
+		location += chunkLength;
+	}
+	
+	return JFJSONHashFinalize(retVal);
+}
+
+uint64_t JFJSONHashValue(id _Nullable value)
+{
+	switch(JFJSONValueKindOf(value))
+	{
+		case JFJSONValueKindArray:
+			return ((JFJSONArray*)value).structuralHash;
+		case JFJSONValueKindNumber:
+			// Numbers that compare equal must share the same hash, whatever their type: they are all hashed by value as floating point numbers.
+			return JFJSONHashDouble(((NSNumber*)value).doubleValue);
+		case JFJSONValueKindObject:
+			return ((JFJSONObject*)value).structuralHash;
+		case JFJSONValueKindString:
+			return JFJSONHashString(value);
+		case JFJSONValueKindNone:
+		case JFJSONValueKindNull:
+			if(!value || (value == (id)kCFNull))
+				return JFJSONHashFinalize(JFJSONHashSeedNull);
+			break;
+		default:
+			break;
+	}
+	
+	return (uint64_t)[value hash];
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
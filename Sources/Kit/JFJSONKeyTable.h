@@ -0,0 +1,114 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * A key layout shared by all the JSON objects that contain the same set of keys: the layout maps each key to the index of its value inside the value vector owned by each object.
+ */
+@interface JFJSONObjectShape : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * The number of keys in the layout.
+ */
+@property (assign, nonatomic, readonly) NSUInteger count;
+
+/**
+ * The keys of the layout, sorted by value index.
+ */
+@property (copy, nonatomic, readonly) NSArray<NSString*>* keys;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes this instance with the given keys.
+ * @param keys The keys of the layout; each key is assigned the index of its position.
+ * @return This instance.
+ */
+- (instancetype)initWithKeys:(NSArray<NSString*>*)keys NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+/**
+ * Returns the index of the value associated with the given key.
+ * @param key The key to look for.
+ * @return The index of the value associated with the given key, or `NSNotFound` if the key is not part of the layout.
+ */
+- (NSUInteger)indexOfKey:(NSString*)key;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * A table used while importing JSON content to intern the keys of JSON objects, so that equal keys share the same string instance, and to share the same key layout between JSON objects that contain the same set of keys.
+ * @warning This class is not thread safe: use one table per import.
+ */
+@interface JFJSONKeyTable : NSObject
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+/**
+ * Returns the interned instance of the given key.
+ * @param key The key to intern.
+ * @return The interned instance of the given key.
+ */
+- (NSString*)keyForString:(NSString*)key;
+
+/**
+ * Returns the key layout of a JSON object containing the given interned keys, creating it if needed.
+ * @param keys The interned keys of the JSON object.
+ * @param count The number of keys.
+ * @return The key layout for the given keys.
+ */
+- (JFJSONObjectShape*)shapeForKeys:(__unsafe_unretained NSString* _Nonnull [_Nonnull])keys count:(NSUInteger)count;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,182 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONKeyTable.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONKeyTable (/* Private */)
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@property (strong, nonatomic, readonly) NSMutableSet<NSString*>* keys;
+@property (strong, nonatomic, readonly) NSMutableDictionary<NSNumber*, NSMutableArray<JFJSONObjectShape*>*>* shapes;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONObjectShape
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	CFMutableDictionaryRef _indexes;
+}
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize count = _count;
+@synthesize keys = _keys;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithKeys:(NSArray<NSString*>*)keys
+{
+	self = [super init];
+	
+	_count = keys.count;
+	_indexes = CFDictionaryCreateMutable(kCFAllocatorDefault, (CFIndex)_count, &kCFTypeDictionaryKeyCallBacks, NULL);
+	_keys = [keys copy];
+	
+	for(NSUInteger index = 0; index < _count; index++)
+		CFDictionarySetValue(_indexes, (__bridge CFStringRef)[_keys objectAtIndex:index], (const void*)index);
+	
+	return self;
+}
+
+- (void)dealloc
+{
+	CFRelease(_indexes);
+}
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (NSUInteger)indexOfKey:(NSString*)key
+{
+	const void* value = NULL;
+	if(!CFDictionaryGetValueIfPresent(_indexes, (__bridge CFStringRef)key, &value))
+		return NSNotFound;
+	
+	return (NSUInteger)value;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONKeyTable
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize keys = _keys;
+@synthesize shapes = _shapes;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init
+{
+	self = [super init];
+	
+	_keys = [NSMutableSet<NSString*> new];
+	_shapes = [NSMutableDictionary<NSNumber*, NSMutableArray<JFJSONObjectShape*>*> new];
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+- (NSString*)keyForString:(NSString*)key
+{
+	NSMutableSet<NSString*>* keys = self.keys;
+	NSString* retObj = [keys member:key];
+	if(!retObj)
+	{
+		retObj = [key copy];
+		[keys addObject:retObj];
+	}
+	return retObj;
+}
+
+- (JFJSONObjectShape*)shapeForKeys:(__unsafe_unretained NSString* _Nonnull [_Nonnull])keys count:(NSUInteger)count
+{
+	// Interned keys are unique instances, so their addresses identify the set of keys regardless of its order.
+	uint64_t signature = count;
+	for(NSUInteger index = 0; index < count; index++)
+		signature += (((uint64_t)(uintptr_t)keys[index] >> 4) * 0x9E3779B97F4A7C15ULL);
+	
+	NSNumber* bucketKey = @(signature);
+	NSMutableArray<JFJSONObjectShape*>* bucket = [self.shapes objectForKey:bucketKey];
+	for(JFJSONObjectShape* shape in bucket)
+	{
+		if(shape.count != count)
+			continue;
+		
+		BOOL matches = YES;
+		for(NSUInteger index = 0; matches && (index < count); index++)
+			matches = ([shape indexOfKey:keys[index]] != NSNotFound);
+		
+		if(matches)
+			return shape;
+	}
+	
+	JFJSONObjectShape* retObj = [[JFJSONObjectShape alloc] initWithKeys:[NSArray<NSString*> arrayWithObjects:keys count:count]];
+	if(bucket)
+		[bucket addObject:retObj];
+	else
+		[self.shapes setObject:[NSMutableArray<JFJSONObjectShape*> arrayWithObject:retObj] forKey:bucketKey];
+	return retObj;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -34,6 +34,21 @@ NS_ASSUME_NONNULL_BEGIN
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
+// =================================================================================================
+// MARK: Blocks
+// =================================================================================================
+
+/**
+ * A block that combines the partial results of two adjacent chunks of a parallel reduction.
+ * @param result The partial result of the preceding chunks.
+ * @param other The partial result of the following chunk.
+ * @return The combined result.
+ */
+typedef id _Nullable (^JFJSONNodeCombineBlock)(id _Nullable result, id _Nullable other);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
 /**
  * Classes implementing the JSON node protocol can be used to group JSON values in a collection and convert them to JSON data/string and viceversa.
  */
@@ -48,6 +48,31 @@ NS_ASSUME_NONNULL_BEGIN
  */
 typedef BOOL (^JFJSONObjectEnumerationBlock)(NSString* key, id<JFJSONValue> value);
 
+/**
+ * A block to select entries in the object.
+ * @param key The key of the current entry.
+ * @param value The value of the current entry.
+ * @return Return `YES` to keep the entry, `NO` to discard it.
+ */
+typedef BOOL (^JFJSONObjectFilterBlock)(NSString* key, id<JFJSONValue> value);
+
+/**
+ * A block to transform values in the object.
+ * @param key The key of the current entry.
+ * @param value The value of the current entry.
+ * @return The result of the transformation.
+ */
+typedef id _Nullable (^JFJSONObjectMapBlock)(NSString* key, id<JFJSONValue> value);
+
+/**
+ * A block to fold values in the object into a partial result.
+ * @param result The partial result.
+ * @param key The key of the current entry.
+ * @param value The value of the current entry.
+ * @return The updated partial result.
+ */
+typedef id _Nullable (^JFJSONObjectReduceBlock)(id _Nullable result, NSString* key, id<JFJSONValue> value);
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
 
@@ -75,6 +100,15 @@ typedef BOOL (^JFJSONObjectEnumerationBlock)(NSString* key, id<JFJSONValue> valu
  */
 @property (copy, nonatomic, readonly) NSDictionary<NSString*, id<JFJSONConvertibleValue>>* dictionaryValue;
 
+// =================================================================================================
+// MARK: Properties - Memory
+// =================================================================================================
+
+/**
+ * Returns whether the JSON objects imported as part of a JSON array share a single key layout with the other imported objects that contain the same set of keys, storing only their values; an object stops sharing its layout as soon as its set of keys is modified. The default value is `YES`.
+ */
+@property (class, assign) BOOL sharesKeyLayouts;
+
 // =================================================================================================
 // MARK: Lifecycle
 // =================================================================================================
@@ -328,6 +362,39 @@ typedef BOOL (^JFJSONObjectEnumerationBlock)(NSString* key, id<JFJSONValue> valu
  */
 - (NSEnumerator<id<JFJSONValue>>*)valueEnumerator;
 
+// =================================================================================================
+// MARK: Methods - Parallel Processing
+// =================================================================================================
+
+/**
+ * Returns a new object containing the entries that pass the test implemented by the given block.
+ * @discussion The entries are split into chunks of `grainSize` entries, which are processed concurrently; the block must be safe to call from multiple threads, and the object must not be changed until the method returns. The selected entries are added to the new object in enumeration order.
+ * @param grainSize The number of entries of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param block The block to apply to the entries.
+ * @return A new object containing the selected entries.
+ */
+- (JFJSONObject*)filterValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONObjectFilterBlock)block;
+
+/**
+ * Returns the results of the given block applied to each value, associated with the key of the value.
+ * @discussion The entries are split into chunks of `grainSize` entries, which are processed concurrently; the block must be safe to call from multiple threads, and the object must not be changed until the method returns.
+ * @param grainSize The number of entries of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param block The block to apply to the values; `nil` results are stored as `NSNull`.
+ * @return The results of the block.
+ */
+- (NSDictionary<NSString*, id>*)mapValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONObjectMapBlock)block;
+
+/**
+ * Reduces the values to a single result.
+ * @discussion The entries are split, in enumeration order, into chunks of `grainSize` entries: each chunk is folded concurrently by `block`, starting from `initialValue`, then the partial results of the chunks are combined in order by `combineBlock`. Since the enumeration order of the entries is not defined, `combineBlock` should be commutative as well as associative, and `initialValue` should be an identity for it. The blocks must be safe to call from multiple threads, and the object must not be changed until the method returns.
+ * @param grainSize The number of entries of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param initialValue The value each chunk starts from; it's also the result if the object is empty.
+ * @param block The block that folds a value into a partial result.
+ * @param combineBlock The block that combines the partial results of two adjacent chunks.
+ * @return The result of the reduction.
+ */
+- (id _Nullable)reduceValuesWithGrainSize:(NSUInteger)grainSize initialValue:(id _Nullable)initialValue usingBlock:(JFJSONObjectReduceBlock)block combineBlock:(JFJSONNodeCombineBlock)combineBlock;
+
 // =================================================================================================
 // MARK: Methods - Subscripting
 // =================================================================================================
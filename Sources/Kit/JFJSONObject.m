@@ -24,10 +24,14 @@
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
-#import "JFJSONObject.h"
+#import "JFJSONObject_Project.h"
 
-#import "JFJSONArray.h"
+#import "JFJSONArray_Project.h"
+#import "JFJSONHashing.h"
+#import "JFJSONKeyTable.h"
+#import "JFJSONParallel.h"
 #import "JFJSONSerializer.h"
+#import "JFJSONValueKind.h"
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
@@ -35,13 +39,60 @@ NS_ASSUME_NONNULL_BEGIN
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+// The maximum number of entries stored inline: adding one more moves them to a dictionary.
+#define JFJSONObjectInlineCapacity 8
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+static BOOL JFJSONObjectIsNode(id _Nullable value)
+{
+	JFJSONValueKind kind = JFJSONValueKindOf(value);
+	return ((kind == JFJSONValueKindObject) || (kind == JFJSONValueKindArray));
+}
+
+static void JFJSONObjectCopyNodesInArray(NSMutableArray<id<JFJSONValue>>* values)
+{
+	for(NSUInteger index = 0; index < values.count; index++)
+	{
+		id value = [values objectAtIndex:index];
+		if(JFJSONObjectIsNode(value))
+			[values replaceObjectAtIndex:index withObject:[value copy]];
+	}
+}
+
+static void JFJSONObjectCopyNodesInMap(NSDictionary<NSString*, id<JFJSONValue>>* source, NSMutableDictionary<NSString*, id<JFJSONValue>>* target)
+{
+	// The keys are enumerated from the other dictionary, which holds the same entries, because the target can't be changed while being enumerated.
+	for(NSString* key in source)
+	{
+		id value = [source objectForKey:key];
+		if(JFJSONObjectIsNode(value))
+			[target setObject:[value copy] forKey:key];
+	}
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
 @interface JFJSONObject (/* Private */)
 
+// =================================================================================================
+// MARK: Properties - Comparison
+// =================================================================================================
+
+@property (assign, nonatomic, readonly) uint64_t cachedHash;
+
 // =================================================================================================
 // MARK: Properties - Data
 // =================================================================================================
 
-@property (strong, nonatomic, readonly) NSMutableDictionary<NSString*, id<JFJSONValue>>* map;
+@property (strong, nonatomic, readonly, nullable) NSMutableDictionary<NSString*, id<JFJSONValue>>* map;
+@property (strong, nonatomic, readonly, nullable) NSMutableArray<id<JFJSONValue>>* values;
 
 // =================================================================================================
 // MARK: Properties - Serialization
@@ -53,13 +104,40 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - Data
 // =================================================================================================
 
-- (void)importFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary;
+- (void)cloneStorage;
+- (void)detachShape;
+- (void)detachStorage;
+- (void)exposeNode:(id<JFJSONValue>)node;
+- (void)exposeNodes;
+- (void)importFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary keyTable:(JFJSONKeyTable*)keyTable;
+- (BOOL)importSharedLayoutFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)dictionary keyTable:(JFJSONKeyTable*)keyTable;
+
+// =================================================================================================
+// MARK: Methods - Data (Inline)
+// =================================================================================================
+
+- (void)clearInlineEntries;
+- (NSUInteger)indexOfInlineKey:(NSString*)key;
+- (void)moveInlineEntriesToMap;
 
 // =================================================================================================
 // MARK: Methods - Data (Values)
 // =================================================================================================
 
 - (id<JFJSONValue> _Nullable)checkValue:(id _Nullable)value;
+- (void)storeValue:(id<JFJSONValue> _Nullable)value forKey:(NSString*)key;
+
+// =================================================================================================
+// MARK: Methods - Ownership
+// =================================================================================================
+
+- (void)willChange;
+
+// =================================================================================================
+// MARK: Methods - Parallel Processing
+// =================================================================================================
+
+- (NSArray<NSString*>*)parallelKeysWithValues:(NSArray<id<JFJSONValue>>* __autoreleasing _Nonnull * _Nonnull)outValues;
 
 @end
 
@@ -68,11 +146,43 @@ NS_ASSUME_NONNULL_BEGIN
 
 @implementation JFJSONObject
 
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// Set when some of the stored nodes may be referenced outside of this object (handed out by an accessor, or given by the caller): when the storage stops being shared, this object keeps them and the copies get copies of them.
+	BOOL _exposesNodes;
+	
+	// The cached structural hash, or `0` if it must be computed again; the stored nodes handed out by this object tell it before they change (see `nodeWillChange:`), so that it can be reset.
+	uint64_t _hashValue;
+	
+	// The number of entries stored inline; the inline storage is in use while neither `map` nor `shape` are set.
+	NSUInteger _inlineCount;
+	
+	// The keys stored inline, in insertion order.
+	NSString* _inlineKeys[JFJSONObjectInlineCapacity];
+	
+	// Changed each time the set of keys stored inline changes, so that enumerations can detect it.
+	unsigned long _inlineMutations;
+	
+	// The values stored inline, at the same positions of their keys.
+	id<JFJSONValue> _inlineValues[JFJSONObjectInlineCapacity];
+	
+	// The containers that handed out this object or were given it by the caller, created when the first one is added; they are told before this object changes. Containers that no longer store this object are not removed: they only do some needless work.
+	NSHashTable* _owners;
+	
+	// Set when the storage is shared with a copy: it must be cloned before being changed or before handing out any of its nodes.
+	BOOL _sharesStorage;
+}
+
 // =================================================================================================
 // MARK: Properties - Data
 // =================================================================================================
 
 @synthesize map = _map;
+@synthesize shape = _shape;
+@synthesize values = _values;
 
 // =================================================================================================
 // MARK: Properties - Serialization
@@ -80,6 +190,28 @@ NS_ASSUME_NONNULL_BEGIN
 
 @synthesize serializer = _serializer;
 
+// =================================================================================================
+// MARK: Properties (Accessors) - Memory
+// =================================================================================================
+
+static BOOL _sharesKeyLayouts = YES;
+
++ (BOOL)sharesKeyLayouts
+{
+	@synchronized(self)
+	{
+		return _sharesKeyLayouts;
+	}
+}
+
++ (void)setSharesKeyLayouts:(BOOL)sharesKeyLayouts
+{
+	@synchronized(self)
+	{
+		_sharesKeyLayouts = sharesKeyLayouts;
+	}
+}
+
 // =================================================================================================
 // MARK: Properties (Accessors) - Serialization
 // =================================================================================================
@@ -111,44 +243,91 @@ NS_ASSUME_NONNULL_BEGIN
 	}
 }
 
+// =================================================================================================
+// MARK: Properties (Accessors) - Comparison
+// =================================================================================================
+
+- (uint64_t)cachedHash
+{
+	return _hashValue;
+}
+
+- (uint64_t)structuralHash
+{
+	uint64_t retVal = self.cachedHash;
+	if(retVal != 0)
+		return retVal;
+	
+	// The entries are combined by sum, so that the hash does not depend on the order of the keys.
+	__block uint64_t entriesHash = 0;
+	[self enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		entriesHash += JFJSONHashEntry(JFJSONHashString(key), JFJSONHashValue(value));
+		return NO;
+	}];
+	retVal = JFJSONHashObject(entriesHash, self.count);
+	if(retVal == 0)
+		retVal = 1;
+	
+	_hashValue = retVal;
+	return retVal;
+}
+
 // =================================================================================================
 // MARK: Properties (Accessors) - Data
 // =================================================================================================
 
 - (NSArray<NSString*>*)allKeys
 {
-	return self.map.allKeys;
+	JFJSONObjectShape* shape = self.shape;
+	if(shape)
+		return shape.keys;
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	return (map ? map.allKeys : [NSArray<NSString*> arrayWithObjects:(__unsafe_unretained NSString**)(void*)_inlineKeys count:_inlineCount]);
 }
 
 - (NSArray<id<JFJSONValue>>*)allValues
 {
-	return self.map.allValues;
+	[self exposeNodes];
+	
+	if(self.shape)
+		return [self.values copy];
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	return (map ? map.allValues : [NSArray<id<JFJSONValue>> arrayWithObjects:(__unsafe_unretained id*)(void*)_inlineValues count:_inlineCount]);
 }
 
 - (NSUInteger)count
 {
-	return self.map.count;
+	JFJSONObjectShape* shape = self.shape;
+	if(shape)
+		return shape.count;
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	return (map ? map.count : _inlineCount);
 }
 
 - (NSData* _Nullable)dataValue
 {
-	return [self.serializer dataFromDictionary:self.dictionaryValue];
+	id<JFJSONSerializationAdapter> serializer = self.serializer;
+	if([serializer respondsToSelector:@selector(dataFromJSONObject:)])
+		return [serializer dataFromJSONObject:self];
+	
+	return [serializer dataFromDictionary:self.dictionaryValue];
 }
 
 - (NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)dictionaryValue
 {
-	NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>>* retObj = [NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>> dictionaryWithDictionary:self.map];
-	for(NSString* key in retObj.allKeys)
-	{
-		id value = [retObj objectForKey:key];
+	NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>>* retObj = [NSMutableDictionary<NSString*, id<JFJSONConvertibleValue>> dictionaryWithCapacity:self.count];
+	[self enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
 		if([value isKindOfClass:[JFJSONArray class]])
-			value = ((JFJSONArray*)value).arrayValue;
+			[retObj setObject:((JFJSONArray*)value).arrayValue forKey:key];
 		else if([value isKindOfClass:[JFJSONObject class]])
-			value = ((JFJSONObject*)value).dictionaryValue;
+			[retObj setObject:((JFJSONObject*)value).dictionaryValue forKey:key];
 		else
-			continue;
-		[retObj setObject:value forKey:key];
-	}
+			[retObj setObject:value forKey:key];
+		return NO;
+	}];
 	return retObj;
 }
 
@@ -168,7 +347,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (instancetype _Nullable)objectWithData:(NSData* _Nullable)data serializer:(id<JFJSONSerializationAdapter> _Nullable)serializer
 {
-	return (data ? [self objectWithDictionary:[(serializer ?: self.defaultSerializer) dictionaryFromData:data] serializer:serializer] : nil);
+	return (data ? [[self alloc] initWithData:data serializer:serializer] : nil);
 }
 
 + (instancetype _Nullable)objectWithDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary
@@ -196,12 +375,18 @@ NS_ASSUME_NONNULL_BEGIN
 	return (string ? [self objectWithDictionary:[(serializer ?: self.defaultSerializer) dictionaryFromString:string] serializer:serializer] : nil);
 }
 
+- (void)dealloc
+{
+	// Nobody could tell the copies still sharing the storage about the changes of the nodes handed out by this object anymore: they get copies of them right away.
+	if(_sharesStorage && _exposesNodes)
+		[self cloneStorage];
+}
+
 - (instancetype)init
 {
+	// The entries are stored inline until there are too many of them: the dictionary is created only then.
 	self = [super init];
 	
-	_map = [NSMutableDictionary<NSString*, id<JFJSONValue>> new];
-	
 	return self;
 }
 
@@ -209,7 +394,8 @@ NS_ASSUME_NONNULL_BEGIN
 {
 	self = [super init];
 	
-	_map = [[NSMutableDictionary<NSString*, id<JFJSONValue>> alloc] initWithCapacity:capacity];
+	if(capacity > JFJSONObjectInlineCapacity)
+		_map = [[NSMutableDictionary<NSString*, id<JFJSONValue>> alloc] initWithCapacity:capacity];
 	
 	return self;
 }
@@ -225,9 +411,13 @@ NS_ASSUME_NONNULL_BEGIN
 	
 	_serializer = serializer;
 	
-	NSDictionary<NSString*, id<JFJSONConvertibleValue>>* dictionary = [(serializer ?: self.serializer) dictionaryFromData:data];
+	id<JFJSONSerializationAdapter> adapter = (serializer ?: self.serializer);
+	if([adapter respondsToSelector:@selector(importData:intoJSONObject:)])
+		return ([adapter importData:data intoJSONObject:self] ? self : nil);
+	
+	NSDictionary<NSString*, id<JFJSONConvertibleValue>>* dictionary = [adapter dictionaryFromData:data];
 	if(dictionary)
-		[self importFromDictionary:dictionary];
+		[self importFromDictionary:dictionary keyTable:[JFJSONKeyTable new]];
 	else
 		self = nil;
 	
@@ -236,9 +426,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)dictionary
 {
-	self = [self initWithCapacity:dictionary.count];
+	return [self initWithDictionary:dictionary keyTable:[JFJSONKeyTable new] sharingLayout:NO];
+}
+
+- (instancetype)initWithDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)dictionary keyTable:(JFJSONKeyTable*)keyTable sharingLayout:(BOOL)sharingLayout
+{
+	self = [super init];
 	
-	[self importFromDictionary:dictionary];
+	if(!sharingLayout || ![self importSharedLayoutFromDictionary:dictionary keyTable:keyTable])
+	{
+		NSUInteger count = dictionary.count;
+		if(count > JFJSONObjectInlineCapacity)
+			_map = [[NSMutableDictionary<NSString*, id<JFJSONValue>> alloc] initWithCapacity:count];
+		[self importFromDictionary:dictionary keyTable:keyTable];
+	}
 	
 	return self;
 }
@@ -256,7 +457,7 @@ NS_ASSUME_NONNULL_BEGIN
 	
 	NSDictionary<NSString*, id<JFJSONConvertibleValue>>* dictionary = [(serializer ?: self.serializer) dictionaryFromString:string];
 	if(dictionary)
-		[self importFromDictionary:dictionary];
+		[self importFromDictionary:dictionary keyTable:[JFJSONKeyTable new]];
 	else
 		self = nil;
 	
@@ -269,7 +470,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSUInteger)hash
 {
-	return self.map.hash;
+	return (NSUInteger)self.structuralHash;
 }
 
 - (BOOL)isEqual:(id _Nullable)object
@@ -282,26 +483,245 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (BOOL)isEqualToJSONObject:(JFJSONObject*)other
 {
-	return [self.map isEqualToDictionary:other.map];
+	if((self == other) || [self sharesStorageWithJSONObject:other])
+		return YES;
+	
+	// Objects with different hashes can't be equal: the hashes are compared only when both are already available.
+	uint64_t hash = self.cachedHash;
+	uint64_t otherHash = other.cachedHash;
+	if((hash != 0) && (otherHash != 0) && (hash != otherHash))
+		return NO;
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* otherMap = other.map;
+	if(map && otherMap)
+		return [map isEqualToDictionary:otherMap];
+	
+	JFJSONObjectShape* shape = self.shape;
+	JFJSONObjectShape* otherShape = other.shape;
+	if(shape && (shape == otherShape))
+		return [self.values isEqualToArray:other.values];
+	
+	if(self.count != other.count)
+		return NO;
+	
+	__block BOOL retVal = YES;
+	[self enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		retVal = [value isEqual:[other storedValueForKey:key]];
+		return !retVal;
+	}];
+	return retVal;
+}
+
+- (BOOL)sharesStorageWithJSONObject:(JFJSONObject*)other
+{
+	// The inline entries are never shared.
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	if(map)
+		return (map == other.map);
+	
+	NSMutableArray<id<JFJSONValue>>* values = self.values;
+	return (values && (values == other.values) && (self.shape == other.shape));
 }
 
 // =================================================================================================
 // MARK: Methods - Data
 // =================================================================================================
 
-- (void)importFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary
+- (void)cloneStorage
+{
+	// The nodes that may have been handed out by this object stay with it, so the copies still sharing the old storage get copies of them instead; otherwise, this object takes the copies, and nobody else knows about its nodes anymore.
+	BOOL keepsNodes = _exposesNodes;
+	
+	JFJSONObjectShape* shape = self.shape;
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	if(shape)
+	{
+		NSMutableArray<id<JFJSONValue>>* values = self.values;
+		NSMutableArray<id<JFJSONValue>>* clone = [values mutableCopy];
+		JFJSONObjectCopyNodesInArray(keepsNodes ? values : clone);
+		_values = clone;
+	}
+	else if(map)
+	{
+		NSMutableDictionary<NSString*, id<JFJSONValue>>* clone = [map mutableCopy];
+		if(keepsNodes)
+			JFJSONObjectCopyNodesInMap(clone, map);
+		else
+			JFJSONObjectCopyNodesInMap(map, clone);
+		_map = clone;
+	}
+	else if(!keepsNodes)
+	{
+		// The inline entries already belong to this object: only the nodes they share must be replaced. The copies have their own inline entries, and are told directly by the exposed nodes before they change (see `copyWithZone:`).
+		for(NSUInteger index = 0; index < _inlineCount; index++)
+		{
+			id value = _inlineValues[index];
+			if(JFJSONObjectIsNode(value))
+				_inlineValues[index] = [value copy];
+		}
+	}
+}
+
+- (void)detachShape
+{
+	JFJSONObjectShape* shape = self.shape;
+	if(!shape)
+		return;
+	
+	NSArray<NSString*>* keys = shape.keys;
+	NSArray<id<JFJSONValue>>* values = self.values;
+	NSUInteger count = shape.count;
+	if(count > JFJSONObjectInlineCapacity)
+		_map = [[NSMutableDictionary<NSString*, id<JFJSONValue>> alloc] initWithObjects:values forKeys:keys];
+	else
+	{
+		for(NSUInteger index = 0; index < count; index++)
+		{
+			_inlineKeys[index] = [keys objectAtIndex:index];
+			_inlineValues[index] = [values objectAtIndex:index];
+		}
+		_inlineCount = count;
+		_inlineMutations++;
+	}
+	_shape = nil;
+	_values = nil;
+}
+
+- (void)detachStorage
+{
+	if(!_sharesStorage)
+		return;
+	
+	_sharesStorage = NO;
+	[self cloneStorage];
+}
+
+- (void)exposeNode:(id<JFJSONValue>)node
+{
+	_exposesNodes = YES;
+	[(id)node addOwner:self];
+}
+
+- (void)exposeNodes
+{
+	[self detachStorage];
+	[self enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		if(JFJSONObjectIsNode(value))
+			[self exposeNode:value];
+		return NO;
+	}];
+}
+
+- (void)importValue:(id<JFJSONValue>)value forKey:(NSString*)key
+{
+	[self willChange];
+	[self detachStorage];
+	[self storeValue:[self checkValue:value] forKey:key];
+}
+
+- (void)importFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary keyTable:(JFJSONKeyTable*)keyTable
 {
 	for(NSString* key in dictionary)
 	{
 		id value = [dictionary objectForKey:key];
 		if([value isKindOfClass:[NSArray class]])
-			value = [[JFJSONArray alloc] initWithArray:value];
+			value = [[JFJSONArray alloc] initWithArray:value keyTable:keyTable];
 		else if([value isKindOfClass:[NSDictionary class]])
-			value = [[JFJSONObject alloc] initWithDictionary:value];
-		[self setValue:value forKey:key];
+			value = [[JFJSONObject alloc] initWithDictionary:value keyTable:keyTable sharingLayout:NO];
+		[self storeValue:[self checkValue:value] forKey:([key isKindOfClass:[NSString class]] ? [keyTable keyForString:key] : key)];
 	}
 }
 
+- (BOOL)importSharedLayoutFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)dictionary keyTable:(JFJSONKeyTable*)keyTable
+{
+	NSUInteger count = dictionary.count;
+	if(count == 0)
+		return NO;
+	
+	__unsafe_unretained id* keys = (__unsafe_unretained id*)malloc(count * sizeof(id));
+	[dictionary getObjects:NULL andKeys:keys count:count];
+	
+	BOOL retVal = YES;
+	for(NSUInteger index = 0; retVal && (index < count); index++)
+	{
+		if([keys[index] isKindOfClass:[NSString class]])
+			keys[index] = [keyTable keyForString:keys[index]];
+		else
+			retVal = NO;
+	}
+	
+	JFJSONObjectShape* shape = (retVal ? [keyTable shapeForKeys:(__unsafe_unretained NSString**)keys count:count] : nil);
+	free(keys);
+	if(!shape)
+		return NO;
+	
+	// The values are stored in the order of the keys of the layout.
+	NSMutableArray<id<JFJSONValue>>* values = [[NSMutableArray<id<JFJSONValue>> alloc] initWithCapacity:count];
+	for(NSString* key in shape.keys)
+	{
+		id value = [dictionary objectForKey:key];
+		if([value isKindOfClass:[NSArray class]])
+			value = [[JFJSONArray alloc] initWithArray:value keyTable:keyTable];
+		else if([value isKindOfClass:[NSDictionary class]])
+			value = [[JFJSONObject alloc] initWithDictionary:value keyTable:keyTable sharingLayout:YES];
+		
+		value = [self checkValue:value];
+		if(!value)
+		{
+			// The dictionary contains something that can't be stored in a JSON object: it will be imported the usual way.
+			return NO;
+		}
+		[values addObject:value];
+	}
+	
+	_shape = shape;
+	_values = values;
+	return YES;
+}
+
+// =================================================================================================
+// MARK: Methods - Data (Inline)
+// =================================================================================================
+
+- (void)clearInlineEntries
+{
+	for(NSUInteger index = 0; index < _inlineCount; index++)
+	{
+		_inlineKeys[index] = nil;
+		_inlineValues[index] = nil;
+	}
+	_inlineCount = 0;
+	_inlineMutations++;
+}
+
+- (NSUInteger)indexOfInlineKey:(NSString*)key
+{
+	// Keys coming from a key table are unique instances: comparing the pointers first finds most of them without comparing any string.
+	NSUInteger count = _inlineCount;
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		if(_inlineKeys[index] == key)
+			return index;
+	}
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		if([_inlineKeys[index] isEqualToString:key])
+			return index;
+	}
+	return NSNotFound;
+}
+
+- (void)moveInlineEntriesToMap
+{
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = [[NSMutableDictionary<NSString*, id<JFJSONValue>> alloc] initWithCapacity:(JFJSONObjectInlineCapacity * 2)];
+	for(NSUInteger index = 0; index < _inlineCount; index++)
+		[map setObject:_inlineValues[index] forKey:_inlineKeys[index]];
+	
+	[self clearInlineEntries];
+	_map = map;
+}
+
 // =================================================================================================
 // MARK: Methods - Data (Arrays)
 // =================================================================================================
@@ -309,7 +729,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (JFJSONArray* _Nullable)arrayForKey:(NSString*)key
 {
 	id<JFJSONValue> retVal = [self valueForKey:key];
-	return ((retVal && [retVal isKindOfClass:[JFJSONArray class]]) ? (JFJSONArray*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindArray) ? (JFJSONArray*)retVal : nil);
 }
 
 - (void)setArray:(JFJSONArray* _Nullable)value forKey:(NSString*)key
@@ -324,7 +744,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (BOOL)isNullForKey:(NSString*)key
 {
 	id<JFJSONValue> retVal = [self valueForKey:key];
-	return (retVal && [retVal isKindOfClass:[NSNull class]]);
+	return (JFJSONValueKindOf(retVal) == JFJSONValueKindNull);
 }
 
 - (void)setNullForKey:(NSString*)key
@@ -339,7 +759,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSNumber* _Nullable)numberForKey:(NSString*)key
 {
 	id<JFJSONValue> retVal = [self valueForKey:key];
-	return ((retVal && [retVal isKindOfClass:[NSNumber class]]) ? (NSNumber*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindNumber) ? (NSNumber*)retVal : nil);
 }
 
 - (void)setNumber:(NSNumber* _Nullable)value forKey:(NSString*)key
@@ -354,7 +774,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (JFJSONObject* _Nullable)objectForKey:(NSString*)key
 {
 	id<JFJSONValue> retVal = [self valueForKey:key];
-	return ((retVal && [retVal isKindOfClass:[JFJSONObject class]]) ? (JFJSONObject*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindObject) ? (JFJSONObject*)retVal : nil);
 }
 
 - (void)setObject:(JFJSONObject* _Nullable)value forKey:(NSString*)key
@@ -374,7 +794,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSString* _Nullable)stringForKey:(NSString*)key
 {
 	id<JFJSONValue> retVal = [self valueForKey:key];
-	return ((retVal && [retVal isKindOfClass:[NSString class]]) ? (NSString*)retVal : nil);
+	return ((JFJSONValueKindOf(retVal) == JFJSONValueKindString) ? (NSString*)retVal : nil);
 }
 
 // =================================================================================================
@@ -383,24 +803,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (id<JFJSONValue> _Nullable)checkValue:(id _Nullable)value
 {
-	if(!value || [value conformsToProtocol:@protocol(JFJSONValue)])
-		return value;
-	
-	// NB: sometimes the protocol check is not enough, maybe due to cluster classes.
-	
-	static NSArray<Class>* conformingClasses = nil;
-	static dispatch_once_t onceToken;
-	dispatch_once(&onceToken, ^{
-		conformingClasses = @[JFJSONArray.class, JFJSONObject.class, NSNull.class, NSNumber.class, NSString.class];
-	});
-	
-	for(Class conformingClass in conformingClasses)
-	{
-		if([value isKindOfClass:conformingClass])
-			return value;
-	}
-	
-	return nil;
+	return ((JFJSONValueKindOf(value) == JFJSONValueKindNone) ? nil : value);
 }
 
 - (BOOL)hasValueForKey:(NSString*)key
@@ -410,7 +813,19 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)removeAllValues
 {
-	[self.map removeAllObjects];
+	[self willChange];
+	
+	// There is no need to clone the storage just to empty it, unless the copies sharing it must first get copies of the nodes handed out by this object; then the object goes back to storing its entries inline.
+	if(_exposesNodes)
+		[self detachStorage];
+	
+	_exposesNodes = NO;
+	_hashValue = 0;
+	_map = nil;
+	_shape = nil;
+	_sharesStorage = NO;
+	_values = nil;
+	[self clearInlineEntries];
 }
 
 - (void)removeValueForKey:(NSString*)key
@@ -421,15 +836,125 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)setValue:(id<JFJSONValue> _Nullable)value forKey:(NSString*)key
 {
 	value = [self checkValue:value];
-	if(value)
+	
+	[self willChange];
+	[self detachStorage];
+	if(JFJSONObjectIsNode(value))
+		[self exposeNode:value];
+	
+	[self storeValue:value forKey:key];
+}
+
+- (void)storeValue:(id<JFJSONValue> _Nullable)value forKey:(NSString*)key
+{
+	_hashValue = 0;
+	
+	JFJSONObjectShape* shape = self.shape;
+	if(shape)
+	{
+		// Replacing the value of a key of the layout keeps sharing it; any other change of the set of keys detaches the object from it.
+		NSUInteger index = [shape indexOfKey:key];
+		if(index != NSNotFound)
+		{
+			if(value)
+			{
+				[self.values replaceObjectAtIndex:index withObject:value];
+				return;
+			}
+		}
+		else if(!value)
+			return;
+		
+		[self detachShape];
+	}
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	if(map)
+	{
+		if(value)
+			[map setObject:value forKey:key];
+		else
+			[map removeObjectForKey:key];
+		return;
+	}
+	
+	NSUInteger index = [self indexOfInlineKey:key];
+	if(index != NSNotFound)
+	{
+		if(value)
+		{
+			_inlineValues[index] = value;
+			return;
+		}
+		
+		// The following entries are moved back by one position, to keep the insertion order.
+		NSUInteger last = _inlineCount - 1;
+		for(; index < last; index++)
+		{
+			_inlineKeys[index] = _inlineKeys[index + 1];
+			_inlineValues[index] = _inlineValues[index + 1];
+		}
+		_inlineKeys[last] = nil;
+		_inlineValues[last] = nil;
+		_inlineCount = last;
+		_inlineMutations++;
+		return;
+	}
+	
+	if(!value)
+		return;
+	
+	if(_inlineCount == JFJSONObjectInlineCapacity)
+	{
+		[self moveInlineEntriesToMap];
 		[self.map setObject:value forKey:key];
-	else
-		[self.map removeObjectForKey:key];
+		return;
+	}
+	
+	// The key is copied, like a dictionary would do.
+	_inlineKeys[_inlineCount] = [key copy];
+	_inlineValues[_inlineCount] = value;
+	_inlineCount++;
+	_inlineMutations++;
+}
+
+- (id<JFJSONValue>)storedValueAtShapeIndex:(NSUInteger)index
+{
+	return [self.values objectAtIndex:index];
+}
+
+- (id<JFJSONValue> _Nullable)storedValueForKey:(NSString*)key
+{
+	JFJSONObjectShape* shape = self.shape;
+	if(shape)
+	{
+		NSUInteger index = [shape indexOfKey:key];
+		return ((index != NSNotFound) ? [self.values objectAtIndex:index] : nil);
+	}
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	if(map)
+		return [map objectForKey:key];
+	
+	NSUInteger index = [self indexOfInlineKey:key];
+	return ((index != NSNotFound) ? _inlineValues[index] : nil);
 }
 
 - (id<JFJSONValue> _Nullable)valueForKey:(NSString*)key
 {
-	return [self.map objectForKey:key];
+	id<JFJSONValue> retObj = [self storedValueForKey:key];
+	if(!JFJSONObjectIsNode(retObj))
+		return retObj;
+	
+	// The node is about to be handed out: if it is shared with a copy, it may be replaced by its own copy first.
+	if(_sharesStorage)
+	{
+		[self detachStorage];
+		retObj = [self storedValueForKey:key];
+	}
+	
+	[self exposeNode:retObj];
+	return retObj;
 }
 
 // =================================================================================================
@@ -438,26 +963,152 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)enumerateKeysAndValuesUsingBlock:(JFJSONObjectEnumerationBlock)block
 {
-	[self.map enumerateKeysAndObjectsUsingBlock:^(NSString* key, id<JFJSONValue> value, BOOL* stop) {
-		*stop = block(key, value);
-	}];
+	[self enumerateKeysAndValuesWithOptions:0 usingBlock:block];
 }
 
 - (void)enumerateKeysAndValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONObjectEnumerationBlock)block
 {
-	[self.map enumerateKeysAndObjectsWithOptions:options usingBlock:^(NSString* key, id<JFJSONValue> value, BOOL* stop) {
-		*stop = block(key, value);
-	}];
+	[self exposeNodes];
+	[self enumerateStoredKeysAndValuesWithOptions:options usingBlock:block];
+}
+
+- (void)enumerateStoredKeysAndValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONObjectEnumerationBlock)block
+{
+	JFJSONObjectShape* shape = self.shape;
+	if(shape)
+	{
+		NSArray<id<JFJSONValue>>* values = self.values;
+		[shape.keys enumerateObjectsWithOptions:options usingBlock:^(NSString* key, NSUInteger index, BOOL* stop) {
+			*stop = block(key, [values objectAtIndex:index]);
+		}];
+		return;
+	}
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	if(map)
+	{
+		[map enumerateKeysAndObjectsWithOptions:options usingBlock:^(NSString* key, id<JFJSONValue> value, BOOL* stop) {
+			*stop = block(key, value);
+		}];
+		return;
+	}
+	
+	// The inline entries are too few to be worth a concurrent enumeration: they are always enumerated serially.
+	BOOL reverse = ((options & NSEnumerationReverse) != 0);
+	NSUInteger count = _inlineCount;
+	unsigned long mutations = _inlineMutations;
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		NSUInteger position = (reverse ? (count - index - 1) : index);
+		NSString* key = _inlineKeys[position];
+		id<JFJSONValue> value = _inlineValues[position];
+		if(block(key, value))
+			break;
+		
+		if(_inlineMutations != mutations)
+			@throw [NSException exceptionWithName:NSGenericException reason:[NSString stringWithFormat:@"The JSON object '%p' was mutated while being enumerated.", self] userInfo:nil];
+	}
 }
 
 - (NSEnumerator<NSString*>*)keyEnumerator
 {
-	return [self.map keyEnumerator];
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	return (map ? [map keyEnumerator] : [self.allKeys objectEnumerator]);
 }
 
 - (NSEnumerator<id<JFJSONValue>>*)valueEnumerator
 {
-	return [self.map objectEnumerator];
+	[self exposeNodes];
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	return (map ? [map objectEnumerator] : [self.allValues objectEnumerator]);
+}
+
+// =================================================================================================
+// MARK: Methods - Ownership
+// =================================================================================================
+
+- (void)addOwner:(id)owner
+{
+	if(!_owners)
+		_owners = [NSHashTable weakObjectsHashTable];
+	[_owners addObject:owner];
+}
+
+- (void)nodeWillChange:(id<JFJSONValue>)node
+{
+	// The owners are told first, so that they can copy this object while it still shares the node; then the copies sharing the storage get their own copy of the node, as this object keeps it.
+	[self willChange];
+	[self detachStorage];
+}
+
+- (void)willChange
+{
+	// The hashes cached along the path leading to this object are reset as well.
+	_hashValue = 0;
+	for(id owner in _owners.allObjects)
+		[owner nodeWillChange:self];
+}
+
+// =================================================================================================
+// MARK: Methods - Parallel Processing
+// =================================================================================================
+
+- (JFJSONObject*)filterValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONObjectFilterBlock)block
+{
+	NSArray<id<JFJSONValue>>* values = nil;
+	NSArray<NSString*>* keys = [self parallelKeysWithValues:&values];
+	NSIndexSet* indexes = JFJSONParallelFilter(keys.count, grainSize, ^BOOL(NSUInteger index) {
+		return block([keys objectAtIndex:index], [values objectAtIndex:index]);
+	});
+	
+	JFJSONObject* retObj = [[JFJSONObject alloc] initWithCapacity:indexes.count];
+	[indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL* stop) {
+		[retObj setValue:[values objectAtIndex:index] forKey:[keys objectAtIndex:index]];
+	}];
+	return retObj;
+}
+
+- (NSDictionary<NSString*, id>*)mapValuesWithGrainSize:(NSUInteger)grainSize usingBlock:(JFJSONObjectMapBlock)block
+{
+	NSArray<id<JFJSONValue>>* values = nil;
+	NSArray<NSString*>* keys = [self parallelKeysWithValues:&values];
+	NSArray* results = JFJSONParallelMap(keys.count, grainSize, ^id _Nullable(NSUInteger index) {
+		return block([keys objectAtIndex:index], [values objectAtIndex:index]);
+	});
+	return [NSDictionary dictionaryWithObjects:results forKeys:keys];
+}
+
+- (NSArray<NSString*>*)parallelKeysWithValues:(NSArray<id<JFJSONValue>>* __autoreleasing _Nonnull * _Nonnull)outValues
+{
+	// The entries are snapshotted into two aligned arrays, so that the workers can address them by index; stored nodes are about to be handed out to the blocks, so they are exposed once, before the workers start.
+	[self exposeNodes];
+	
+	if(self.shape)
+	{
+		*outValues = self.values;
+		return self.shape.keys;
+	}
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	if(!map)
+	{
+		*outValues = self.allValues;
+		return self.allKeys;
+	}
+	
+	NSArray<NSString*>* retObj = map.allKeys;
+	*outValues = [map objectsForKeys:retObj notFoundMarker:NSNull.null];
+	return retObj;
+}
+
+- (id _Nullable)reduceValuesWithGrainSize:(NSUInteger)grainSize initialValue:(id _Nullable)initialValue usingBlock:(JFJSONObjectReduceBlock)block combineBlock:(JFJSONNodeCombineBlock)combineBlock
+{
+	NSArray<id<JFJSONValue>>* values = nil;
+	NSArray<NSString*>* keys = [self parallelKeysWithValues:&values];
+	return JFJSONParallelReduce(keys.count, grainSize, initialValue, ^id _Nullable(id _Nullable result, NSUInteger index) {
+		return block(result, [keys objectAtIndex:index], [values objectAtIndex:index]);
+	}, combineBlock);
 }
 
 // =================================================================================================
@@ -480,22 +1131,34 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (id)copyWithZone:(NSZone* _Nullable)zone
 {
-	JFJSONObject* retObj = [self.class new];
-	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = retObj.map;
-	[self enumerateKeysAndValuesUsingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
-		if([value isKindOfClass:JFJSONArray.class]) {
-			[map setObject:[(JFJSONArray*)value copy] forKey:key];
-		} else if([value isKindOfClass:JFJSONObject.class]) {
-			[map setObject:[(JFJSONObject*)value copy] forKey:key];
-		} else if([value isKindOfClass:NSNull.class]) {
-			[map setObject:[(NSNull*)value copy] forKey:key];
-		} else if([value isKindOfClass:NSNumber.class]) {
-			[map setObject:[(NSNumber*)value copy] forKey:key];
-		} else if([value isKindOfClass:NSString.class]) {
-			[map setObject:[(NSString*)value copy] forKey:key];
+	// The copy shares the storage of this object, nodes included, until either of them is changed, or until one of the nodes handed out by this object is about to change: the copy is then left with copies of those nodes (see `cloneStorage`).
+	JFJSONObject* retObj = [[self.class alloc] initWithCapacity:0];
+	retObj->_hashValue = _hashValue;
+	retObj->_map = self.map;
+	retObj->_shape = self.shape;
+	retObj->_values = self.values;
+	
+	// The inline entries can't be shared, so they are copied right away; the nodes among them are shared like the ones of any other storage.
+	for(NSUInteger index = 0; index < _inlineCount; index++)
+	{
+		retObj->_inlineKeys[index] = _inlineKeys[index];
+		retObj->_inlineValues[index] = _inlineValues[index];
+	}
+	retObj->_inlineCount = _inlineCount;
+	
+	// This object can't replace the nodes among the inline entries of the copy: the exposed ones tell the copy directly before changing.
+	if(_exposesNodes)
+	{
+		for(NSUInteger index = 0; index < _inlineCount; index++)
+		{
+			id value = _inlineValues[index];
+			if(JFJSONObjectIsNode(value))
+				[value addOwner:retObj];
 		}
-		return NO;
-	}];
+	}
+	
+	retObj->_sharesStorage = YES;
+	_sharesStorage = YES;
 	return retObj;
 }
 
@@ -505,7 +1168,22 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState*)state objects:(__unsafe_unretained id _Nullable [])buffer count:(NSUInteger)len
 {
-	return [self.map countByEnumeratingWithState:state objects:buffer count:len];
+	JFJSONObjectShape* shape = self.shape;
+	if(shape)
+		return [shape.keys countByEnumeratingWithState:state objects:buffer count:len];
+	
+	NSMutableDictionary<NSString*, id<JFJSONValue>>* map = self.map;
+	if(map)
+		return [map countByEnumeratingWithState:state objects:buffer count:len];
+	
+	// The inline keys are handed out directly, in a single batch.
+	if(state->state != 0)
+		return 0;
+	
+	state->state = 1;
+	state->itemsPtr = (__unsafe_unretained id*)(void*)_inlineKeys;
+	state->mutationsPtr = &_inlineMutations;
+	return _inlineCount;
 }
 
 @end
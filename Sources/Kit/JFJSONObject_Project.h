@@ -0,0 +1,143 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <JFKit/JFJSONObject.h>
+
+@class JFJSONKeyTable;
+@class JFJSONObjectShape;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONObject (/* Project */)
+
+// =================================================================================================
+// MARK: Properties - Comparison
+// =================================================================================================
+
+/**
+ * A 64 bit hash of the content of this object, computed over its keys and values: equal objects have the same structural hash, whatever the order of their keys.
+ * @discussion The hash is cached and computed again only after this object changes; the hashes of the nested nodes are cached as well, so that changing a nested node only affects the path leading to it.
+ */
+@property (assign, nonatomic, readonly) uint64_t structuralHash;
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * The key layout shared with the other objects containing the same set of keys, or `nil` if the values are stored inline (small objects) or in a dictionary.
+ * @discussion While the layout doesn't change, the value associated with each key can be retrieved using `storedValueAtShapeIndex:` and the index of the key in the layout.
+ */
+@property (strong, nonatomic, readonly, nullable) JFJSONObjectShape* shape;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)dictionary keyTable:(JFJSONKeyTable*)keyTable sharingLayout:(BOOL)sharingLayout NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - Comparison
+// =================================================================================================
+
+/**
+ * Returns whether this object and the given one share the same storage, as happens after a copy until either of them is changed: objects sharing their storage are equal.
+ * @discussion Unlike `isEqualToJSONObject:`, this method never visits the stored values, nor computes any hash. A `NO` result does not mean that the objects differ.
+ * @param other The object to check.
+ * @return `YES` if the objects share their storage, `NO` otherwise.
+ */
+- (BOOL)sharesStorageWithJSONObject:(JFJSONObject*)other;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
+/**
+ * Associates the given value, created by an importer, with the given key.
+ * @discussion Unlike `setValue:forKey:`, this method assumes that nobody else references the given value, so that copies of this object can keep sharing its storage.
+ * @param value The value to associate with the given key.
+ * @param key The key to use to store the given value.
+ */
+- (void)importValue:(id<JFJSONValue>)value forKey:(NSString*)key;
+
+/**
+ * Returns the stored value associated with the given key, without handing it out.
+ * @discussion Unlike `valueForKey:`, this method does not detach this object from the storage shared with its copies: the returned node must not be changed, and must be copied to be kept.
+ * @param key The key of the value.
+ * @return The stored value associated with the given key, or `nil` if the object does not contain the given key.
+ */
+- (id<JFJSONValue> _Nullable)storedValueForKey:(NSString*)key;
+
+/**
+ * Returns the stored value at the given index of the key layout, without handing it out.
+ * @discussion The same restrictions of `storedValueForKey:` apply to the returned value.
+ * @param index The index of the key inside `shape`.
+ * @return The stored value at the given index of the key layout.
+ * @warning This method must be called only while `shape` is not `nil`.
+ */
+- (id<JFJSONValue>)storedValueAtShapeIndex:(NSUInteger)index;
+
+// =================================================================================================
+// MARK: Methods - Enumeration
+// =================================================================================================
+
+/**
+ * Applies a given block to the stored keys and values, without handing them out.
+ * @discussion Unlike `enumerateKeysAndValuesWithOptions:usingBlock:`, this method does not detach this object from the storage shared with its copies: the nodes passed to the block must not be changed, nor kept after the enumeration.
+ * @param options Enumeration options.
+ * @param block A block to operate on entries in the JSON object.
+ */
+- (void)enumerateStoredKeysAndValuesWithOptions:(NSEnumerationOptions)options usingBlock:(JFJSONObjectEnumerationBlock)block;
+
+
+// =================================================================================================
+// MARK: Methods - Ownership
+// =================================================================================================
+
+/**
+ * Registers the given container as an owner of this object: the owners are told before this object changes, using `nodeWillChange:`.
+ * @discussion The owners are referenced weakly. Containers register themselves when they hand out this object or are given it by the caller, so that they can stop sharing it with their copies before it changes.
+ * @param owner The container to register.
+ */
+- (void)addOwner:(id)owner;
+
+/**
+ * Tells this object that the given node, stored inside of it, is about to change.
+ * @param node The node that is about to change.
+ */
+- (void)nodeWillChange:(id<JFJSONValue>)node;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
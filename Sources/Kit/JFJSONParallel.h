@@ -0,0 +1,124 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFJSONNode.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Blocks
+// =================================================================================================
+
+/**
+ * A block that filters the element at the given index.
+ * @param index The index of the element.
+ * @return `YES` to keep the element, `NO` to discard it.
+ */
+typedef BOOL (^JFJSONParallelFilterBlock)(NSUInteger index);
+
+/**
+ * A block that transforms the element at the given index.
+ * @param index The index of the element.
+ * @return The result of the transformation.
+ */
+typedef id _Nullable (^JFJSONParallelMapBlock)(NSUInteger index);
+
+/**
+ * A block that folds the element at the given index into a partial result.
+ * @param result The partial result.
+ * @param index The index of the element.
+ * @return The updated partial result.
+ */
+typedef id _Nullable (^JFJSONParallelReduceBlock)(id _Nullable result, NSUInteger index);
+
+/**
+ * A block that reads the value at the given index of a collection that does not change during the operation.
+ * @param index The index of the value.
+ * @return The value at the given index.
+ */
+typedef id<JFJSONValue> _Nonnull (^JFJSONParallelValueReader)(NSUInteger index);
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+/**
+ * Splits the range `[0, count)` into chunks of `grainSize` elements and passes each chunk to the given block, concurrently.
+ * @discussion Chunks are not assigned to the worker threads in advance: each worker takes the next chunk as soon as it finishes the previous one, so workers that get cheaper chunks keep taking work from the others. The function returns after all chunks have been processed.
+ * @param count The number of elements.
+ * @param grainSize The number of elements of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param block The block to apply to each chunk.
+ */
+FOUNDATION_EXPORT void JFJSONParallelApply(NSUInteger count, NSUInteger grainSize, void (^block)(NSUInteger chunk, NSRange range));
+
+/**
+ * Returns the indexes of the elements kept by the given block, evaluated concurrently.
+ * @param count The number of elements.
+ * @param grainSize The number of elements of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param block The block to apply to each element.
+ * @return The indexes of the elements kept by the block.
+ */
+FOUNDATION_EXPORT NSIndexSet* JFJSONParallelFilter(NSUInteger count, NSUInteger grainSize, JFJSONParallelFilterBlock block);
+
+/**
+ * Returns the number of elements of each chunk used to process the given number of elements.
+ * @param count The number of elements.
+ * @param grainSize The requested number of elements of each chunk, or `0` to pick a size based on the number of active processors.
+ * @return The number of elements of each chunk (at least `1`).
+ */
+FOUNDATION_EXPORT NSUInteger JFJSONParallelGrainSize(NSUInteger count, NSUInteger grainSize);
+
+/**
+ * Returns the results of the given block applied to each element, evaluated concurrently and stored in order.
+ * @param count The number of elements.
+ * @param grainSize The number of elements of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param block The block to apply to each element; `nil` results are stored as `NSNull`.
+ * @return The results of the block, in the order of the elements.
+ */
+FOUNDATION_EXPORT NSArray* JFJSONParallelMap(NSUInteger count, NSUInteger grainSize, JFJSONParallelMapBlock block);
+
+/**
+ * Reduces the elements to a single result: each chunk is folded concurrently starting from the initial value, then the partial results of the chunks are combined in order.
+ * @param count The number of elements.
+ * @param grainSize The number of elements of each chunk, or `0` to pick a size based on the number of active processors.
+ * @param initialValue The value each chunk starts from; it's also the result if there are no elements.
+ * @param block The block that folds an element into a partial result.
+ * @param combineBlock The block that combines the partial results of two adjacent chunks.
+ * @return The result of the reduction.
+ */
+FOUNDATION_EXPORT id _Nullable JFJSONParallelReduce(NSUInteger count, NSUInteger grainSize, id _Nullable initialValue, JFJSONParallelReduceBlock block, JFJSONNodeCombineBlock combineBlock);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,170 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONParallel.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+void JFJSONParallelApply(NSUInteger count, NSUInteger grainSize, void (^block)(NSUInteger chunk, NSRange range))
+{
+	if(count == 0)
+		return;
+	
+	grainSize = JFJSONParallelGrainSize(count, grainSize);
+	size_t chunks = (count + grainSize - 1) / grainSize;
+	if(chunks == 1)
+	{
+		block(0, NSMakeRange(0, count));
+		return;
+	}
+	
+	// The iterations of `dispatch_apply` are handed out one at a time to the worker threads of the pool as they become idle, so uneven chunks are balanced automatically.
+	dispatch_apply(chunks, DISPATCH_APPLY_AUTO, ^(size_t chunk) {
+		NSUInteger location = chunk * grainSize;
+		block(chunk, NSMakeRange(location, MIN(grainSize, count - location)));
+	});
+}
+
+NSIndexSet* JFJSONParallelFilter(NSUInteger count, NSUInteger grainSize, JFJSONParallelFilterBlock block)
+{
+	if(count == 0)
+		return [NSIndexSet indexSet];
+	
+	// Each chunk writes only its own flags, so no synchronization is needed.
+	BOOL* flags = calloc(count, sizeof(BOOL));
+	if(!flags)
+	{
+		// Without the flags the chunks can't be evaluated concurrently: the elements are filtered serially instead.
+		NSMutableIndexSet* retObj = [NSMutableIndexSet indexSet];
+		for(NSUInteger index = 0; index < count; index++)
+		{
+			if(block(index))
+				[retObj addIndex:index];
+		}
+		return [retObj copy];
+	}
+	
+	JFJSONParallelApply(count, grainSize, ^(NSUInteger chunk, NSRange range) {
+		for(NSUInteger index = range.location; index < NSMaxRange(range); index++)
+			flags[index] = block(index);
+	});
+	
+	NSMutableIndexSet* retObj = [NSMutableIndexSet indexSet];
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		if(flags[index])
+			[retObj addIndex:index];
+	}
+	free(flags);
+	return [retObj copy];
+}
+
+NSUInteger JFJSONParallelGrainSize(NSUInteger count, NSUInteger grainSize)
+{
+	if(grainSize > 0)
+		return grainSize;
+	
+	// A few chunks per processor leave room to balance the load when the cost of the elements is uneven.
+	NSUInteger chunks = NSProcessInfo.processInfo.activeProcessorCount * 8;
+	return MAX((count + chunks - 1) / chunks, 1);
+}
+
+NSArray* JFJSONParallelMap(NSUInteger count, NSUInteger grainSize, JFJSONParallelMapBlock block)
+{
+	if(count == 0)
+		return @[];
+	
+	// Each chunk writes only its own slots, so no synchronization is needed.
+	__strong id* results = (__strong id*)calloc(count, sizeof(id));
+	if(!results)
+	{
+		// Without the slots the chunks can't be evaluated concurrently: the elements are transformed serially instead.
+		NSMutableArray* retObj = [NSMutableArray arrayWithCapacity:count];
+		for(NSUInteger index = 0; index < count; index++)
+			[retObj addObject:(block(index) ?: NSNull.null)];
+		return [retObj copy];
+	}
+	
+	JFJSONParallelApply(count, grainSize, ^(NSUInteger chunk, NSRange range) {
+		for(NSUInteger index = range.location; index < NSMaxRange(range); index++)
+			results[index] = (block(index) ?: NSNull.null);
+	});
+	
+	NSArray* retObj = [NSArray arrayWithObjects:results count:count];
+	for(NSUInteger index = 0; index < count; index++)
+		results[index] = nil;
+	free(results);
+	return retObj;
+}
+
+id _Nullable JFJSONParallelReduce(NSUInteger count, NSUInteger grainSize, id _Nullable initialValue, JFJSONParallelReduceBlock block, JFJSONNodeCombineBlock combineBlock)
+{
+	if(count == 0)
+		return initialValue;
+	
+	grainSize = JFJSONParallelGrainSize(count, grainSize);
+	NSUInteger chunks = (count + grainSize - 1) / grainSize;
+	
+	__strong id* partials = (__strong id*)calloc(chunks, sizeof(id));
+	if(!partials)
+	{
+		// Without the partial results the chunks can't be folded concurrently: the elements are folded serially instead, as a single chunk.
+		id retObj = initialValue;
+		for(NSUInteger index = 0; index < count; index++)
+			retObj = block(retObj, index);
+		return retObj;
+	}
+	
+	JFJSONParallelApply(count, grainSize, ^(NSUInteger chunk, NSRange range) {
+		id result = initialValue;
+		for(NSUInteger index = range.location; index < NSMaxRange(range); index++)
+			result = block(result, index);
+		partials[chunk] = result;
+	});
+	
+	id retObj = partials[0];
+	for(NSUInteger chunk = 1; chunk < chunks; chunk++)
+		retObj = combineBlock(retObj, partials[chunk]);
+	
+	for(NSUInteger chunk = 0; chunk < chunks; chunk++)
+		partials[chunk] = nil;
+	free(partials);
+	return retObj;
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
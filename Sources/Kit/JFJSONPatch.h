@@ -0,0 +1,121 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFJSONArray.h>
+#import <JFKit/JFJSONObject.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * The `JFJSONPatch` class represents a JSON Patch (RFC 6902): a list of operations that changes a JSON object into another one, so that only the differences between two versions of a document need to be sent.
+ * @discussion Each operation is a JSON object containing the keys `op` (one among `add`, `remove`, `replace`, `move`, `copy` and `test`), `path` (a JSON Pointer) and, depending on the operation, `value` or `from`. The class also supports JSON Merge Patch (RFC 7386), where the patch is a JSON object mirroring the changed keys of the document and `null` marks the removed ones.
+ * When computing the differences between two JSON objects, nested nodes with different structural hashes are known to differ without being compared, and nodes sharing their storage after a copy are known to be equal without being visited.
+ * @warning Instances of this class are immutable and can be applied concurrently to different objects.
+ */
+@interface JFJSONPatch : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * The operations of the patch, in order; the returned array can be converted to JSON data/string to be sent.
+ */
+@property (copy, nonatomic, readonly) JFJSONArray* operations;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+/**
+ * Creates a new patch containing the operations that change the source object into the target object.
+ * @param source The original object.
+ * @param target The changed object.
+ * @return A new patch; it's empty if the two objects are equal.
+ */
++ (instancetype)patchFromObject:(JFJSONObject*)source toObject:(JFJSONObject*)target;
+
+/**
+ * Creates a new patch with the given operations.
+ * @param operations The operations of the patch.
+ * @return A new patch, or `nil` if any of the operations is not valid.
+ */
++ (instancetype _Nullable)patchWithOperations:(JFJSONArray*)operations;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes this instance with the given operations.
+ * @param operations The operations of the patch.
+ * @return This instance, or `nil` if any of the operations is not valid.
+ */
+- (instancetype _Nullable)initWithOperations:(JFJSONArray*)operations NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - Application
+// =================================================================================================
+
+/**
+ * Applies the operations of the patch to the given object, in order.
+ * @discussion The patch is applied atomically: if any operation fails (including a failed `test`), the object is left unchanged.
+ * @param object The object to change.
+ * @return `YES` if all the operations have been applied, `NO` otherwise.
+ */
+- (BOOL)applyToObject:(JFJSONObject*)object;
+
+// =================================================================================================
+// MARK: Methods - Merge patch
+// =================================================================================================
+
+/**
+ * Applies the given merge patch to the given object.
+ * @param patch The merge patch to apply: each key associated with `null` is removed from the object, each key associated with an object is merged recursively and each other key replaces the value of the object.
+ * @param object The object to change.
+ */
++ (void)applyMergePatch:(JFJSONObject*)patch toObject:(JFJSONObject*)object;
+
+/**
+ * Returns the merge patch that changes the source object into the target object.
+ * @discussion A merge patch can't represent values set to `null` (they are removed instead) and replaces arrays as a whole; use `patchFromObject:toObject:` when either matters.
+ * @param source The original object.
+ * @param target The changed object.
+ * @return The merge patch; it's empty if the two objects are equal.
+ */
++ (JFJSONObject*)mergePatchFromObject:(JFJSONObject*)source toObject:(JFJSONObject*)target;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
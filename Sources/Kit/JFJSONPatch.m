@@ -0,0 +1,703 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONPatch.h"
+
+#import "JFJSONArray_Project.h"
+#import "JFJSONObject_Project.h"
+#import "JFJSONValueKind.h"
+#import "JFKitLogger.h"
+#import "JFShortcuts.h"
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * The operations supported by JSON Patch.
+ */
+typedef NS_ENUM(UInt8, JFJSONPatchOperationKind)
+{
+	/**
+	 * Adds a value to an object or inserts it into an array.
+	 */
+	JFJSONPatchOperationKindAdd,
+	
+	/**
+	 * Copies the value at the `from` location to the target location.
+	 */
+	JFJSONPatchOperationKindCopy,
+	
+	/**
+	 * Removes the value at the `from` location and adds it to the target location.
+	 */
+	JFJSONPatchOperationKindMove,
+	
+	/**
+	 * Removes the value at the target location.
+	 */
+	JFJSONPatchOperationKindRemove,
+	
+	/**
+	 * Replaces the value at the target location.
+	 */
+	JFJSONPatchOperationKindReplace,
+	
+	/**
+	 * Checks that the value at the target location is equal to the given value.
+	 */
+	JFJSONPatchOperationKindTest,
+};
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * A validated operation of a JSON Patch, with its pointers already split into reference tokens.
+ */
+@interface JFJSONPatchOperation : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@property (copy, nonatomic, nullable) NSArray<NSString*>* from;
+@property (assign, nonatomic) JFJSONPatchOperationKind kind;
+@property (copy, nonatomic) NSArray<NSString*>* path;
+@property (strong, nonatomic, nullable) id<JFJSONValue> value;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+static void JFJSONPatchDiff(id<JFJSONValue> source, id<JFJSONValue> target, NSString* path, JFJSONArray* operations);
+static JFJSONObject* JFJSONPatchMergeDiff(JFJSONObject* source, JFJSONObject* target);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+static id<JFJSONValue> JFJSONPatchCopyValue(id<JFJSONValue> value)
+{
+	// Nodes are copied, so that the patch and the documents never share mutable state; copies share their storage until either side changes.
+	JFJSONValueKind kind = JFJSONValueKindOf(value);
+	return (((kind == JFJSONValueKindArray) || (kind == JFJSONValueKindObject)) ? [(NSObject*)value copy] : value);
+}
+
+static NSString* JFJSONPatchEscapeToken(NSString* token)
+{
+	if([token rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"~/"]].location == NSNotFound)
+		return token;
+	
+	return [[token stringByReplacingOccurrencesOfString:@"~" withString:@"~0"] stringByReplacingOccurrencesOfString:@"/" withString:@"~1"];
+}
+
+static BOOL JFJSONPatchIsEqual(id<JFJSONValue> _Nullable value, id<JFJSONValue> _Nullable other)
+{
+	if(value == other)
+		return YES;
+	
+	JFJSONValueKind kind = JFJSONValueKindOf(value);
+	if(kind != JFJSONValueKindOf(other))
+		return NO;
+	
+	// Nodes sharing their storage after a copy are equal, and nodes with different structural hashes can't be equal: the hashes are cached by each node, so unchanged subtrees are accepted or rejected without being visited.
+	if(kind == JFJSONValueKindArray)
+	{
+		if([(JFJSONArray*)value sharesStorageWithJSONArray:(JFJSONArray*)other])
+			return YES;
+		if(((JFJSONArray*)value).structuralHash != ((JFJSONArray*)other).structuralHash)
+			return NO;
+	}
+	else if(kind == JFJSONValueKindObject)
+	{
+		if([(JFJSONObject*)value sharesStorageWithJSONObject:(JFJSONObject*)other])
+			return YES;
+		if(((JFJSONObject*)value).structuralHash != ((JFJSONObject*)other).structuralHash)
+			return NO;
+	}
+	
+	return [(NSObject*)value isEqual:other];
+}
+
+static NSUInteger JFJSONPatchParseIndex(NSString* token, NSUInteger count, BOOL allowsEnd)
+{
+	// Indexes are made of digits only, without leading zeros; `-` stands for the index following the last element.
+	if(allowsEnd && [token isEqualToString:@"-"])
+		return count;
+	
+	NSUInteger length = token.length;
+	if((length == 0) || (length > 19) || ((length > 1) && ([token characterAtIndex:0] == '0')))
+		return NSNotFound;
+	
+	NSUInteger retVal = 0;
+	for(NSUInteger index = 0; index < length; index++)
+	{
+		unichar character = [token characterAtIndex:index];
+		if((character < '0') || (character > '9'))
+			return NSNotFound;
+		retVal = retVal * 10 + (NSUInteger)(character - '0');
+	}
+	
+	return (((retVal < count) || (allowsEnd && (retVal == count))) ? retVal : NSNotFound);
+}
+
+static NSArray<NSString*>* _Nullable JFJSONPatchParsePointer(NSString* pointer)
+{
+	if(pointer.length == 0)
+		return @[];
+	
+	if(![pointer hasPrefix:@"/"])
+		return nil;
+	
+	NSArray<NSString*>* components = [[pointer substringFromIndex:1] componentsSeparatedByString:@"/"];
+	NSMutableArray<NSString*>* retObj = [[NSMutableArray<NSString*> alloc] initWithCapacity:components.count];
+	for(NSString* component in components)
+	{
+		NSRange range = [component rangeOfString:@"~"];
+		if(range.location == NSNotFound)
+		{
+			[retObj addObject:component];
+			continue;
+		}
+		
+		// Each `~` must be followed by `0` or `1`; `~1` is decoded first, so that `~01` becomes `~1` and not `/`.
+		NSUInteger length = component.length;
+		for(NSUInteger index = range.location; index < length; index++)
+		{
+			if([component characterAtIndex:index] != '~')
+				continue;
+			
+			if((index + 1 >= length) || (([component characterAtIndex:(index + 1)] != '0') && ([component characterAtIndex:(index + 1)] != '1')))
+				return nil;
+		}
+		[retObj addObject:[[component stringByReplacingOccurrencesOfString:@"~1" withString:@"/"] stringByReplacingOccurrencesOfString:@"~0" withString:@"~"]];
+	}
+	return retObj;
+}
+
+static id<JFJSONValue> _Nullable JFJSONPatchResolve(JFJSONObject* root, NSArray<NSString*>* tokens, NSUInteger count)
+{
+	// Values are resolved through the public accessors: the nodes along the path are about to be changed, so they must be detached from the storage shared with other copies.
+	id<JFJSONValue> retObj = root;
+	for(NSUInteger index = 0; (index < count) && retObj; index++)
+	{
+		NSString* token = tokens[index];
+		switch(JFJSONValueKindOf(retObj))
+		{
+			case JFJSONValueKindArray:
+			{
+				JFJSONArray* array = (JFJSONArray*)retObj;
+				NSUInteger position = JFJSONPatchParseIndex(token, array.count, NO);
+				retObj = ((position == NSNotFound) ? nil : [array valueAtIndex:position]);
+				break;
+			}
+			case JFJSONValueKindObject:
+				retObj = [(JFJSONObject*)retObj valueForKey:token];
+				break;
+			default:
+				retObj = nil;
+				break;
+		}
+	}
+	return retObj;
+}
+
+static BOOL JFJSONPatchAdd(JFJSONObject* __strong _Nonnull* _Nonnull root, NSArray<NSString*>* tokens, id<JFJSONValue> value)
+{
+	NSUInteger count = tokens.count;
+	if(count == 0)
+	{
+		if(JFJSONValueKindOf(value) != JFJSONValueKindObject)
+			return NO;
+		*root = (JFJSONObject*)value;
+		return YES;
+	}
+	
+	id<JFJSONValue> parent = JFJSONPatchResolve(*root, tokens, count - 1);
+	NSString* token = tokens.lastObject;
+	switch(JFJSONValueKindOf(parent))
+	{
+		case JFJSONValueKindArray:
+		{
+			JFJSONArray* array = (JFJSONArray*)parent;
+			NSUInteger index = JFJSONPatchParseIndex(token, array.count, YES);
+			if(index == NSNotFound)
+				return NO;
+			if(index == array.count)
+				[array addValue:value];
+			else
+				[array insertValue:value atIndex:index];
+			return YES;
+		}
+		case JFJSONValueKindObject:
+			[(JFJSONObject*)parent setValue:value forKey:token];
+			return YES;
+		default:
+			return NO;
+	}
+}
+
+static id<JFJSONValue> _Nullable JFJSONPatchRemove(JFJSONObject* root, NSArray<NSString*>* tokens)
+{
+	NSUInteger count = tokens.count;
+	if(count == 0)
+		return nil;
+	
+	id<JFJSONValue> parent = JFJSONPatchResolve(root, tokens, count - 1);
+	NSString* token = tokens.lastObject;
+	id<JFJSONValue> retObj = nil;
+	switch(JFJSONValueKindOf(parent))
+	{
+		case JFJSONValueKindArray:
+		{
+			JFJSONArray* array = (JFJSONArray*)parent;
+			NSUInteger index = JFJSONPatchParseIndex(token, array.count, NO);
+			if(index != NSNotFound)
+			{
+				retObj = [array valueAtIndex:index];
+				[array removeValueAtIndex:index];
+			}
+			break;
+		}
+		case JFJSONValueKindObject:
+		{
+			JFJSONObject* object = (JFJSONObject*)parent;
+			retObj = [object valueForKey:token];
+			if(retObj)
+				[object removeValueForKey:token];
+			break;
+		}
+		default:
+			break;
+	}
+	return retObj;
+}
+
+static BOOL JFJSONPatchReplace(JFJSONObject* __strong _Nonnull* _Nonnull root, NSArray<NSString*>* tokens, id<JFJSONValue> value)
+{
+	NSUInteger count = tokens.count;
+	if(count == 0)
+		return JFJSONPatchAdd(root, tokens, value);
+	
+	id<JFJSONValue> parent = JFJSONPatchResolve(*root, tokens, count - 1);
+	NSString* token = tokens.lastObject;
+	switch(JFJSONValueKindOf(parent))
+	{
+		case JFJSONValueKindArray:
+		{
+			JFJSONArray* array = (JFJSONArray*)parent;
+			NSUInteger index = JFJSONPatchParseIndex(token, array.count, NO);
+			if(index == NSNotFound)
+				return NO;
+			[array replaceWithValue:value atIndex:index];
+			return YES;
+		}
+		case JFJSONValueKindObject:
+		{
+			JFJSONObject* object = (JFJSONObject*)parent;
+			if(![object hasValueForKey:token])
+				return NO;
+			[object setValue:value forKey:token];
+			return YES;
+		}
+		default:
+			return NO;
+	}
+}
+
+static BOOL JFJSONPatchApplyOperation(JFJSONPatchOperation* operation, JFJSONObject* __strong _Nonnull* _Nonnull root)
+{
+	NSArray<NSString*>* path = operation.path;
+	switch(operation.kind)
+	{
+		case JFJSONPatchOperationKindAdd:
+			return JFJSONPatchAdd(root, path, JFJSONPatchCopyValue(operation.value));
+		case JFJSONPatchOperationKindCopy:
+		{
+			NSArray<NSString*>* from = operation.from;
+			id<JFJSONValue> value = JFJSONPatchResolve(*root, from, from.count);
+			return (value && JFJSONPatchAdd(root, path, JFJSONPatchCopyValue(value)));
+		}
+		case JFJSONPatchOperationKindMove:
+		{
+			NSArray<NSString*>* from = operation.from;
+			if([from isEqualToArray:path])
+				return (JFJSONPatchResolve(*root, from, from.count) != nil);
+			id<JFJSONValue> value = JFJSONPatchRemove(*root, from);
+			return (value && JFJSONPatchAdd(root, path, value));
+		}
+		case JFJSONPatchOperationKindRemove:
+			return (JFJSONPatchRemove(*root, path) != nil);
+		case JFJSONPatchOperationKindReplace:
+			return JFJSONPatchReplace(root, path, JFJSONPatchCopyValue(operation.value));
+		case JFJSONPatchOperationKindTest:
+			return JFJSONPatchIsEqual(JFJSONPatchResolve(*root, path, path.count), operation.value);
+	}
+	return NO;
+}
+
+static void JFJSONPatchAppendOperation(JFJSONArray* operations, NSString* kind, NSString* path, id<JFJSONValue> _Nullable value)
+{
+	JFJSONObject* operation = [[JFJSONObject alloc] initWithCapacity:(value ? 3 : 2)];
+	[operation setString:kind forKey:@"op"];
+	[operation setString:path forKey:@"path"];
+	if(value)
+		[operation setValue:JFJSONPatchCopyValue(value) forKey:@"value"];
+	[operations addObject:operation];
+}
+
+static void JFJSONPatchDiffArrays(JFJSONArray* source, JFJSONArray* target, NSString* path, JFJSONArray* operations)
+{
+	// The common prefix and suffix are skipped, so that inserting or removing values in the middle produces one operation per value; the remaining values are compared pairwise.
+	NSUInteger sourceCount = source.count;
+	NSUInteger targetCount = target.count;
+	NSUInteger minCount = MIN(sourceCount, targetCount);
+	
+	NSUInteger prefix = 0;
+	while((prefix < minCount) && JFJSONPatchIsEqual([source storedValueAtIndex:prefix], [target storedValueAtIndex:prefix]))
+		prefix++;
+	
+	NSUInteger suffix = 0;
+	while((suffix < minCount - prefix) && JFJSONPatchIsEqual([source storedValueAtIndex:(sourceCount - suffix - 1)], [target storedValueAtIndex:(targetCount - suffix - 1)]))
+		suffix++;
+	
+	NSUInteger sourceEnd = sourceCount - suffix;
+	NSUInteger targetEnd = targetCount - suffix;
+	NSUInteger common = MIN(sourceEnd, targetEnd) - prefix;
+	for(NSUInteger index = prefix; index < prefix + common; index++)
+		JFJSONPatchDiff([source storedValueAtIndex:index], [target storedValueAtIndex:index], [NSString stringWithFormat:@"%@/%@", path, JFStringFromNSUInteger(index)], operations);
+	
+	// Values are removed from the last one, so that the indexes of the following operations stay valid.
+	for(NSUInteger index = sourceEnd; index > prefix + common; index--)
+		JFJSONPatchAppendOperation(operations, @"remove", [NSString stringWithFormat:@"%@/%@", path, JFStringFromNSUInteger(index - 1)], nil);
+	
+	for(NSUInteger index = prefix + common; index < targetEnd; index++)
+		JFJSONPatchAppendOperation(operations, @"add", [NSString stringWithFormat:@"%@/%@", path, JFStringFromNSUInteger(index)], [target storedValueAtIndex:index]);
+}
+
+static void JFJSONPatchDiffObjects(JFJSONObject* source, JFJSONObject* target, NSString* path, JFJSONArray* operations)
+{
+	[source enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		NSString* childPath = [NSString stringWithFormat:@"%@/%@", path, JFJSONPatchEscapeToken(key)];
+		id<JFJSONValue> targetValue = [target storedValueForKey:key];
+		if(targetValue)
+			JFJSONPatchDiff(value, targetValue, childPath, operations);
+		else
+			JFJSONPatchAppendOperation(operations, @"remove", childPath, nil);
+		return NO;
+	}];
+	
+	[target enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		if(![source storedValueForKey:key])
+			JFJSONPatchAppendOperation(operations, @"add", [NSString stringWithFormat:@"%@/%@", path, JFJSONPatchEscapeToken(key)], value);
+		return NO;
+	}];
+}
+
+static void JFJSONPatchDiff(id<JFJSONValue> source, id<JFJSONValue> target, NSString* path, JFJSONArray* operations)
+{
+	if(JFJSONPatchIsEqual(source, target))
+		return;
+	
+	JFJSONValueKind kind = JFJSONValueKindOf(source);
+	if(kind == JFJSONValueKindOf(target))
+	{
+		if(kind == JFJSONValueKindArray)
+		{
+			JFJSONPatchDiffArrays((JFJSONArray*)source, (JFJSONArray*)target, path, operations);
+			return;
+		}
+		
+		if(kind == JFJSONValueKindObject)
+		{
+			JFJSONPatchDiffObjects((JFJSONObject*)source, (JFJSONObject*)target, path, operations);
+			return;
+		}
+	}
+	
+	JFJSONPatchAppendOperation(operations, @"replace", path, target);
+}
+
+static void JFJSONPatchMerge(JFJSONObject* object, JFJSONObject* patch)
+{
+	[patch enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		switch(JFJSONValueKindOf(value))
+		{
+			case JFJSONValueKindNull:
+				[object removeValueForKey:key];
+				break;
+			case JFJSONValueKindObject:
+			{
+				// A nested patch is merged into the existing object, or into a new one if the existing value is not an object: either way, its `null` values are dropped.
+				JFJSONObject* child = [object objectForKey:key];
+				if(!child)
+				{
+					child = [JFJSONObject new];
+					[object setObject:child forKey:key];
+				}
+				JFJSONPatchMerge(child, (JFJSONObject*)value);
+				break;
+			}
+			default:
+				[object setValue:JFJSONPatchCopyValue(value) forKey:key];
+				break;
+		}
+		return NO;
+	}];
+}
+
+static JFJSONObject* JFJSONPatchMergeDiff(JFJSONObject* source, JFJSONObject* target)
+{
+	JFJSONObject* retObj = [JFJSONObject new];
+	
+	[source enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		if(![target storedValueForKey:key])
+			[retObj setNullForKey:key];
+		return NO;
+	}];
+	
+	[target enumerateStoredKeysAndValuesWithOptions:0 usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		id<JFJSONValue> sourceValue = [source storedValueForKey:key];
+		if(JFJSONPatchIsEqual(sourceValue, value))
+			return NO;
+		
+		if((JFJSONValueKindOf(sourceValue) == JFJSONValueKindObject) && (JFJSONValueKindOf(value) == JFJSONValueKindObject))
+			[retObj setObject:JFJSONPatchMergeDiff((JFJSONObject*)sourceValue, (JFJSONObject*)value) forKey:key];
+		else
+			[retObj setValue:JFJSONPatchCopyValue(value) forKey:key];
+		return NO;
+	}];
+	
+	return retObj;
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONPatch (/* Private */)
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@property (copy, nonatomic, readonly) NSArray<JFJSONPatchOperation*>* compiledOperations;
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
++ (JFJSONPatchOperation* _Nullable)compileOperation:(id<JFJSONValue>)operation;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONPatch
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize compiledOperations = _compiledOperations;
+@synthesize operations = _operations;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
++ (instancetype)patchFromObject:(JFJSONObject*)source toObject:(JFJSONObject*)target
+{
+	JFJSONArray* operations = [JFJSONArray new];
+	JFJSONPatchDiff(source, target, @"", operations);
+	return [[self alloc] initWithOperations:operations];
+}
+
++ (instancetype _Nullable)patchWithOperations:(JFJSONArray*)operations
+{
+	return [[self alloc] initWithOperations:operations];
+}
+
+- (instancetype _Nullable)initWithOperations:(JFJSONArray*)operations
+{
+	self = [super init];
+	
+	NSUInteger count = operations.count;
+	NSMutableArray<JFJSONPatchOperation*>* compiledOperations = [[NSMutableArray<JFJSONPatchOperation*> alloc] initWithCapacity:count];
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		JFJSONPatchOperation* compiledOperation = [[self class] compileOperation:[operations storedValueAtIndex:index]];
+		if(!compiledOperation)
+		{
+			[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Invalid JSON patch operation. [index = '%@']", ClassName, JFStringFromPointer(self), JFStringFromNSUInteger(index)] tags:JFLoggerTagsError];
+			return nil;
+		}
+		[compiledOperations addObject:compiledOperation];
+	}
+	
+	_compiledOperations = [compiledOperations copy];
+	_operations = [operations copy];
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Application
+// =================================================================================================
+
+- (BOOL)applyToObject:(JFJSONObject*)object
+{
+	NSArray<JFJSONPatchOperation*>* compiledOperations = self.compiledOperations;
+	if(compiledOperations.count == 0)
+		return YES;
+	
+	// The operations are applied to a copy, which shares the storage of the object until it's changed: if any operation fails, the object is left untouched.
+	JFJSONObject* result = [object copy];
+	for(JFJSONPatchOperation* operation in compiledOperations)
+	{
+		if(!JFJSONPatchApplyOperation(operation, &result))
+			return NO;
+	}
+	
+	[object removeAllValues];
+	[result enumerateKeysAndValuesUsingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		[object setValue:value forKey:key];
+		return NO;
+	}];
+	return YES;
+}
+
+// =================================================================================================
+// MARK: Methods - Data
+// =================================================================================================
+
++ (JFJSONPatchOperation* _Nullable)compileOperation:(id<JFJSONValue>)operation
+{
+	if(JFJSONValueKindOf(operation) != JFJSONValueKindObject)
+		return nil;
+	
+	JFJSONObject* object = (JFJSONObject*)operation;
+	NSString* kindString = [object stringForKey:@"op"];
+	NSString* pathString = [object stringForKey:@"path"];
+	NSArray<NSString*>* path = (pathString ? JFJSONPatchParsePointer(pathString) : nil);
+	if(!kindString || !path)
+		return nil;
+	
+	static NSDictionary<NSString*, NSNumber*>* kinds = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		kinds = @{@"add": @(JFJSONPatchOperationKindAdd), @"copy": @(JFJSONPatchOperationKindCopy), @"move": @(JFJSONPatchOperationKindMove), @"remove": @(JFJSONPatchOperationKindRemove), @"replace": @(JFJSONPatchOperationKindReplace), @"test": @(JFJSONPatchOperationKindTest)};
+	});
+	
+	NSNumber* kind = kinds[kindString];
+	if(!kind)
+		return nil;
+	
+	JFJSONPatchOperation* retObj = [JFJSONPatchOperation new];
+	retObj.kind = (JFJSONPatchOperationKind)kind.unsignedCharValue;
+	retObj.path = path;
+	
+	switch(retObj.kind)
+	{
+		case JFJSONPatchOperationKindAdd:
+		case JFJSONPatchOperationKindReplace:
+		case JFJSONPatchOperationKindTest:
+		{
+			id<JFJSONValue> value = [object storedValueForKey:@"value"];
+			if(!value)
+				return nil;
+			retObj.value = JFJSONPatchCopyValue(value);
+			break;
+		}
+		case JFJSONPatchOperationKindCopy:
+		case JFJSONPatchOperationKindMove:
+		{
+			NSString* fromString = [object stringForKey:@"from"];
+			NSArray<NSString*>* from = (fromString ? JFJSONPatchParsePointer(fromString) : nil);
+			if(!from)
+				return nil;
+			
+			// A value can't be moved into one of its children.
+			if((retObj.kind == JFJSONPatchOperationKindMove) && (from.count < path.count) && [[path subarrayWithRange:NSMakeRange(0, from.count)] isEqualToArray:from])
+				return nil;
+			retObj.from = from;
+			break;
+		}
+		default:
+			break;
+	}
+	
+	return retObj;
+}
+
+// =================================================================================================
+// MARK: Methods - Merge patch
+// =================================================================================================
+
++ (void)applyMergePatch:(JFJSONObject*)patch toObject:(JFJSONObject*)object
+{
+	JFJSONPatchMerge(object, patch);
+}
+
++ (JFJSONObject*)mergePatchFromObject:(JFJSONObject*)source toObject:(JFJSONObject*)target
+{
+	return JFJSONPatchMergeDiff(source, target);
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONPatchOperation
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize from = _from;
+@synthesize kind = _kind;
+@synthesize path = _path;
+@synthesize value = _value;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,133 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFJSONNode.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * The `JFJSONPath` class represents a compiled query that selects values inside JSON content: a path is parsed once and can be evaluated any number of times, against JSON nodes or directly against JSON data.
+ * @discussion A path can be created from two kinds of strings:
+ *   - a JSON Pointer (RFC 6901), like `/items/0/name`, where `~1` stands for `/` and `~0` stands for `~`; the empty string selects the root.
+ *   - an expression, made of a subset of the JSONPath syntax: it starts with `$` and continues with any number of steps among `.name`, `['name']`, `[index]` (negative indexes count from the end of the array), `.*` and `[*]` (all the children of the current node) and filters like `[?(@.name)]` (the children containing the key `name`) or `[?(@.name == 'value')]` (the children whose key `name` is associated with the given value); filters support the operators `==`, `!=`, `<`, `<=`, `>` and `>=`, compare strings, numbers, booleans and `null` and can refer to the child itself using `@` alone.
+ * When evaluated against JSON data, the subtrees that are not part of the path are skipped without being decoded, and only the selected values are converted to SDK native data objects.
+ * @warning Instances of this class are immutable and can be evaluated concurrently.
+ */
+@interface JFJSONPath : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * Returns `YES` if the path can select at most one value, that is when it does not contain wildcards nor filters.
+ */
+@property (assign, nonatomic, readonly, getter=isSingular) BOOL singular;
+
+/**
+ * The string the path has been created from.
+ */
+@property (copy, nonatomic, readonly) NSString* string;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+/**
+ * Creates a new path from the given expression.
+ * @param expression The expression to parse.
+ * @return A new path, or `nil` if the expression is not valid.
+ */
++ (instancetype _Nullable)pathWithExpression:(NSString*)expression;
+
+/**
+ * Creates a new path from the given JSON Pointer.
+ * @param pointer The JSON Pointer to parse.
+ * @return A new path, or `nil` if the pointer is not valid.
+ */
++ (instancetype _Nullable)pathWithPointer:(NSString*)pointer;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes this instance with the given expression.
+ * @param expression The expression to parse.
+ * @return This instance, or `nil` if the expression is not valid.
+ */
+- (instancetype _Nullable)initWithExpression:(NSString*)expression;
+
+/**
+ * Initializes this instance with the given JSON Pointer.
+ * @param pointer The JSON Pointer to parse.
+ * @return This instance, or `nil` if the pointer is not valid.
+ */
+- (instancetype _Nullable)initWithPointer:(NSString*)pointer;
+
+// =================================================================================================
+// MARK: Methods - Evaluation
+// =================================================================================================
+
+/**
+ * Returns the first value selected by the path inside the given JSON data.
+ * @param data The UTF-8 encoded JSON data to scan.
+ * @return The first selected value converted to SDK native data objects, or `nil` if the path does not select anything or if the scanned data is not valid.
+ */
+- (id<JFJSONConvertibleValue> _Nullable)firstValueInData:(NSData*)data;
+
+/**
+ * Returns the first value selected by the path inside the given JSON node.
+ * @param node The JSON node to query.
+ * @return The first selected value, or `nil` if the path does not select anything.
+ */
+- (id<JFJSONValue> _Nullable)firstValueInNode:(id<JFJSONNode>)node;
+
+/**
+ * Returns all the values selected by the path inside the given JSON data, in document order.
+ * @param data The UTF-8 encoded JSON data to scan.
+ * @return The selected values converted to SDK native data objects, or `nil` if the scanned data is not valid.
+ */
+- (NSArray<id<JFJSONConvertibleValue>>* _Nullable)valuesInData:(NSData*)data;
+
+/**
+ * Returns all the values selected by the path inside the given JSON node, in the order they are found while enumerating the nodes.
+ * @param node The JSON node to query.
+ * @return The selected values.
+ */
+- (NSArray<id<JFJSONValue>>*)valuesInNode:(id<JFJSONNode>)node;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
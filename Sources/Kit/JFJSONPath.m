@@ -0,0 +1,943 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONPath.h"
+
+#import "JFJSONArray.h"
+#import "JFJSONDocument.h"
+#import "JFJSONObject.h"
+#import "JFKitLogger.h"
+#import "JFShortcuts.h"
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+typedef NS_ENUM(UInt8, JFJSONPathOperator)
+{
+	/**
+	 * The compared value exists.
+	 */
+	JFJSONPathOperatorExists,
+	
+	/**
+	 * The compared value is equal to the literal.
+	 */
+	JFJSONPathOperatorEqual,
+	
+	/**
+	 * The compared value is greater than the literal.
+	 */
+	JFJSONPathOperatorGreater,
+	
+	/**
+	 * The compared value is greater than or equal to the literal.
+	 */
+	JFJSONPathOperatorGreaterOrEqual,
+	
+	/**
+	 * The compared value is less than the literal.
+	 */
+	JFJSONPathOperatorLess,
+	
+	/**
+	 * The compared value is less than or equal to the literal.
+	 */
+	JFJSONPathOperatorLessOrEqual,
+	
+	/**
+	 * The compared value is not equal to the literal.
+	 */
+	JFJSONPathOperatorNotEqual,
+};
+
+typedef NS_ENUM(UInt8, JFJSONPathStepKind)
+{
+	/**
+	 * Selects the children of the current node that satisfy a predicate.
+	 */
+	JFJSONPathStepKindFilter,
+	
+	/**
+	 * Selects the element of the current array at a given index; negative indexes count from the end of the array.
+	 */
+	JFJSONPathStepKindIndex,
+	
+	/**
+	 * Selects the value of the current object associated with a given key.
+	 */
+	JFJSONPathStepKindKey,
+	
+	/**
+	 * A JSON Pointer reference token: selects the value of the current object associated with a given key, or the element of the current array at the index represented by the same key.
+	 */
+	JFJSONPathStepKindToken,
+	
+	/**
+	 * Selects all the children of the current node.
+	 */
+	JFJSONPathStepKindWildcard,
+};
+
+typedef struct
+{
+	const uint8_t* bytes;
+	NSUInteger length;
+	NSUInteger position;
+} JFJSONPathScanner;
+
+typedef struct
+{
+	// The objects are owned by the `components` of the path.
+	__unsafe_unretained NSString* _Nullable key;
+	const uint8_t* _Nullable keyBytes;
+	NSUInteger keyLength;
+	__unsafe_unretained id _Nullable literal;
+	NSInteger index;
+	JFJSONPathStepKind kind;
+	JFJSONPathOperator operator;
+} JFJSONPathStep;
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+static BOOL JFJSONPathEvaluateNode(const JFJSONPathStep* steps, NSUInteger count, id value, NSMutableArray* results, BOOL first);
+static BOOL JFJSONPathScanValue(JFJSONPathScanner* scanner, const JFJSONPathStep* steps, NSUInteger count, NSMutableArray* results, BOOL first, BOOL* stop);
+
+static BOOL JFJSONPathIsBoolean(id value)
+{
+	return ([value isKindOfClass:NSNumber.class] && (CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID()));
+}
+
+static BOOL JFJSONPathIsWhitespace(uint8_t character)
+{
+	return ((character == ' ') || (character == '\t') || (character == '\n') || (character == '\r'));
+}
+
+static id _Nullable JFJSONPathElement(id container, NSInteger index)
+{
+	BOOL isJSONArray = ([container isKindOfClass:JFJSONArray.class] || [container isKindOfClass:JFJSONDocumentArray.class]);
+	if(!isJSONArray && ![container isKindOfClass:NSArray.class])
+		return nil;
+	
+	NSInteger count = (NSInteger)[container count];
+	if(index < 0)
+		index += count;
+	if((index < 0) || (index >= count))
+		return nil;
+	
+	return (isJSONArray ? [container valueAtIndex:(NSUInteger)index] : [(NSArray*)container objectAtIndex:(NSUInteger)index]);
+}
+
+static BOOL JFJSONPathEnumerateChildren(id container, BOOL (^block)(id child))
+{
+	__block BOOL retVal = NO;
+	if([container isKindOfClass:JFJSONObject.class] || [container isKindOfClass:JFJSONDocumentObject.class])
+	{
+		[container enumerateKeysAndValuesUsingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+			retVal = block(value);
+			return retVal;
+		}];
+	}
+	else if([container isKindOfClass:JFJSONArray.class] || [container isKindOfClass:JFJSONDocumentArray.class])
+	{
+		[container enumerateValuesUsingBlock:^BOOL(NSUInteger index, id<JFJSONValue> value) {
+			retVal = block(value);
+			return retVal;
+		}];
+	}
+	else if([container isKindOfClass:NSDictionary.class])
+	{
+		[(NSDictionary*)container enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL* stop) {
+			retVal = block(value);
+			*stop = retVal;
+		}];
+	}
+	else if([container isKindOfClass:NSArray.class])
+	{
+		for(id value in (NSArray*)container)
+		{
+			retVal = block(value);
+			if(retVal)
+				break;
+		}
+	}
+	return retVal;
+}
+
+static id _Nullable JFJSONPathMember(id container, NSString* key)
+{
+	if([container isKindOfClass:JFJSONObject.class] || [container isKindOfClass:JFJSONDocumentObject.class])
+		return [container valueForKey:key];
+	
+	if([container isKindOfClass:NSDictionary.class])
+		return [(NSDictionary*)container objectForKey:key];
+	
+	return nil;
+}
+
+static BOOL JFJSONPathMatchesFilter(const JFJSONPathStep* step, id child)
+{
+	id value = (step->key ? JFJSONPathMember(child, (NSString*)step->key) : child);
+	if(!value)
+		return NO;
+	
+	JFJSONPathOperator operator = step->operator;
+	if(operator == JFJSONPathOperatorExists)
+		return YES;
+	
+	// Values of different types are never equal, and can't be ordered.
+	id literal = step->literal;
+	NSComparisonResult result;
+	if([value isKindOfClass:NSString.class] && [literal isKindOfClass:NSString.class])
+		result = [(NSString*)value compare:(NSString*)literal options:NSLiteralSearch];
+	else if([value isKindOfClass:NSNumber.class] && [literal isKindOfClass:NSNumber.class] && (JFJSONPathIsBoolean(value) == JFJSONPathIsBoolean(literal)))
+		result = [(NSNumber*)value compare:(NSNumber*)literal];
+	else if([value isKindOfClass:NSNull.class] && [literal isKindOfClass:NSNull.class])
+		result = NSOrderedSame;
+	else
+		return (operator == JFJSONPathOperatorNotEqual);
+	
+	switch(operator)
+	{
+		case JFJSONPathOperatorEqual:
+			return (result == NSOrderedSame);
+		case JFJSONPathOperatorGreater:
+			return (result == NSOrderedDescending);
+		case JFJSONPathOperatorGreaterOrEqual:
+			return (result != NSOrderedAscending);
+		case JFJSONPathOperatorLess:
+			return (result == NSOrderedAscending);
+		case JFJSONPathOperatorLessOrEqual:
+			return (result != NSOrderedDescending);
+		case JFJSONPathOperatorNotEqual:
+			return (result != NSOrderedSame);
+		default:
+			return YES;
+	}
+}
+
+// Evaluates the given steps against the given value, adding the selected values to the results; returns `YES` if the evaluation must stop.
+static BOOL JFJSONPathEvaluateNode(const JFJSONPathStep* steps, NSUInteger count, id value, NSMutableArray* results, BOOL first)
+{
+	if(count == 0)
+	{
+		[results addObject:value];
+		return first;
+	}
+	
+	const JFJSONPathStep* step = steps;
+	id child = nil;
+	switch(step->kind)
+	{
+		case JFJSONPathStepKindIndex:
+		{
+			child = JFJSONPathElement(value, step->index);
+			break;
+		}
+		case JFJSONPathStepKindKey:
+		{
+			child = JFJSONPathMember(value, (NSString*)step->key);
+			break;
+		}
+		case JFJSONPathStepKindToken:
+		{
+			child = JFJSONPathMember(value, (NSString*)step->key);
+			if(!child && (step->index != NSNotFound))
+				child = JFJSONPathElement(value, step->index);
+			break;
+		}
+		default:
+		{
+			BOOL filters = (step->kind == JFJSONPathStepKindFilter);
+			return JFJSONPathEnumerateChildren(value, ^BOOL(id element) {
+				if(filters && !JFJSONPathMatchesFilter(step, element))
+					return NO;
+				return JFJSONPathEvaluateNode(steps + 1, count - 1, element, results, first);
+			});
+		}
+	}
+	
+	return (child ? JFJSONPathEvaluateNode(steps + 1, count - 1, child, results, first) : NO);
+}
+
+static id _Nullable JFJSONPathDecode(const JFJSONPathScanner* scanner, NSUInteger start, NSUInteger end)
+{
+	NSData* data = [[NSData alloc] initWithBytesNoCopy:(void*)(scanner->bytes + start) length:(end - start) freeWhenDone:NO];
+	return [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingAllowFragments error:NULL];
+}
+
+static void JFJSONPathSkipWhitespace(JFJSONPathScanner* scanner)
+{
+	while((scanner->position < scanner->length) && JFJSONPathIsWhitespace(scanner->bytes[scanner->position]))
+		scanner->position++;
+}
+
+static BOOL JFJSONPathSkipString(JFJSONPathScanner* scanner, BOOL* _Nullable escaped)
+{
+	const uint8_t* bytes = scanner->bytes;
+	NSUInteger length = scanner->length;
+	for(NSUInteger position = scanner->position + 1; position < length; position++)
+	{
+		uint8_t character = bytes[position];
+		if(character == '"')
+		{
+			scanner->position = position + 1;
+			return YES;
+		}
+		if(character == '\\')
+		{
+			if(escaped)
+				*escaped = YES;
+			position++;
+		}
+	}
+	return NO;
+}
+
+static BOOL JFJSONPathSkipValue(JFJSONPathScanner* scanner)
+{
+	JFJSONPathSkipWhitespace(scanner);
+	
+	const uint8_t* bytes = scanner->bytes;
+	NSUInteger length = scanner->length;
+	if(scanner->position >= length)
+		return NO;
+	
+	uint8_t character = bytes[scanner->position];
+	if(character == '"')
+		return JFJSONPathSkipString(scanner, NULL);
+	
+	if((character == '{') || (character == '['))
+	{
+		// The nested containers are only balanced, not validated: strings are skipped as a whole because they may contain brackets.
+		NSUInteger depth = 0;
+		while(scanner->position < length)
+		{
+			character = bytes[scanner->position];
+			if(character == '"')
+			{
+				if(!JFJSONPathSkipString(scanner, NULL))
+					return NO;
+				continue;
+			}
+			
+			scanner->position++;
+			if((character == '{') || (character == '['))
+				depth++;
+			else if(((character == '}') || (character == ']')) && (--depth == 0))
+				return YES;
+		}
+		return NO;
+	}
+	
+	// Numbers and literals end at the first delimiter.
+	NSUInteger start = scanner->position;
+	while(scanner->position < length)
+	{
+		character = bytes[scanner->position];
+		if((character == ',') || (character == ']') || (character == '}') || JFJSONPathIsWhitespace(character))
+			break;
+		scanner->position++;
+	}
+	return (scanner->position > start);
+}
+
+static NSInteger JFJSONPathCountElements(JFJSONPathScanner scanner)
+{
+	scanner.position++;
+	JFJSONPathSkipWhitespace(&scanner);
+	if((scanner.position < scanner.length) && (scanner.bytes[scanner.position] == ']'))
+		return 0;
+	
+	for(NSInteger retVal = 1; ; retVal++)
+	{
+		if(!JFJSONPathSkipValue(&scanner))
+			return -1;
+		
+		JFJSONPathSkipWhitespace(&scanner);
+		if(scanner.position >= scanner.length)
+			return -1;
+		
+		uint8_t character = scanner.bytes[scanner.position++];
+		if(character == ']')
+			return retVal;
+		if(character != ',')
+			return -1;
+	}
+}
+
+static BOOL JFJSONPathScanKey(JFJSONPathScanner* scanner, const JFJSONPathStep* step, BOOL* matches)
+{
+	NSUInteger start = scanner->position;
+	BOOL escaped = NO;
+	if(!JFJSONPathSkipString(scanner, &escaped))
+		return NO;
+	
+	if(!step->key)
+	{
+		*matches = NO;
+		return YES;
+	}
+	
+	// Unescaped keys are compared byte by byte with the UTF-8 representation of the key of the step.
+	if(!escaped)
+	{
+		NSUInteger length = scanner->position - start - 2;
+		*matches = ((length == step->keyLength) && (memcmp(scanner->bytes + start + 1, step->keyBytes, length) == 0));
+		return YES;
+	}
+	
+	NSString* key = JFJSONPathDecode(scanner, start, scanner->position);
+	if(!key)
+		return NO;
+	
+	*matches = [key isEqualToString:(NSString*)step->key];
+	return YES;
+}
+
+static BOOL JFJSONPathScanContainer(JFJSONPathScanner* scanner, const JFJSONPathStep* steps, NSUInteger count, NSMutableArray* results, BOOL first, BOOL* stop)
+{
+	const uint8_t* bytes = scanner->bytes;
+	const JFJSONPathStep* step = steps;
+	BOOL isObject = (bytes[scanner->position] == '{');
+	uint8_t closing = (isObject ? '}' : ']');
+	
+	// Negative indexes count from the end of the array: its elements must be counted first.
+	NSInteger target = step->index;
+	if(!isObject && (step->kind == JFJSONPathStepKindIndex) && (target < 0))
+	{
+		NSInteger elementsCount = JFJSONPathCountElements(*scanner);
+		if(elementsCount < 0)
+			return NO;
+		target += elementsCount;
+	}
+	
+	scanner->position++;
+	JFJSONPathSkipWhitespace(scanner);
+	if((scanner->position < scanner->length) && (bytes[scanner->position] == closing))
+	{
+		scanner->position++;
+		return YES;
+	}
+	
+	for(NSInteger index = 0; ; index++)
+	{
+		BOOL selected;
+		if(isObject)
+		{
+			JFJSONPathSkipWhitespace(scanner);
+			if((scanner->position >= scanner->length) || (bytes[scanner->position] != '"'))
+				return NO;
+			
+			BOOL matches = NO;
+			if(!JFJSONPathScanKey(scanner, step, &matches))
+				return NO;
+			
+			JFJSONPathSkipWhitespace(scanner);
+			if((scanner->position >= scanner->length) || (bytes[scanner->position] != ':'))
+				return NO;
+			scanner->position++;
+			
+			switch(step->kind)
+			{
+				case JFJSONPathStepKindFilter:
+				case JFJSONPathStepKindWildcard:
+					selected = YES;
+					break;
+				case JFJSONPathStepKindKey:
+				case JFJSONPathStepKindToken:
+					selected = matches;
+					break;
+				default:
+					selected = NO;
+					break;
+			}
+		}
+		else
+		{
+			switch(step->kind)
+			{
+				case JFJSONPathStepKindFilter:
+				case JFJSONPathStepKindWildcard:
+					selected = YES;
+					break;
+				case JFJSONPathStepKindIndex:
+				case JFJSONPathStepKindToken:
+					selected = (index == target);
+					break;
+				default:
+					selected = NO;
+					break;
+			}
+		}
+		
+		if(!selected)
+		{
+			if(!JFJSONPathSkipValue(scanner))
+				return NO;
+		}
+		else if(step->kind == JFJSONPathStepKindFilter)
+		{
+			// Predicates need the whole child: it's decoded, and the rest of the path is evaluated against the decoded value.
+			JFJSONPathSkipWhitespace(scanner);
+			NSUInteger start = scanner->position;
+			if(!JFJSONPathSkipValue(scanner))
+				return NO;
+			
+			id child = JFJSONPathDecode(scanner, start, scanner->position);
+			if(!child)
+				return NO;
+			
+			if(JFJSONPathMatchesFilter(step, child))
+				*stop = JFJSONPathEvaluateNode(steps + 1, count - 1, child, results, first);
+		}
+		else if(!JFJSONPathScanValue(scanner, steps + 1, count - 1, results, first, stop))
+			return NO;
+		
+		// Once the evaluation stops, the rest of the data is not even scanned.
+		if(*stop)
+			return YES;
+		
+		JFJSONPathSkipWhitespace(scanner);
+		if(scanner->position >= scanner->length)
+			return NO;
+		
+		uint8_t character = bytes[scanner->position++];
+		if(character == closing)
+			return YES;
+		if(character != ',')
+			return NO;
+	}
+}
+
+// Evaluates the given steps against the value starting at the current position of the scanner, adding the selected values to the results; returns `NO` if the data is not valid.
+static BOOL JFJSONPathScanValue(JFJSONPathScanner* scanner, const JFJSONPathStep* steps, NSUInteger count, NSMutableArray* results, BOOL first, BOOL* stop)
+{
+	JFJSONPathSkipWhitespace(scanner);
+	if(scanner->position >= scanner->length)
+		return NO;
+	
+	if(count == 0)
+	{
+		NSUInteger start = scanner->position;
+		if(!JFJSONPathSkipValue(scanner))
+			return NO;
+		
+		id value = JFJSONPathDecode(scanner, start, scanner->position);
+		if(!value)
+			return NO;
+		
+		[results addObject:value];
+		*stop = first;
+		return YES;
+	}
+	
+	uint8_t character = scanner->bytes[scanner->position];
+	if((character == '{') || (character == '['))
+		return JFJSONPathScanContainer(scanner, steps, count, results, first, stop);
+	
+	// Scalars have no children to select.
+	return JFJSONPathSkipValue(scanner);
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONPath (/* Private */)
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@property (strong, nonatomic, readonly) NSMutableArray* components;
+@property (assign, nonatomic, readonly) NSUInteger count;
+@property (strong, nonatomic, readonly) NSMutableData* stepsData;
+
+// =================================================================================================
+// MARK: Methods - Parsing
+// =================================================================================================
+
+- (void)addStepWithKind:(JFJSONPathStepKind)kind key:(NSString* _Nullable)key index:(NSInteger)index operator:(JFJSONPathOperator)operator literal:(id _Nullable)literal;
+- (BOOL)parseExpression:(NSString*)expression;
+- (BOOL)parsePointer:(NSString*)pointer;
+
+// =================================================================================================
+// MARK: Methods - Evaluation
+// =================================================================================================
+
+- (NSArray<id<JFJSONConvertibleValue>>* _Nullable)valuesInData:(NSData*)data first:(BOOL)first;
+- (NSArray<id<JFJSONValue>>*)valuesInNode:(id<JFJSONNode>)node first:(BOOL)first;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONPath
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize components = _components;
+@synthesize singular = _singular;
+@synthesize stepsData = _stepsData;
+@synthesize string = _string;
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Data
+// =================================================================================================
+
+- (NSUInteger)count
+{
+	return self.stepsData.length / sizeof(JFJSONPathStep);
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
++ (instancetype _Nullable)pathWithExpression:(NSString*)expression
+{
+	return [[self alloc] initWithExpression:expression];
+}
+
++ (instancetype _Nullable)pathWithPointer:(NSString*)pointer
+{
+	return [[self alloc] initWithPointer:pointer];
+}
+
+- (instancetype _Nullable)initWithExpression:(NSString*)expression
+{
+	self = [super init];
+	
+	_components = [NSMutableArray new];
+	_singular = YES;
+	_stepsData = [NSMutableData new];
+	_string = [expression copy];
+	
+	if(![self parseExpression:expression])
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Invalid JSON path expression. [expression = '%@']", ClassName, JFStringFromPointer(self), expression] tags:JFLoggerTagsError];
+		return nil;
+	}
+	
+	return self;
+}
+
+- (instancetype _Nullable)initWithPointer:(NSString*)pointer
+{
+	self = [super init];
+	
+	_components = [NSMutableArray new];
+	_singular = YES;
+	_stepsData = [NSMutableData new];
+	_string = [pointer copy];
+	
+	if(![self parsePointer:pointer])
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Invalid JSON pointer. [pointer = '%@']", ClassName, JFStringFromPointer(self), pointer] tags:JFLoggerTagsError];
+		return nil;
+	}
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Evaluation
+// =================================================================================================
+
+- (id<JFJSONConvertibleValue> _Nullable)firstValueInData:(NSData*)data
+{
+	return [self valuesInData:data first:YES].firstObject;
+}
+
+- (id<JFJSONValue> _Nullable)firstValueInNode:(id<JFJSONNode>)node
+{
+	return [self valuesInNode:node first:YES].firstObject;
+}
+
+- (NSArray<id<JFJSONConvertibleValue>>* _Nullable)valuesInData:(NSData*)data
+{
+	return [self valuesInData:data first:NO];
+}
+
+- (NSArray<id<JFJSONConvertibleValue>>* _Nullable)valuesInData:(NSData*)data first:(BOOL)first
+{
+	JFJSONPathScanner scanner = {(const uint8_t*)data.bytes, data.length, 0};
+	NSMutableArray<id<JFJSONConvertibleValue>>* retObj = [NSMutableArray<id<JFJSONConvertibleValue>> new];
+	BOOL stop = NO;
+	if(!JFJSONPathScanValue(&scanner, (const JFJSONPathStep*)self.stepsData.bytes, self.count, retObj, first, &stop))
+	{
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to scan JSON data. [path = '%@'; position = '%@']", ClassName, JFStringFromPointer(self), self.string, JFStringFromNSUInteger(scanner.position)] tags:JFLoggerTagsError];
+		return nil;
+	}
+	return retObj;
+}
+
+- (NSArray<id<JFJSONValue>>*)valuesInNode:(id<JFJSONNode>)node
+{
+	return [self valuesInNode:node first:NO];
+}
+
+- (NSArray<id<JFJSONValue>>*)valuesInNode:(id<JFJSONNode>)node first:(BOOL)first
+{
+	NSMutableArray<id<JFJSONValue>>* retObj = [NSMutableArray<id<JFJSONValue>> new];
+	JFJSONPathEvaluateNode((const JFJSONPathStep*)self.stepsData.bytes, self.count, node, retObj, first);
+	return retObj;
+}
+
+// =================================================================================================
+// MARK: Methods - Parsing
+// =================================================================================================
+
+- (void)addStepWithKind:(JFJSONPathStepKind)kind key:(NSString* _Nullable)key index:(NSInteger)index operator:(JFJSONPathOperator)operator literal:(id _Nullable)literal
+{
+	JFJSONPathStep step;
+	memset(&step, 0, sizeof(step));
+	step.index = index;
+	step.kind = kind;
+	step.operator = operator;
+	
+	// The steps don't retain their objects: the path keeps them alive.
+	NSMutableArray* components = self.components;
+	if(key)
+	{
+		NSData* keyData = [key dataUsingEncoding:NSUTF8StringEncoding];
+		[components addObject:key];
+		[components addObject:keyData];
+		step.key = key;
+		step.keyBytes = (const uint8_t*)keyData.bytes;
+		step.keyLength = keyData.length;
+	}
+	if(literal)
+	{
+		[components addObject:literal];
+		step.literal = literal;
+	}
+	
+	if((kind == JFJSONPathStepKindFilter) || (kind == JFJSONPathStepKindWildcard))
+		_singular = NO;
+	
+	[self.stepsData appendBytes:&step length:sizeof(step)];
+}
+
+- (BOOL)parseExpression:(NSString*)expression
+{
+	NSScanner* scanner = [NSScanner scannerWithString:expression];
+	scanner.caseSensitive = YES;
+	scanner.charactersToBeSkipped = nil;
+	
+	if(![scanner scanString:@"$" intoString:NULL])
+		return NO;
+	
+	NSCharacterSet* whitespaces = [NSCharacterSet whitespaceCharacterSet];
+	NSCharacterSet* nameDelimiters = [NSCharacterSet characterSetWithCharactersInString:@".[]()=!<> \t'\""];
+	NSCharacterSet* operatorCharacters = [NSCharacterSet characterSetWithCharactersInString:@"=!<>"];
+	
+	// Scans a name, or a quoted string (using either single or double quotes, where `\` escapes the next character).
+	NSString* _Nullable (^scanName)(BOOL) = ^NSString* _Nullable (BOOL quoted) {
+		if(!quoted)
+		{
+			NSString* retObj = nil;
+			return ([scanner scanUpToCharactersFromSet:nameDelimiters intoString:&retObj] ? retObj : nil);
+		}
+		
+		NSString* quote = nil;
+		if(![scanner scanString:@"'" intoString:&quote] && ![scanner scanString:@"\"" intoString:&quote])
+			return nil;
+		
+		NSMutableString* retObj = [NSMutableString string];
+		NSString* string = scanner.string;
+		NSUInteger location = scanner.scanLocation;
+		while(location < string.length)
+		{
+			unichar character = [string characterAtIndex:location++];
+			if(character == [quote characterAtIndex:0])
+			{
+				scanner.scanLocation = location;
+				return retObj;
+			}
+			if((character == '\\') && (location < string.length))
+				character = [string characterAtIndex:location++];
+			[retObj appendFormat:@"%C", character];
+		}
+		return nil;
+	};
+	
+	while(!scanner.isAtEnd)
+	{
+		if([scanner scanString:@"." intoString:NULL])
+		{
+			if([scanner scanString:@"*" intoString:NULL])
+			{
+				[self addStepWithKind:JFJSONPathStepKindWildcard key:nil index:0 operator:JFJSONPathOperatorExists literal:nil];
+				continue;
+			}
+			
+			NSString* name = scanName(NO);
+			if(!name)
+				return NO;
+			
+			[self addStepWithKind:JFJSONPathStepKindKey key:name index:0 operator:JFJSONPathOperatorExists literal:nil];
+			continue;
+		}
+		
+		if(![scanner scanString:@"[" intoString:NULL])
+			return NO;
+		
+		[scanner scanCharactersFromSet:whitespaces intoString:NULL];
+		
+		NSInteger index = 0;
+		if([scanner scanString:@"*" intoString:NULL])
+			[self addStepWithKind:JFJSONPathStepKindWildcard key:nil index:0 operator:JFJSONPathOperatorExists literal:nil];
+		else if([scanner scanInteger:&index])
+			[self addStepWithKind:JFJSONPathStepKindIndex key:nil index:index operator:JFJSONPathOperatorExists literal:nil];
+		else if([scanner scanString:@"?(" intoString:NULL])
+		{
+			[scanner scanCharactersFromSet:whitespaces intoString:NULL];
+			if(![scanner scanString:@"@" intoString:NULL])
+				return NO;
+			
+			NSString* key = nil;
+			if([scanner scanString:@"." intoString:NULL])
+				key = scanName(NO);
+			else if([scanner scanString:@"[" intoString:NULL])
+			{
+				key = scanName(YES);
+				if(![scanner scanString:@"]" intoString:NULL])
+					return NO;
+			}
+			
+			[scanner scanCharactersFromSet:whitespaces intoString:NULL];
+			
+			JFJSONPathOperator operator = JFJSONPathOperatorExists;
+			id literal = nil;
+			NSString* operatorString = nil;
+			if([scanner scanCharactersFromSet:operatorCharacters intoString:&operatorString])
+			{
+				NSDictionary<NSString*, NSNumber*>* operators = @{@"==": @(JFJSONPathOperatorEqual), @"!=": @(JFJSONPathOperatorNotEqual), @"<": @(JFJSONPathOperatorLess), @"<=": @(JFJSONPathOperatorLessOrEqual), @">": @(JFJSONPathOperatorGreater), @">=": @(JFJSONPathOperatorGreaterOrEqual)};
+				NSNumber* value = [operators objectForKey:operatorString];
+				if(!value)
+					return NO;
+				operator = (JFJSONPathOperator)value.unsignedCharValue;
+				
+				[scanner scanCharactersFromSet:whitespaces intoString:NULL];
+				
+				double number = 0;
+				if([scanner scanString:@"true" intoString:NULL])
+					literal = @YES;
+				else if([scanner scanString:@"false" intoString:NULL])
+					literal = @NO;
+				else if([scanner scanString:@"null" intoString:NULL])
+					literal = [NSNull null];
+				else if([scanner scanDouble:&number])
+					literal = @(number);
+				else
+				{
+					literal = scanName(YES);
+					if(!literal)
+						return NO;
+				}
+				
+				[scanner scanCharactersFromSet:whitespaces intoString:NULL];
+			}
+			
+			if(![scanner scanString:@")" intoString:NULL])
+				return NO;
+			
+			[self addStepWithKind:JFJSONPathStepKindFilter key:key index:0 operator:operator literal:literal];
+		}
+		else
+		{
+			NSString* key = scanName(YES);
+			if(!key)
+				return NO;
+			
+			[self addStepWithKind:JFJSONPathStepKindKey key:key index:0 operator:JFJSONPathOperatorExists literal:nil];
+		}
+		
+		[scanner scanCharactersFromSet:whitespaces intoString:NULL];
+		if(![scanner scanString:@"]" intoString:NULL])
+			return NO;
+	}
+	
+	return YES;
+}
+
+- (BOOL)parsePointer:(NSString*)pointer
+{
+	// The empty pointer selects the whole document.
+	if(pointer.length == 0)
+		return YES;
+	
+	if(![pointer hasPrefix:@"/"])
+		return NO;
+	
+	for(NSString* token in [[pointer substringFromIndex:1] componentsSeparatedByString:@"/"])
+	{
+		// Each `~` must be followed by either `0` or `1`.
+		NSUInteger length = token.length;
+		for(NSUInteger location = 0; location < length; location++)
+		{
+			if([token characterAtIndex:location] != '~')
+				continue;
+			
+			unichar next = ((location + 1 < length) ? [token characterAtIndex:location + 1] : 0);
+			if((next != '0') && (next != '1'))
+				return NO;
+		}
+		
+		NSString* key = [[token stringByReplacingOccurrencesOfString:@"~1" withString:@"/"] stringByReplacingOccurrencesOfString:@"~0" withString:@"~"];
+		
+		// Array indexes are made of digits only, without leading zeros.
+		NSInteger index = NSNotFound;
+		NSUInteger keyLength = key.length;
+		if((keyLength > 0) && (keyLength < 19) && ((keyLength == 1) || ([key characterAtIndex:0] != '0')) && JFStringIsMadeOfCharacters(key, @"0123456789"))
+			index = key.integerValue;
+		
+		[self addStepWithKind:JFJSONPathStepKindToken key:key index:index operator:JFJSONPathOperatorExists literal:nil];
+	}
+	
+	return YES;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
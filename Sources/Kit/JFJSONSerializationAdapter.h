@@ -28,6 +28,9 @@
 
 #import <JFKit/JFJSONValue.h>
 
+@class JFJSONArray;
+@class JFJSONObject;
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 NS_ASSUME_NONNULL_BEGIN
@@ -103,6 +106,46 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSString* _Nullable)stringFromDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>* _Nullable)dictionary;
 
+@optional
+
+// =================================================================================================
+// MARK: Methods - Nodes (Arrays)
+// =================================================================================================
+
+/**
+ * Converts a JSON array node to JSON data, without converting it to SDK native data objects first.
+ * @param array The JSON array node to convert.
+ * @return The result of the conversion.
+ */
+- (NSData* _Nullable)dataFromJSONArray:(JFJSONArray* _Nullable)array;
+
+/**
+ * Decodes the given JSON data directly into the given JSON array node, appending the decoded values.
+ * @param jsonData The JSON data to decode.
+ * @param array The JSON array node that receives the decoded values.
+ * @return `YES` if the data contained a valid JSON array, `NO` otherwise.
+ */
+- (BOOL)importData:(NSData* _Nullable)jsonData intoJSONArray:(JFJSONArray*)array;
+
+// =================================================================================================
+// MARK: Methods - Nodes (Objects)
+// =================================================================================================
+
+/**
+ * Converts a JSON object node to JSON data, without converting it to SDK native data objects first.
+ * @param object The JSON object node to convert.
+ * @return The result of the conversion.
+ */
+- (NSData* _Nullable)dataFromJSONObject:(JFJSONObject* _Nullable)object;
+
+/**
+ * Decodes the given JSON data directly into the given JSON object node, adding the decoded entries.
+ * @param jsonData The JSON data to decode.
+ * @param object The JSON object node that receives the decoded entries.
+ * @return `YES` if the data contained a valid JSON dictionary, `NO` otherwise.
+ */
+- (BOOL)importData:(NSData* _Nullable)jsonData intoJSONObject:(JFJSONObject*)object;
+
 @end
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
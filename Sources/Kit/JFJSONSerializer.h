@@ -35,7 +35,8 @@ NS_ASSUME_NONNULL_BEGIN
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 /**
- * This JSON serializer uses the `NSJSONSerialization` class to perform conversions.
+ * This JSON serializer parses data with the `JFJSONDocument` class and produces it with the `JFJSONWriter` class.
+ * @discussion Numbers are converted with the functions of `JFNumberConversion.h`: floating point values are parsed exactly and written with the shortest representation that converts back to the same value, and integers keep all their digits; the result doesn't depend on the locale of the process.
  */
 API_AVAILABLE(ios(8.0), macos(10.7))
 @interface JFJSONSerializer : NSObject <JFJSONSerializationAdapter>
@@ -26,7 +26,9 @@
 
 #import "JFJSONSerializer.h"
 
+#import "JFJSONDocument.h"
 #import "JFJSONNode.h"
+#import "JFJSONWriter.h"
 #import "JFKitLogger.h"
 #import "JFShortcuts.h"
 #import "JFStrings.h"
@@ -39,12 +41,6 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface JFJSONSerializer (/* Private */)
 
-// =================================================================================================
-// MARK: Properties - Concurrency
-// =================================================================================================
-
-@property (strong, nonatomic, readonly, nullable) NSLock* lock;
-
 // =================================================================================================
 // MARK: Methods - Data
 // =================================================================================================
@@ -61,28 +57,6 @@ NS_ASSUME_NONNULL_BEGIN
 
 @implementation JFJSONSerializer
 
-// =================================================================================================
-// MARK: Properties - Concurrency
-// =================================================================================================
-
-@synthesize lock = _lock;
-
-// =================================================================================================
-// MARK: Lifecycle
-// =================================================================================================
-
-- (instancetype)init
-{
-	self = [super init];
-	
-	if(@available(iOS 8.0, macOS 10.9, *))
-		_lock = nil;
-	else
-		_lock = [NSLock new];
-	
-	return self;
-}
-
 // =================================================================================================
 // MARK: Methods - Data
 // =================================================================================================
@@ -92,21 +66,20 @@ NS_ASSUME_NONNULL_BEGIN
 	if(!jsonNode)
 		return nil;
 	
-	NSLock* lock = self.lock;
-	
-	[lock lock];
-	if(![NSJSONSerialization isValidJSONObject:jsonNode])
-	{
-		[lock unlock];
-		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Not a valid JSON node. [node = '%@']", ClassName, JFStringFromPointer(self), jsonNode] tags:JFLoggerTagsError];
-		return nil;
-	}
-	
+	// The writer prints the numbers with the shortest representation that converts back to the same value, whatever the locale of the process.
+	NSOutputStream* stream = [NSOutputStream outputStreamToMemory];
+	[stream open];
+	JFJSONWriter* writer = [JFJSONWriter writerWithOutputStream:stream];
 	NSError* error = nil;
-	NSData* retObj = [NSJSONSerialization dataWithJSONObject:jsonNode options:0 error:&error];
-	[lock unlock];
+	NSData* retObj = nil;
+	if([writer writeValue:jsonNode] && [writer flushWithError:&error])
+		retObj = [stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+	else
+		error = writer.error;
+	[stream close];
+	
 	if(!retObj)
-		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to convert JSON node to data. [node = '%@']", ClassName, JFStringFromPointer(self), jsonNode] tags:JFLoggerTagsError];
+		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to convert JSON node to data. [node = '%@'; error = '%@']", ClassName, JFStringFromPointer(self), jsonNode, error] tags:JFLoggerTagsError];
 	return retObj;
 }
 
@@ -126,19 +99,20 @@ NS_ASSUME_NONNULL_BEGIN
 	if(!jsonData)
 		return nil;
 	
-	NSLock* lock = self.lock;
-	
-	[lock lock];
-	NSError* error = nil;
-	id retObj = [NSJSONSerialization JSONObjectWithData:jsonData options:0 error:&error];
-	[lock unlock];
-	
-	if(!retObj)
+	JFJSONDocument* document = [JFJSONDocument documentWithData:jsonData];
+	if(!document)
 	{
 		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Failed to convert JSON data to node. [data = '%@']", ClassName, JFStringFromPointer(self), jsonData] tags:JFLoggerTagsError];
 		return nil;
 	}
 	
+	// The document is only used to parse the data: its containers are converted to Foundation collections, which don't depend on the document.
+	id retObj = document.root;
+	if([retObj isKindOfClass:JFJSONDocumentArray.class])
+		retObj = ((JFJSONDocumentArray*)retObj).arrayValue;
+	else if([retObj isKindOfClass:JFJSONDocumentObject.class])
+		retObj = ((JFJSONDocumentObject*)retObj).dictionaryValue;
+	
 	if(![retObj isKindOfClass:class])
 	{
 		[JFKitLogger logError:[NSString stringWithFormat:@"%@<%@>: Converted JSON node class is not the requested one. [node = '%@'; class = '%@']", ClassName, JFStringFromPointer(self), retObj, NSStringFromClass(class)] tags:JFLoggerTagsError];
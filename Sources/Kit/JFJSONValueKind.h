@@ -0,0 +1,141 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <objc/runtime.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * The kinds of values that can be stored in a JSON node.
+ */
+typedef NS_ENUM(UInt8, JFJSONValueKind)
+{
+	/**
+	 * The value can't be stored in a JSON node.
+	 */
+	JFJSONValueKindNone = 0,
+	
+	/**
+	 * The value is a `JFJSONArray`.
+	 */
+	JFJSONValueKindArray,
+	
+	/**
+	 * The value is a `NSNull`.
+	 */
+	JFJSONValueKindNull,
+	
+	/**
+	 * The value is a `NSNumber`.
+	 */
+	JFJSONValueKindNumber,
+	
+	/**
+	 * The value is a `JFJSONObject`.
+	 */
+	JFJSONValueKindObject,
+	
+	/**
+	 * The value is a `NSString`.
+	 */
+	JFJSONValueKindString,
+	
+	/**
+	 * The value is of any other class conforming to the `JFJSONValue` protocol.
+	 */
+	JFJSONValueKindOther,
+};
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+/**
+ * The number of slots of the class cache; it must be a power of two.
+ */
+#define JFJSONValueKindCacheSize 64
+
+/**
+ * The class cache: each slot holds a class pointer with its kind stored in the low bits, which are always zero in class pointers; an empty slot holds `0`.
+ * @warning Slots must be read and written atomically.
+ */
+FOUNDATION_EXPORT uintptr_t JFJSONValueKindCache[JFJSONValueKindCacheSize];
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+/**
+ * Returns the slot of the class cache where the given class pointer is stored.
+ * @param pointer The class pointer.
+ * @return The index of the slot.
+ */
+static inline NSUInteger JFJSONValueKindCacheSlot(uintptr_t pointer)
+{
+	return (NSUInteger)(((pointer >> 4) ^ (pointer >> 10)) & (JFJSONValueKindCacheSize - 1));
+}
+
+/**
+ * Finds the kind of the values of the given class and stores it in the class cache.
+ * @param valueClass The class of the values.
+ * @return The kind of the values of the given class.
+ */
+FOUNDATION_EXPORT JFJSONValueKind JFJSONValueKindOfClass(Class valueClass);
+
+/**
+ * Returns the kind of the given value: the kind is looked up in the class cache by class pointer, so that in the common case it costs a single comparison instead of walking the class hierarchy.
+ * @param value The value.
+ * @return The kind of the value, or `JFJSONValueKindNone` if `value` is `nil` or can't be stored in a JSON node.
+ */
+static inline JFJSONValueKind JFJSONValueKindOf(id _Nullable value)
+{
+	if(!value)
+		return JFJSONValueKindNone;
+	
+	Class valueClass = object_getClass(value);
+	uintptr_t pointer = (uintptr_t)(__bridge void*)valueClass;
+	uintptr_t entry = __atomic_load_n(&JFJSONValueKindCache[JFJSONValueKindCacheSlot(pointer)], __ATOMIC_RELAXED);
+	if((entry & ~(uintptr_t)0x7) == pointer)
+		return (JFJSONValueKind)(entry & 0x7);
+	
+	return JFJSONValueKindOfClass(valueClass);
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
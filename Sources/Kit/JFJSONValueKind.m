@@ -0,0 +1,79 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONValueKind.h"
+
+#import "JFJSONArray.h"
+#import "JFJSONObject.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+uintptr_t JFJSONValueKindCache[JFJSONValueKindCacheSize];
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+JFJSONValueKind JFJSONValueKindOfClass(Class valueClass)
+{
+	// NB: sometimes the protocol check is not enough, maybe due to cluster classes, so the known classes are checked first.
+	JFJSONValueKind retVal;
+	if([valueClass isSubclassOfClass:NSString.class])
+		retVal = JFJSONValueKindString;
+	else if([valueClass isSubclassOfClass:NSNumber.class])
+		retVal = JFJSONValueKindNumber;
+	else if([valueClass isSubclassOfClass:NSNull.class])
+		retVal = JFJSONValueKindNull;
+	else if([valueClass isSubclassOfClass:JFJSONObject.class])
+		retVal = JFJSONValueKindObject;
+	else if([valueClass isSubclassOfClass:JFJSONArray.class])
+		retVal = JFJSONValueKindArray;
+	else if([valueClass conformsToProtocol:@protocol(JFJSONValue)])
+		retVal = JFJSONValueKindOther;
+	else
+		retVal = JFJSONValueKindNone;
+	
+	// Class pointers are at least 8 bytes aligned: the kind fits in the low bits. A collision just replaces the previous entry, which will be found again on its next miss.
+	uintptr_t pointer = (uintptr_t)(__bridge void*)valueClass;
+	if((pointer & 0x7) == 0)
+		__atomic_store_n(&JFJSONValueKindCache[JFJSONValueKindCacheSlot(pointer)], (pointer | retVal), __ATOMIC_RELAXED);
+	
+	return retVal;
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,259 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+#import <JFKit/JFJSONValue.h>
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+/**
+ * A list of error codes that can be found inside errors created by the class `JFJSONWriter`.
+ */
+typedef NS_ENUM(NSInteger, JFJSONWriterError) {
+	
+	/**
+	 * The call is not allowed at the current position of the document (for example a value inside an object without a key, or an unbalanced end of a container).
+	 */
+	JFJSONWriterErrorInvalidState,
+	
+	/**
+	 * The value can't be written as JSON (for example a non-finite number, or an object of a class that is not a JSON value).
+	 */
+	JFJSONWriterErrorInvalidValue,
+	
+	/**
+	 * The output stream or the file descriptor failed to accept the written bytes.
+	 */
+	JFJSONWriterErrorOutputFailed,
+};
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * The `JFJSONWriter` class writes a JSON document incrementally to an output stream or to a file descriptor, without building it in memory first.
+ * @discussion The document is produced by a sequence of calls that open and close containers, write keys and write values; whole JSON nodes (`JFJSONArray`, `JFJSONObject`, the nodes of a `JFJSONDocument`, or Foundation collections of JSON values) can be written with a single call, and are visited in place without being copied or converted. The text is accumulated in a buffer of fixed size, which is written to the output each time it fills up: the memory used by the writer does not depend on the size of the document.
+ * Numbers are written using the shortest representation that converts back to the same value. The first error stops the writer: every following call fails immediately and the error is available through the property `error`.
+ * @warning Instances of this class are not thread safe. The bytes still in the buffer are only written by calling `flushWithError:`, which must be called once the document is complete; the writer never opens nor closes its output.
+ */
+@interface JFJSONWriter : NSObject
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+/**
+ * The size of the buffer, in bytes.
+ */
+@property (assign, nonatomic, readonly) NSUInteger bufferSize;
+
+/**
+ * The number of bytes written so far, including the ones still in the buffer.
+ */
+@property (assign, nonatomic, readonly) unsigned long long bytesCount;
+
+/**
+ * `YES` if the root value has been written completely, `NO` otherwise.
+ */
+@property (assign, nonatomic, readonly, getter=isComplete) BOOL complete;
+
+/**
+ * The number of containers that have been opened and not yet closed.
+ */
+@property (assign, nonatomic, readonly) NSUInteger depth;
+
+// =================================================================================================
+// MARK: Properties - Errors
+// =================================================================================================
+
+/**
+ * The first error that occurred while writing, if any.
+ */
+@property (strong, nonatomic, readonly, nullable) NSError* error;
+
+/**
+ * The domain of the errors created by the writers.
+ */
+@property (class, strong, nonatomic, readonly) NSErrorDomain errorDomain;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+/**
+ * Creates a new writer that writes to the given file descriptor, using a buffer of default size.
+ * @param fileDescriptor The file descriptor, open for writing.
+ * @return A new writer.
+ */
++ (instancetype)writerWithFileDescriptor:(int)fileDescriptor;
+
+/**
+ * Creates a new writer that writes to the given output stream, using a buffer of default size.
+ * @param stream The output stream, already open.
+ * @return A new writer.
+ */
++ (instancetype)writerWithOutputStream:(NSOutputStream*)stream;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes this instance with the given file descriptor.
+ * @param fileDescriptor The file descriptor, open for writing; it's written with blocking calls.
+ * @param bufferSize The size of the buffer in bytes, or `0` to use the default size (64 KB).
+ * @return This instance.
+ */
+- (instancetype)initWithFileDescriptor:(int)fileDescriptor bufferSize:(NSUInteger)bufferSize NS_DESIGNATED_INITIALIZER;
+
+/**
+ * Initializes this instance with the given output stream.
+ * @param stream The output stream, already open; it's written with blocking calls.
+ * @param bufferSize The size of the buffer in bytes, or `0` to use the default size (64 KB).
+ * @return This instance.
+ */
+- (instancetype)initWithOutputStream:(NSOutputStream*)stream bufferSize:(NSUInteger)bufferSize NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - Containers
+// =================================================================================================
+
+/**
+ * Opens an array.
+ * @return `YES` if the array has been opened, `NO` otherwise.
+ */
+- (BOOL)beginArray;
+
+/**
+ * Opens an object.
+ * @return `YES` if the object has been opened, `NO` otherwise.
+ */
+- (BOOL)beginObject;
+
+/**
+ * Closes the innermost container, which must be an array.
+ * @return `YES` if the array has been closed, `NO` otherwise.
+ */
+- (BOOL)endArray;
+
+/**
+ * Closes the innermost container, which must be an object whose last key has a value.
+ * @return `YES` if the object has been closed, `NO` otherwise.
+ */
+- (BOOL)endObject;
+
+// =================================================================================================
+// MARK: Methods - Keys
+// =================================================================================================
+
+/**
+ * Writes the key of the next value of the innermost container, which must be an object.
+ * @param key The key.
+ * @return `YES` if the key has been written, `NO` otherwise.
+ */
+- (BOOL)writeKey:(NSString*)key;
+
+// =================================================================================================
+// MARK: Methods - Output
+// =================================================================================================
+
+/**
+ * Writes the bytes still in the buffer to the output.
+ * @param outError The error that occurred while writing, if any.
+ * @return `YES` if all the bytes have been written, `NO` otherwise.
+ */
+- (BOOL)flushWithError:(NSError* __autoreleasing _Nullable *)outError;
+
+// =================================================================================================
+// MARK: Methods - Values
+// =================================================================================================
+
+/**
+ * Writes a boolean value.
+ * @param value The value.
+ * @return `YES` if the value has been written, `NO` otherwise.
+ */
+- (BOOL)writeBoolean:(BOOL)value;
+
+/**
+ * Writes a floating point number.
+ * @param value The value; it must be finite.
+ * @return `YES` if the value has been written, `NO` otherwise.
+ */
+- (BOOL)writeDouble:(double)value;
+
+/**
+ * Writes an integer number.
+ * @param value The value.
+ * @return `YES` if the value has been written, `NO` otherwise.
+ */
+- (BOOL)writeInteger:(int64_t)value;
+
+/**
+ * Writes a null value.
+ * @return `YES` if the value has been written, `NO` otherwise.
+ */
+- (BOOL)writeNull;
+
+/**
+ * Writes a number.
+ * @param value The number; booleans are written as `true` or `false`, floating point numbers must be finite.
+ * @return `YES` if the value has been written, `NO` otherwise.
+ */
+- (BOOL)writeNumber:(NSNumber*)value;
+
+/**
+ * Writes a string.
+ * @param value The string.
+ * @return `YES` if the value has been written, `NO` otherwise.
+ */
+- (BOOL)writeString:(NSString*)value;
+
+/**
+ * Writes a JSON value, visiting its content if it's a container.
+ * @param value The value: a string, a number, `NSNull`, a `JFJSONArray`, a `JFJSONObject`, a node of a `JFJSONDocument`, or an array or dictionary containing only JSON values.
+ * @return `YES` if the value has been written, `NO` otherwise.
+ */
+- (BOOL)writeValue:(id<JFJSONConvertibleValue>)value;
+
+/**
+ * Writes a key followed by its value inside the innermost container, which must be an object.
+ * @param value The value; see `writeValue:`.
+ * @param key The key.
+ * @return `YES` if the key and the value have been written, `NO` otherwise.
+ */
+- (BOOL)writeValue:(id<JFJSONConvertibleValue>)value forKey:(NSString*)key;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
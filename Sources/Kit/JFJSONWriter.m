@@ -0,0 +1,795 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import "JFJSONWriter.h"
+
+#include <unistd.h>
+
+#import "JFErrorFactory.h"
+#import "JFJSONArray.h"
+#import "JFJSONDocument.h"
+#import "JFJSONObject.h"
+#import "JFJSONValueKind.h"
+#import "JFNumberConversion.h"
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * The flags describing an open container.
+ */
+typedef NS_OPTIONS(UInt8, JFJSONWriterLevel)
+{
+	/**
+	 * The container is an array.
+	 */
+	JFJSONWriterLevelArray = 0,
+	
+	/**
+	 * The container is an object.
+	 */
+	JFJSONWriterLevelObject = 1 << 0,
+	
+	/**
+	 * At least one value has been written inside the container.
+	 */
+	JFJSONWriterLevelNotEmpty = 1 << 1,
+};
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+// The size of the buffer used when none is requested.
+static NSUInteger const JFJSONWriterDefaultBufferSize = 64 * 1024;
+
+// The minimum size of the buffer; smaller buffers would send almost every value directly to the output.
+static NSUInteger const JFJSONWriterMinimumBufferSize = 64;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONWriter (/* Private */)
+
+// =================================================================================================
+// MARK: Properties - Errors
+// =================================================================================================
+
+@property (class, strong, nonatomic, readonly) JFErrorFactory* errorFactory;
+
+// =================================================================================================
+// MARK: Properties - Output
+// =================================================================================================
+
+@property (assign, nonatomic, readonly) int fileDescriptor;
+@property (strong, nonatomic, readonly, nullable) NSOutputStream* outputStream;
+
+// =================================================================================================
+// MARK: Methods - Containers
+// =================================================================================================
+
+- (BOOL)beginContainer:(JFJSONWriterLevel)level;
+- (BOOL)endContainer:(JFJSONWriterLevel)level;
+
+// =================================================================================================
+// MARK: Methods - Errors
+// =================================================================================================
+
+- (BOOL)failWithCode:(JFJSONWriterError)code description:(NSString*)description underlyingError:(NSError* _Nullable)underlyingError;
+
+// =================================================================================================
+// MARK: Methods - Output
+// =================================================================================================
+
+- (BOOL)appendBytes:(const void*)bytes length:(NSUInteger)length;
+- (BOOL)appendEscapedBytes:(const uint8_t*)bytes length:(NSUInteger)length;
+- (BOOL)appendString:(NSString*)string;
+- (BOOL)flushBuffer;
+- (BOOL)writeBytes:(const uint8_t*)bytes length:(NSUInteger)length;
+
+// =================================================================================================
+// MARK: Methods - Values
+// =================================================================================================
+
+- (BOOL)beginValue;
+- (void)endValue;
+- (BOOL)writeArray:(NSArray*)array;
+- (BOOL)writeDictionary:(NSDictionary*)dictionary;
+- (BOOL)writeDocumentArray:(JFJSONDocumentArray*)array;
+- (BOOL)writeDocumentObject:(JFJSONDocumentObject*)object;
+- (BOOL)writeJSONArray:(JFJSONArray*)array;
+- (BOOL)writeJSONObject:(JFJSONObject*)object;
+- (BOOL)writeLiteral:(const char*)literal length:(NSUInteger)length;
+- (BOOL)writeUnsignedInteger:(uint64_t)value;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONWriter
+
+// =================================================================================================
+// MARK: Fields
+// =================================================================================================
+
+{
+	// The buffer accumulating the text before it's written to the output.
+	uint8_t* _buffer;
+	
+	// The number of bytes currently stored in the buffer.
+	NSUInteger _bufferLength;
+	
+	// `YES` if a key has been written and its value has not, `NO` otherwise.
+	BOOL _expectsValue;
+	
+	// The flags of the open containers, from the outermost to the innermost.
+	JFJSONWriterLevel* _levels;
+	
+	// The number of flags that can be stored in `_levels` before growing it.
+	NSUInteger _levelsCapacity;
+}
+
+// =================================================================================================
+// MARK: Properties - Data
+// =================================================================================================
+
+@synthesize bufferSize = _bufferSize;
+@synthesize bytesCount = _bytesCount;
+@synthesize complete = _complete;
+@synthesize depth = _depth;
+
+// =================================================================================================
+// MARK: Properties - Errors
+// =================================================================================================
+
+@synthesize error = _error;
+
+// =================================================================================================
+// MARK: Properties - Output
+// =================================================================================================
+
+@synthesize fileDescriptor = _fileDescriptor;
+@synthesize outputStream = _outputStream;
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Errors
+// =================================================================================================
+
++ (NSErrorDomain)errorDomain
+{
+	return @"com.jackfelle.jsonWriter";
+}
+
++ (JFErrorFactory*)errorFactory
+{
+	static JFErrorFactory* retObj = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		retObj = [[JFErrorFactory alloc] initWithDomain:self.errorDomain];
+	});
+	return retObj;
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
++ (instancetype)writerWithFileDescriptor:(int)fileDescriptor
+{
+	return [[self alloc] initWithFileDescriptor:fileDescriptor bufferSize:0];
+}
+
++ (instancetype)writerWithOutputStream:(NSOutputStream*)stream
+{
+	return [[self alloc] initWithOutputStream:stream bufferSize:0];
+}
+
+- (void)dealloc
+{
+	free(_buffer);
+	free(_levels);
+}
+
+- (instancetype)initWithFileDescriptor:(int)fileDescriptor bufferSize:(NSUInteger)bufferSize
+{
+	self = [super init];
+	
+	_bufferSize = ((bufferSize == 0) ? JFJSONWriterDefaultBufferSize : MAX(bufferSize, JFJSONWriterMinimumBufferSize));
+	_buffer = malloc(_bufferSize);
+	_fileDescriptor = fileDescriptor;
+	
+	return self;
+}
+
+- (instancetype)initWithOutputStream:(NSOutputStream*)stream bufferSize:(NSUInteger)bufferSize
+{
+	self = [super init];
+	
+	_bufferSize = ((bufferSize == 0) ? JFJSONWriterDefaultBufferSize : MAX(bufferSize, JFJSONWriterMinimumBufferSize));
+	_buffer = malloc(_bufferSize);
+	_fileDescriptor = -1;
+	_outputStream = stream;
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Containers
+// =================================================================================================
+
+- (BOOL)beginArray
+{
+	return [self beginContainer:JFJSONWriterLevelArray];
+}
+
+- (BOOL)beginContainer:(JFJSONWriterLevel)level
+{
+	if(![self beginValue])
+		return NO;
+	
+	if(_depth == _levelsCapacity)
+	{
+		_levelsCapacity = MAX(_levelsCapacity * 2, 16);
+		_levels = realloc(_levels, _levelsCapacity * sizeof(JFJSONWriterLevel));
+	}
+	_levels[_depth++] = level;
+	
+	return [self appendBytes:((level & JFJSONWriterLevelObject) ? "{" : "[") length:1];
+}
+
+- (BOOL)beginObject
+{
+	return [self beginContainer:JFJSONWriterLevelObject];
+}
+
+- (BOOL)endArray
+{
+	return [self endContainer:JFJSONWriterLevelArray];
+}
+
+- (BOOL)endContainer:(JFJSONWriterLevel)level
+{
+	if(_error)
+		return NO;
+	
+	BOOL isObject = ((level & JFJSONWriterLevelObject) != 0);
+	if((_depth == 0) || ((_levels[_depth - 1] & JFJSONWriterLevelObject) != (level & JFJSONWriterLevelObject)))
+		return [self failWithCode:JFJSONWriterErrorInvalidState description:(isObject ? @"There is no open object to end." : @"There is no open array to end.") underlyingError:nil];
+	if(_expectsValue)
+		return [self failWithCode:JFJSONWriterErrorInvalidState description:@"The last key of the object has no value." underlyingError:nil];
+	
+	_depth--;
+	if(![self appendBytes:(isObject ? "}" : "]") length:1])
+		return NO;
+	
+	[self endValue];
+	return YES;
+}
+
+- (BOOL)endObject
+{
+	return [self endContainer:JFJSONWriterLevelObject];
+}
+
+// =================================================================================================
+// MARK: Methods - Errors
+// =================================================================================================
+
+- (BOOL)failWithCode:(JFJSONWriterError)code description:(NSString*)description underlyingError:(NSError* _Nullable)underlyingError
+{
+	if(!_error)
+		_error = [JFJSONWriter.errorFactory errorWithCode:code description:description underlyingError:underlyingError];
+	return NO;
+}
+
+// =================================================================================================
+// MARK: Methods - Keys
+// =================================================================================================
+
+- (BOOL)writeKey:(NSString*)key
+{
+	if(_error)
+		return NO;
+	
+	if((_depth == 0) || !(_levels[_depth - 1] & JFJSONWriterLevelObject))
+		return [self failWithCode:JFJSONWriterErrorInvalidState description:[NSString stringWithFormat:@"The key '%@' is not inside an object.", key] underlyingError:nil];
+	if(_expectsValue)
+		return [self failWithCode:JFJSONWriterErrorInvalidState description:[NSString stringWithFormat:@"The key '%@' follows another key.", key] underlyingError:nil];
+	
+	JFJSONWriterLevel* level = &_levels[_depth - 1];
+	if((*level & JFJSONWriterLevelNotEmpty) && ![self appendBytes:"," length:1])
+		return NO;
+	*level |= JFJSONWriterLevelNotEmpty;
+	
+	if(![self appendString:key] || ![self appendBytes:":" length:1])
+		return NO;
+	
+	_expectsValue = YES;
+	return YES;
+}
+
+// =================================================================================================
+// MARK: Methods - Output
+// =================================================================================================
+
+- (BOOL)appendBytes:(const void*)bytes length:(NSUInteger)length
+{
+	if(length > _bufferSize - _bufferLength)
+	{
+		if(![self flushBuffer])
+			return NO;
+		
+		// Chunks larger than the whole buffer are written directly.
+		if(length > _bufferSize)
+		{
+			_bytesCount += length;
+			return [self writeBytes:bytes length:length];
+		}
+	}
+	
+	memcpy(_buffer + _bufferLength, bytes, length);
+	_bufferLength += length;
+	_bytesCount += length;
+	return YES;
+}
+
+- (BOOL)appendEscapedBytes:(const uint8_t*)bytes length:(NSUInteger)length
+{
+	static const char* const hexDigits = "0123456789abcdef";
+	
+	// Runs of characters that don't need to be escaped are copied at once.
+	NSUInteger start = 0;
+	for(NSUInteger index = 0; index < length; index++)
+	{
+		uint8_t byte = bytes[index];
+		if((byte >= 0x20) && (byte != '"') && (byte != '\\'))
+			continue;
+		
+		if((index > start) && ![self appendBytes:bytes + start length:index - start])
+			return NO;
+		start = index + 1;
+		
+		char escape[6] = {'\\', 0, 0, 0, 0, 0};
+		NSUInteger escapeLength = 2;
+		switch(byte)
+		{
+			case '"':
+			case '\\':
+				escape[1] = (char)byte;
+				break;
+			case '\b':
+				escape[1] = 'b';
+				break;
+			case '\f':
+				escape[1] = 'f';
+				break;
+			case '\n':
+				escape[1] = 'n';
+				break;
+			case '\r':
+				escape[1] = 'r';
+				break;
+			case '\t':
+				escape[1] = 't';
+				break;
+			default:
+			{
+				escape[1] = 'u';
+				escape[2] = '0';
+				escape[3] = '0';
+				escape[4] = hexDigits[byte >> 4];
+				escape[5] = hexDigits[byte & 0xF];
+				escapeLength = 6;
+				break;
+			}
+		}
+		if(![self appendBytes:escape length:escapeLength])
+			return NO;
+	}
+	
+	return ((start == length) || [self appendBytes:bytes + start length:length - start]);
+}
+
+- (BOOL)appendString:(NSString*)string
+{
+	if(![self appendBytes:"\"" length:1])
+		return NO;
+	
+	// The string is encoded in chunks, so that long strings are never copied as a whole.
+	uint8_t chunk[1024];
+	NSRange range = NSMakeRange(0, string.length);
+	while(range.length > 0)
+	{
+		NSUInteger usedLength = 0;
+		if(![string getBytes:chunk maxLength:sizeof(chunk) usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:range remainingRange:&range] || (usedLength == 0))
+			return [self failWithCode:JFJSONWriterErrorInvalidValue description:@"The string can't be encoded in UTF-8." underlyingError:nil];
+		if(![self appendEscapedBytes:chunk length:usedLength])
+			return NO;
+	}
+	
+	return [self appendBytes:"\"" length:1];
+}
+
+- (BOOL)flushBuffer
+{
+	NSUInteger length = _bufferLength;
+	_bufferLength = 0;
+	return ((length == 0) || [self writeBytes:_buffer length:length]);
+}
+
+- (BOOL)flushWithError:(NSError* __autoreleasing _Nullable *)outError
+{
+	if(!_error)
+		[self flushBuffer];
+	
+	if(_error)
+	{
+		if(outError)
+			*outError = _error;
+		return NO;
+	}
+	
+	return YES;
+}
+
+- (BOOL)writeBytes:(const uint8_t*)bytes length:(NSUInteger)length
+{
+	NSOutputStream* stream = self.outputStream;
+	while(length > 0)
+	{
+		NSInteger written;
+		if(stream)
+		{
+			written = [stream write:bytes maxLength:length];
+			if(written <= 0)
+				return [self failWithCode:JFJSONWriterErrorOutputFailed description:@"Failed to write to the output stream." underlyingError:stream.streamError];
+		}
+		else
+		{
+			written = write(_fileDescriptor, bytes, length);
+			if(written < 0)
+			{
+				if(errno == EINTR)
+					continue;
+				
+				NSError* error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+				return [self failWithCode:JFJSONWriterErrorOutputFailed description:[NSString stringWithFormat:@"Failed to write to the file descriptor '%@'.", JFStringFromInt(_fileDescriptor)] underlyingError:error];
+			}
+		}
+		bytes += written;
+		length -= (NSUInteger)written;
+	}
+	return YES;
+}
+
+// =================================================================================================
+// MARK: Methods - Values
+// =================================================================================================
+
+- (BOOL)beginValue
+{
+	if(_error)
+		return NO;
+	
+	if(_depth == 0)
+	{
+		if(_complete)
+			return [self failWithCode:JFJSONWriterErrorInvalidState description:@"The root value has already been written." underlyingError:nil];
+		return YES;
+	}
+	
+	JFJSONWriterLevel* level = &_levels[_depth - 1];
+	if(*level & JFJSONWriterLevelObject)
+	{
+		if(!_expectsValue)
+			return [self failWithCode:JFJSONWriterErrorInvalidState description:@"A value inside an object must follow a key." underlyingError:nil];
+		_expectsValue = NO;
+		return YES;
+	}
+	
+	if((*level & JFJSONWriterLevelNotEmpty) && ![self appendBytes:"," length:1])
+		return NO;
+	*level |= JFJSONWriterLevelNotEmpty;
+	return YES;
+}
+
+- (void)endValue
+{
+	if(_depth == 0)
+		_complete = YES;
+}
+
+- (BOOL)writeArray:(NSArray*)array
+{
+	if(![self beginArray])
+		return NO;
+	
+	for(id value in array)
+	{
+		if(![self writeValue:value])
+			return NO;
+	}
+	
+	return [self endArray];
+}
+
+- (BOOL)writeBoolean:(BOOL)value
+{
+	return (value ? [self writeLiteral:"true" length:4] : [self writeLiteral:"false" length:5]);
+}
+
+- (BOOL)writeDictionary:(NSDictionary*)dictionary
+{
+	if(![self beginObject])
+		return NO;
+	
+	__block BOOL succeeded = YES;
+	[dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL* stop) {
+		if(![key isKindOfClass:NSString.class])
+			succeeded = [self failWithCode:JFJSONWriterErrorInvalidValue description:[NSString stringWithFormat:@"The key '%@' is not a string.", key] underlyingError:nil];
+		else
+			succeeded = ([self writeKey:key] && [self writeValue:value]);
+		*stop = !succeeded;
+	}];
+	
+	return (succeeded && [self endObject]);
+}
+
+- (BOOL)writeDocumentArray:(JFJSONDocumentArray*)array
+{
+	if(![self beginArray])
+		return NO;
+	
+	__block BOOL succeeded = YES;
+	[array enumerateValuesUsingBlock:^BOOL(NSUInteger index, id<JFJSONValue> value) {
+		succeeded = [self writeValue:value];
+		return !succeeded;
+	}];
+	
+	return (succeeded && [self endArray]);
+}
+
+- (BOOL)writeDocumentObject:(JFJSONDocumentObject*)object
+{
+	if(![self beginObject])
+		return NO;
+	
+	__block BOOL succeeded = YES;
+	[object enumerateKeysAndValuesUsingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		succeeded = ([self writeKey:key] && [self writeValue:value]);
+		return !succeeded;
+	}];
+	
+	return (succeeded && [self endObject]);
+}
+
+- (BOOL)writeDouble:(double)value
+{
+	if(!isfinite(value))
+		return [self failWithCode:JFJSONWriterErrorInvalidValue description:[NSString stringWithFormat:@"The number '%@' is not finite.", JFStringFromDouble(value)] underlyingError:nil];
+	
+	char buffer[JFNumberConversionBufferSize];
+	NSUInteger length = JFNumberConversionPrintDouble(value, buffer);
+	return [self writeLiteral:buffer length:length];
+}
+
+- (BOOL)writeInteger:(int64_t)value
+{
+	if(value >= 0)
+		return [self writeUnsignedInteger:(uint64_t)value];
+	
+	// The magnitude is computed in unsigned arithmetic, so that the minimum value doesn't overflow.
+	char buffer[24];
+	char* cursor = buffer + sizeof(buffer);
+	uint64_t magnitude = 0 - (uint64_t)value;
+	do
+	{
+		*--cursor = (char)('0' + magnitude % 10);
+		magnitude /= 10;
+	}
+	while(magnitude > 0);
+	*--cursor = '-';
+	return [self writeLiteral:cursor length:(NSUInteger)(buffer + sizeof(buffer) - cursor)];
+}
+
+- (BOOL)writeJSONArray:(JFJSONArray*)array
+{
+	if(![self beginArray])
+		return NO;
+	
+	// Packed arrays are read in chunks, without boxing their values.
+	JFJSONArrayStorage storage = array.storage;
+	if(storage != JFJSONArrayStorageObjects)
+	{
+		NSUInteger count = array.count;
+		for(NSUInteger location = 0; location < count; location += 256)
+		{
+			NSRange range = NSMakeRange(location, MIN(256, count - location));
+			if(storage == JFJSONArrayStorageDoubles)
+			{
+				double values[256];
+				[array getDoubles:values range:range];
+				for(NSUInteger index = 0; index < range.length; index++)
+				{
+					if(![self writeDouble:values[index]])
+						return NO;
+				}
+			}
+			else
+			{
+				int64_t values[256];
+				[array getIntegers:values range:range];
+				for(NSUInteger index = 0; index < range.length; index++)
+				{
+					if(![self writeInteger:values[index]])
+						return NO;
+				}
+			}
+		}
+		return [self endArray];
+	}
+	
+	__block BOOL succeeded = YES;
+	[array enumerateValuesUsingBlock:^BOOL(NSUInteger index, id<JFJSONValue> value) {
+		succeeded = [self writeValue:value];
+		return !succeeded;
+	}];
+	
+	return (succeeded && [self endArray]);
+}
+
+- (BOOL)writeJSONObject:(JFJSONObject*)object
+{
+	if(![self beginObject])
+		return NO;
+	
+	__block BOOL succeeded = YES;
+	[object enumerateKeysAndValuesUsingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		succeeded = ([self writeKey:key] && [self writeValue:value]);
+		return !succeeded;
+	}];
+	
+	return (succeeded && [self endObject]);
+}
+
+- (BOOL)writeLiteral:(const char*)literal length:(NSUInteger)length
+{
+	if(![self beginValue] || ![self appendBytes:literal length:length])
+		return NO;
+	
+	[self endValue];
+	return YES;
+}
+
+- (BOOL)writeNull
+{
+	return [self writeLiteral:"null" length:4];
+}
+
+- (BOOL)writeNumber:(NSNumber*)value
+{
+	if(CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID())
+		return [self writeBoolean:value.boolValue];
+	
+	switch(value.objCType[0])
+	{
+		case 'C':
+		case 'I':
+		case 'L':
+		case 'Q':
+		case 'S':
+			return [self writeUnsignedInteger:value.unsignedLongLongValue];
+		case 'd':
+			return [self writeDouble:value.doubleValue];
+		case 'f':
+		{
+			// Floats are printed with their own precision, so that `0.15f` is not written as `0.15000000596046448`.
+			float floatValue = value.floatValue;
+			if(!isfinite(floatValue))
+				return [self writeDouble:floatValue];
+			
+			char buffer[JFNumberConversionBufferSize];
+			NSUInteger length = JFNumberConversionPrintFloat(floatValue, buffer);
+			return [self writeLiteral:buffer length:length];
+		}
+		default:
+			return [self writeInteger:value.longLongValue];
+	}
+}
+
+- (BOOL)writeString:(NSString*)value
+{
+	if(![self beginValue] || ![self appendString:value])
+		return NO;
+	
+	[self endValue];
+	return YES;
+}
+
+- (BOOL)writeUnsignedInteger:(uint64_t)value
+{
+	char buffer[24];
+	char* cursor = buffer + sizeof(buffer);
+	do
+	{
+		*--cursor = (char)('0' + value % 10);
+		value /= 10;
+	}
+	while(value > 0);
+	return [self writeLiteral:cursor length:(NSUInteger)(buffer + sizeof(buffer) - cursor)];
+}
+
+- (BOOL)writeValue:(id<JFJSONConvertibleValue>)value
+{
+	switch(JFJSONValueKindOf(value))
+	{
+		case JFJSONValueKindArray:
+			return [self writeJSONArray:(JFJSONArray*)value];
+		case JFJSONValueKindNull:
+			return [self writeNull];
+		case JFJSONValueKindNumber:
+			return [self writeNumber:(NSNumber*)value];
+		case JFJSONValueKindObject:
+			return [self writeJSONObject:(JFJSONObject*)value];
+		case JFJSONValueKindString:
+			return [self writeString:(NSString*)value];
+		default:
+			break;
+	}
+	
+	if([value isKindOfClass:JFJSONDocumentArray.class])
+		return [self writeDocumentArray:(JFJSONDocumentArray*)value];
+	if([value isKindOfClass:JFJSONDocumentObject.class])
+		return [self writeDocumentObject:(JFJSONDocumentObject*)value];
+	if([value isKindOfClass:NSArray.class])
+		return [self writeArray:(NSArray*)value];
+	if([value isKindOfClass:NSDictionary.class])
+		return [self writeDictionary:(NSDictionary*)value];
+	
+	return [self failWithCode:JFJSONWriterErrorInvalidValue description:[NSString stringWithFormat:@"The value of class '%@' is not a JSON value.", NSStringFromClass(value.class)] underlyingError:nil];
+}
+
+- (BOOL)writeValue:(id<JFJSONConvertibleValue>)value forKey:(NSString*)key
+{
+	return ([self writeKey:key] && [self writeValue:value]);
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
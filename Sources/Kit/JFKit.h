@@ -51,6 +51,9 @@ FOUNDATION_EXPORT const unsigned char JFKitVersionString[];
 #import <JFKit/JFBlocks.h>
 #import <JFKit/JFBlockWrapper.h>
 #import <JFKit/JFByteStream.h>
+#import <JFKit/JFByteStreamAlgorithms.h>
+#import <JFKit/JFByteStreamBuilder.h>
+#import <JFKit/JFCBORSerializer.h>
 #import <JFKit/JFClosures.h>
 #import <JFKit/JFColors.h>
 #import <JFKit/JFCompatibilityMacros.h>
@@ -62,15 +65,21 @@ FOUNDATION_EXPORT const unsigned char JFKitVersionString[];
 #import <JFKit/JFHook.h>
 #import <JFKit/JFImages.h>
 #import <JFKit/JFJSONArray.h>
+#import <JFKit/JFJSONDecoder.h>
+#import <JFKit/JFJSONDocument.h>
 #import <JFKit/JFJSONNode.h>
 #import <JFKit/JFJSONObject.h>
+#import <JFKit/JFJSONPatch.h>
+#import <JFKit/JFJSONPath.h>
 #import <JFKit/JFJSONSerializationAdapter.h>
 #import <JFKit/JFJSONSerializer.h>
 #import <JFKit/JFJSONValue.h>
+#import <JFKit/JFJSONWriter.h>
 #import <JFKit/JFKitLogger.h>
 #import <JFKit/JFLazy.h>
 #import <JFKit/JFLogger.h>
 #import <JFKit/JFMath.h>
+#import <JFKit/JFNumberConversion.h>
 #import <JFKit/JFObjectIdentifier.h>
 #import <JFKit/JFObserversController.h>
 #import <JFKit/JFPair.h>
@@ -0,0 +1,80 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@import Foundation;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+/**
+ * The minimum size of the buffers passed to the print functions, including the terminating null character.
+ */
+#define JFNumberConversionBufferSize 32
+
+// =================================================================================================
+// MARK: Functions
+// =================================================================================================
+
+/**
+ * Converts the given bytes to a double value, using the JSON number grammar whatever the locale of the process.
+ * @discussion The result is always the double value nearest to the decimal number, with ties rounded to even. Numbers with up to 19 significant digits are converted without allocating memory or calling into the C library; longer numbers fall back to `strtod_l` only when the first 19 digits are not enough to decide the result.
+ * @param bytes The bytes to convert; they don't need to be null terminated.
+ * @param length The number of bytes to convert.
+ * @param outValue The converted value, if the bytes are a valid JSON number; values out of range are converted to infinity or to zero.
+ * @return `YES` if all the bytes form a valid JSON number, `NO` otherwise.
+ */
+FOUNDATION_EXPORT BOOL JFNumberConversionParseDouble(const char* bytes, NSUInteger length, double* outValue);
+
+/**
+ * Writes the shortest string that converts back to the given double value.
+ * @discussion The digits are generated with the Ryu algorithm, which always produces the shortest string that converts back to the same value and, among the shortest ones, the closest to it; the result doesn't depend on the locale of the process. Numbers whose decimal exponent goes from -6 to 20 are written in fixed notation (`0.15`, `100`), other numbers in scientific notation (`1e+21`, `1.5e-7`); integral values are written without the fraction. Special values are written as `nan`, `inf` and `-inf`.
+ * @param value The value to convert.
+ * @param buffer The buffer to write into; it must be at least `JFNumberConversionBufferSize` bytes long.
+ * @return The number of characters written, not including the terminating null character.
+ */
+FOUNDATION_EXPORT NSUInteger JFNumberConversionPrintDouble(double value, char* buffer);
+
+/**
+ * Writes the shortest string that converts back to the given float value.
+ * @discussion The string is generated like in `JFNumberConversionPrintDouble`, but using the precision of float values: `0.15f` is written as `0.15` and not as the digits of the nearest double value.
+ * @param value The value to convert.
+ * @param buffer The buffer to write into; it must be at least `JFNumberConversionBufferSize` bytes long.
+ * @return The number of characters written, not including the terminating null character.
+ */
+FOUNDATION_EXPORT NSUInteger JFNumberConversionPrintFloat(float value, char* buffer);
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -64,6 +64,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (NSUInteger)getID:(id<NSObject>)object;
 
+/**
+ * Returns the object associated with the given ID in the common registry.
+ * @param objectID The ID of the object to look for.
+ * @return The object associated with the given ID, or `nil` if no object with the given ID is registered or the object has been deallocated.
+ */
++ (id<NSObject> _Nullable)objectForID:(NSUInteger)objectID;
+
 /**
  * Removes the given object ID from the common registry; if no object with the given ID is registered yet, it does nothing.
  * @param objectID The ID of the object to unregister.
@@ -84,6 +91,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSUInteger)getID:(id<NSObject>)object;
 
+/**
+ * Returns the object associated with the given ID in the instance registry.
+ * @param objectID The ID of the object to look for.
+ * @return The object associated with the given ID, or `nil` if no object with the given ID is registered or the object has been deallocated.
+ */
+- (id<NSObject> _Nullable)objectForID:(NSUInteger)objectID;
+
 /**
  * Removes the given object ID from the instance registry; if no object with the given ID is registered yet, it does nothing.
  * @param objectID The ID of the object to unregister.
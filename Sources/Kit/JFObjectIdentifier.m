@@ -26,8 +26,12 @@
 
 #import "JFObjectIdentifier_Project.h"
 
+#import <objc/runtime.h>
+#import <os/lock.h>
+
 #import "JFReferences.h"
-#import "JFShortcuts.h"
+
+@class JFObjectIdentifierSentinel;
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
@@ -39,10 +43,11 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Macros
 // =================================================================================================
 
-#define CleanRegistryDelay kJFObjectIdentifierLegacyImplementationCleanRegistryDelay
-#define LegacyRegistry NSMutableDictionary<Reference*, NSNumber*>
+#define MinimumCapacity kJFObjectIdentifierLegacyImplementationMinimumCapacity
+#define ReclaimedSlotsPerOperation kJFObjectIdentifierLegacyImplementationReclaimedSlotsPerOperation
 #define Reference JFWeakReference<id<NSObject>>
-#define Registry NSMapTable<id<NSObject>, NSNumber*>
+#define ShardsCount kJFObjectIdentifierImplementationShardsCount
+#define Tombstone kJFObjectIdentifierLegacyImplementationTombstone
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
@@ -51,7 +56,54 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Constants
 // =================================================================================================
 
-static NSTimeInterval kJFObjectIdentifierLegacyImplementationCleanRegistryDelay = 10 /* seconds */;
+static NSUInteger const kJFObjectIdentifierImplementationShardsCount = 64; // Must match the shift in `shardForAddress:`.
+static NSUInteger const kJFObjectIdentifierLegacyImplementationMinimumCapacity = 16;
+static NSUInteger const kJFObjectIdentifierLegacyImplementationReclaimedSlotsPerOperation = 2;
+static uintptr_t const kJFObjectIdentifierLegacyImplementationTombstone = UINTPTR_MAX;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * A slice of the registry, guarded by its own lock: the entries are spread among the shards by key, so that threads working on different objects rarely wait for each other. Each shard takes a cache line of its own.
+ */
+typedef struct {
+	
+	/**
+	 * The lock that guards the table.
+	 */
+	os_unfair_lock lock;
+	
+	/**
+	 * The sentinels of the registered objects, keyed by object address or by ID; neither keys nor values are retained.
+	 */
+	CFMutableDictionaryRef table;
+} __attribute__((aligned(64))) JFObjectIdentifierShard;
+
+/**
+ * A slot of the open addressing table of the legacy registry.
+ */
+typedef struct {
+	
+	/**
+	 * The address of the registered object, `0` if the slot has never been used or `Tombstone` if its entry has been removed.
+	 */
+	uintptr_t address;
+	
+	/**
+	 * The ID of the registered object.
+	 */
+	NSUInteger objectID;
+	
+	/**
+	 * The retained weak reference to the registered object, used to detect that it has been deallocated.
+	 */
+	CFTypeRef _Nullable reference;
+} JFObjectIdentifierLegacySlot;
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
@@ -70,6 +122,7 @@ static NSTimeInterval kJFObjectIdentifierLegacyImplementationCleanRegistryDelay
 
 - (void)clearID:(id<NSObject>)object;
 - (NSUInteger)getID:(id<NSObject>)object;
+- (id<NSObject> _Nullable)objectForID:(NSUInteger)objectID;
 - (void)resetID:(NSUInteger)objectID;
 
 @end
@@ -90,7 +143,7 @@ static NSTimeInterval kJFObjectIdentifierLegacyImplementationCleanRegistryDelay
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
 
-API_AVAILABLE(ios(8.0), macos(10.8))
+API_AVAILABLE(ios(10.0), macos(10.12))
 @interface JFObjectIdentifierImplementation : NSObject <JFObjectIdentifierImplementation>
 
 // =================================================================================================
@@ -98,7 +151,48 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 // =================================================================================================
 
 @property (assign, readonly, getter=getAndIncrementNextFreeID) NSUInteger nextFreeID;
-@property (strong, nonatomic, readonly) Registry* registry;
+
+// =================================================================================================
+// MARK: Methods - Identifiers
+// =================================================================================================
+
+- (void)removeSentinel:(__unsafe_unretained JFObjectIdentifierSentinel*)sentinel;
+
+// =================================================================================================
+// MARK: Methods - Utilities
+// =================================================================================================
+
+- (const void* _Nullable)lockedSentinelForID:(NSUInteger)objectID shard:(JFObjectIdentifierShard* _Nonnull * _Nonnull)outShard;
+- (void)lockedUnregisterSentinel:(__unsafe_unretained JFObjectIdentifierSentinel*)sentinel inShard:(JFObjectIdentifierShard*)shard;
+- (JFObjectIdentifierShard*)shardForAddress:(uintptr_t)address;
+- (JFObjectIdentifierShard*)shardForID:(NSUInteger)objectID;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * An object attached to each registered object, that holds its ID and removes it from the registry when it's deallocated. Its properties are guarded by the lock of the shard of its address.
+ */
+API_AVAILABLE(ios(10.0), macos(10.12))
+@interface JFObjectIdentifierSentinel : NSObject
+
+// =================================================================================================
+// MARK: Properties - Identifiers
+// =================================================================================================
+
+@property (assign, nonatomic, readonly) uintptr_t address;
+@property (weak, nonatomic, readonly) JFObjectIdentifierImplementation* implementation;
+@property (weak, nonatomic, readonly, nullable) id<NSObject> object;
+@property (assign, nonatomic) NSUInteger objectID;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithImplementation:(JFObjectIdentifierImplementation*)implementation object:(id<NSObject>)object NS_DESIGNATED_INITIALIZER;
 
 @end
 
@@ -111,22 +205,24 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 // MARK: Properties - Identifiers
 // =================================================================================================
 
-@property (assign) BOOL needsCleanRegistry;
 @property (assign, readonly, getter=getAndIncrementNextFreeID) NSUInteger nextFreeID;
-@property (strong, nonatomic, readonly) LegacyRegistry* registry;
 
 // =================================================================================================
 // MARK: Methods - Identifiers
 // =================================================================================================
 
-- (void)cleanRegistry;
-- (void)cleanRegistryIfNeeded;
+- (void)reclaimSlots;
+- (void)removeSlot:(JFObjectIdentifierLegacySlot*)slot;
 
 // =================================================================================================
 // MARK: Methods - Utilities
 // =================================================================================================
 
-- (Reference* _Nullable)referenceForObject:(id<NSObject>)object;
+- (BOOL)isSlotAlive:(JFObjectIdentifierLegacySlot*)slot;
+- (void)resizeSlotsIfNeeded;
+- (JFObjectIdentifierLegacySlot* _Nullable)slotForObject:(id<NSObject>)object;
+- (JFObjectIdentifierLegacySlot* _Nullable)slotForObjectID:(NSUInteger)objectID;
+- (NSUInteger)slotIndexForAddress:(uintptr_t)address;
 
 @end
 
@@ -173,7 +269,7 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 	self = [super init];
 	
 	id<JFObjectIdentifierImplementation> implementation;
-	if(@available(macOS 10.8, *))
+	if(@available(macOS 10.12, iOS 10.0, *))
 		implementation = [JFObjectIdentifierImplementation new];
 	else
 		implementation = [JFObjectIdentifierLegacyImplementation new];
@@ -183,7 +279,7 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 	return self;
 }
 
-- (instancetype)initWithCurrentImplementation API_AVAILABLE(ios(8.0), macos(10.8))
+- (instancetype)initWithCurrentImplementation API_AVAILABLE(ios(10.0), macos(10.12))
 {
 	self = [super init];
 	
@@ -216,6 +312,11 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 	return [JFObjectIdentifier.sharedInstance getID:object];
 }
 
++ (id<NSObject> _Nullable)objectForID:(NSUInteger)objectID
+{
+	return [JFObjectIdentifier.sharedInstance objectForID:objectID];
+}
+
 + (void)resetID:(NSUInteger)objectID
 {
 	[JFObjectIdentifier.sharedInstance resetID:objectID];
@@ -231,6 +332,11 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 	return [self.implementation getID:object];
 }
 
+- (id<NSObject> _Nullable)objectForID:(NSUInteger)objectID
+{
+	return [self.implementation objectForID:objectID];
+}
+
 - (void)resetID:(NSUInteger)objectID
 {
 	[self.implementation resetID:objectID];
@@ -242,13 +348,17 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 // MARK: -
 
 @implementation JFObjectIdentifierImplementation
+{
+	JFObjectIdentifierShard* _addressShards;
+	JFObjectIdentifierShard* _idShards;
+	const void* _sentinelKey;
+}
 
 // =================================================================================================
 // MARK: Fields - Identifiers
 // =================================================================================================
 
 @synthesize nextFreeID = _nextFreeID;
-@synthesize registry = _registry;
 
 // =================================================================================================
 // MARK: Properties - Identifiers
@@ -256,31 +366,58 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 
 - (NSUInteger)count
 {
-	Registry* registry = self.registry;
-	@synchronized(registry)
+	NSUInteger retVal = 0;
+	for(NSUInteger i = 0; i < ShardsCount; i++)
 	{
-		return registry.count;
+		JFObjectIdentifierShard* shard = &_addressShards[i];
+		os_unfair_lock_lock(&shard->lock);
+		retVal += (NSUInteger)CFDictionaryGetCount(shard->table);
+		os_unfair_lock_unlock(&shard->lock);
 	}
+	return retVal;
 }
 
 - (NSUInteger)getAndIncrementNextFreeID
 {
-	@synchronized(self)
-	{
-		return _nextFreeID++;
-	}
+	return __atomic_fetch_add(&_nextFreeID, 1, __ATOMIC_RELAXED);
 }
 
 // =================================================================================================
 // MARK: Lifecycle
 // =================================================================================================
 
+- (void)dealloc
+{
+	if(!_addressShards)
+		return;
+	
+	for(NSUInteger i = 0; i < ShardsCount * 2; i++)
+		CFRelease(_addressShards[i].table);
+	free(_addressShards);
+}
+
 - (instancetype)init
 {
 	self = [super init];
 	
+	// The shards of the addresses and the ones of the IDs share a single allocation.
+	void* shards = NULL;
+	if(posix_memalign(&shards, _Alignof(JFObjectIdentifierShard), ShardsCount * 2 * sizeof(JFObjectIdentifierShard)) != 0)
+		return nil;
+	
+	_addressShards = shards;
+	_idShards = _addressShards + ShardsCount;
 	_nextFreeID = 0;
-	_registry = [Registry mapTableWithKeyOptions:(NSMapTableWeakMemory | NSMapTableObjectPointerPersonality) valueOptions:NSMapTableStrongMemory];
+	
+	// The key of the sentinels is never reused, not even by an implementation allocated where a deallocated one was: the sentinels it left on the objects must not be picked up again.
+	static uintptr_t nextSentinelKey = 0;
+	_sentinelKey = (const void*)__atomic_add_fetch(&nextSentinelKey, 1, __ATOMIC_RELAXED);
+	
+	for(NSUInteger i = 0; i < ShardsCount * 2; i++)
+	{
+		_addressShards[i].lock = OS_UNFAIR_LOCK_INIT;
+		_addressShards[i].table = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+	}
 	
 	return self;
 }
@@ -291,48 +428,142 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 
 - (void)clearID:(id<NSObject>)object
 {
-	Registry* registry = self.registry;
-	@synchronized(registry)
-	{
-		[registry removeObjectForKey:object];
-	}
+	const void* address = (__bridge const void*)object;
+	JFObjectIdentifierShard* shard = [self shardForAddress:(uintptr_t)address];
+	
+	os_unfair_lock_lock(&shard->lock);
+	__unsafe_unretained JFObjectIdentifierSentinel* sentinel = (__bridge JFObjectIdentifierSentinel*)CFDictionaryGetValue(shard->table, address);
+	if(sentinel)
+		[self lockedUnregisterSentinel:sentinel inShard:shard];
+	os_unfair_lock_unlock(&shard->lock);
 }
 
 - (NSUInteger)getID:(id<NSObject>)object
 {
-	Registry* registry = self.registry;
-	@synchronized(registry)
+	const void* address = (__bridge const void*)object;
+	JFObjectIdentifierShard* shard = [self shardForAddress:(uintptr_t)address];
+	
+	os_unfair_lock_lock(&shard->lock);
+	
+	// The sentinels in the tables are never retained: one may be in the middle of its deallocation, waiting for the lock to remove itself.
+	__unsafe_unretained JFObjectIdentifierSentinel* registeredSentinel = (__bridge JFObjectIdentifierSentinel*)CFDictionaryGetValue(shard->table, address);
+	if(registeredSentinel)
 	{
-		NSUInteger retVal;
-		NSNumber* value = [registry objectForKey:object];
-		if(value != nil)
-			retVal = [value unsignedIntegerValue];
-		else
-		{
-			retVal = [self getAndIncrementNextFreeID];
-			[registry setObject:@(retVal) forKey:object];
-		}
+		NSUInteger retVal = registeredSentinel.objectID;
+		os_unfair_lock_unlock(&shard->lock);
 		return retVal;
 	}
+	
+	// The sentinel is attached only once by each implementation and never replaced, so that no sentinel is ever deallocated while the lock is held; since every object always maps to the same shard, checking and attaching it here is atomic.
+	JFObjectIdentifierSentinel* sentinel = objc_getAssociatedObject(object, _sentinelKey);
+	if(!sentinel)
+	{
+		sentinel = [[JFObjectIdentifierSentinel alloc] initWithImplementation:self object:object];
+		objc_setAssociatedObject(object, _sentinelKey, sentinel, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	}
+	
+	NSUInteger retVal = [self getAndIncrementNextFreeID];
+	sentinel.objectID = retVal;
+	CFDictionarySetValue(shard->table, address, (__bridge const void*)sentinel);
+	
+	// The shards of the addresses are always locked before the ones of the IDs.
+	JFObjectIdentifierShard* idShard = [self shardForID:retVal];
+	os_unfair_lock_lock(&idShard->lock);
+	CFDictionarySetValue(idShard->table, (const void*)(uintptr_t)retVal, (__bridge const void*)sentinel);
+	os_unfair_lock_unlock(&idShard->lock);
+	
+	os_unfair_lock_unlock(&shard->lock);
+	
+	return retVal;
+}
+
+- (id<NSObject> _Nullable)objectForID:(NSUInteger)objectID
+{
+	JFObjectIdentifierShard* shard = NULL;
+	__unsafe_unretained JFObjectIdentifierSentinel* sentinel = (__bridge JFObjectIdentifierSentinel*)[self lockedSentinelForID:objectID shard:&shard];
+	if(!sentinel)
+		return nil;
+	
+	// The weak reference is nil if the object is being deallocated.
+	id<NSObject> retObj = sentinel.object;
+	os_unfair_lock_unlock(&shard->lock);
+	return retObj;
+}
+
+- (void)removeSentinel:(__unsafe_unretained JFObjectIdentifierSentinel*)sentinel
+{
+	const void* address = (const void*)sentinel.address;
+	JFObjectIdentifierShard* shard = [self shardForAddress:(uintptr_t)address];
+	
+	os_unfair_lock_lock(&shard->lock);
+	if(CFDictionaryGetValue(shard->table, address) == (__bridge const void*)sentinel)
+		[self lockedUnregisterSentinel:sentinel inShard:shard];
+	os_unfair_lock_unlock(&shard->lock);
 }
 
 - (void)resetID:(NSUInteger)objectID
 {
-	Registry* registry = self.registry;
-	@synchronized(registry)
+	JFObjectIdentifierShard* shard = NULL;
+	__unsafe_unretained JFObjectIdentifierSentinel* sentinel = (__bridge JFObjectIdentifierSentinel*)[self lockedSentinelForID:objectID shard:&shard];
+	if(!sentinel)
+		return;
+	
+	[self lockedUnregisterSentinel:sentinel inShard:shard];
+	os_unfair_lock_unlock(&shard->lock);
+}
+
+// =================================================================================================
+// MARK: Methods - Utilities
+// =================================================================================================
+
+- (const void* _Nullable)lockedSentinelForID:(NSUInteger)objectID shard:(JFObjectIdentifierShard* _Nonnull * _Nonnull)outShard
+{
+	// The address is read from the reverse index first; since the shards of the IDs can't be held while locking the ones of the addresses, the entry is checked again once the shard of the address is locked.
+	JFObjectIdentifierShard* idShard = [self shardForID:objectID];
+	os_unfair_lock_lock(&idShard->lock);
+	__unsafe_unretained JFObjectIdentifierSentinel* sentinel = (__bridge JFObjectIdentifierSentinel*)CFDictionaryGetValue(idShard->table, (const void*)(uintptr_t)objectID);
+	uintptr_t address = sentinel.address;
+	os_unfair_lock_unlock(&idShard->lock);
+	
+	if(!sentinel)
+		return NULL;
+	
+	// The sentinel may have been deallocated meanwhile: only its address is used until the entry is found again.
+	JFObjectIdentifierShard* shard = [self shardForAddress:address];
+	os_unfair_lock_lock(&shard->lock);
+	sentinel = (__bridge JFObjectIdentifierSentinel*)CFDictionaryGetValue(shard->table, (const void*)address);
+	if(!sentinel || (sentinel.objectID != objectID))
 	{
-		NSNumber* number = @(objectID);
-		
-		NSMutableArray<id<NSObject>>* objects = [NSMutableArray<id<NSObject>> array];
-		for(id<NSObject> object in registry)
-		{
-			if([[registry objectForKey:object] isEqualToNumber:number])
-				[objects addObject:object];
-		}
-		
-		for(id<NSObject> object in objects)
-			[registry removeObjectForKey:object];
+		os_unfair_lock_unlock(&shard->lock);
+		return NULL;
 	}
+	
+	*outShard = shard;
+	return (__bridge const void*)sentinel;
+}
+
+- (void)lockedUnregisterSentinel:(__unsafe_unretained JFObjectIdentifierSentinel*)sentinel inShard:(JFObjectIdentifierShard*)shard
+{
+	CFDictionaryRemoveValue(shard->table, (const void*)sentinel.address);
+	
+	const void* key = (const void*)(uintptr_t)sentinel.objectID;
+	JFObjectIdentifierShard* idShard = [self shardForID:sentinel.objectID];
+	os_unfair_lock_lock(&idShard->lock);
+	if(CFDictionaryGetValue(idShard->table, key) == (__bridge const void*)sentinel)
+		CFDictionaryRemoveValue(idShard->table, key);
+	os_unfair_lock_unlock(&idShard->lock);
+}
+
+- (JFObjectIdentifierShard*)shardForAddress:(uintptr_t)address
+{
+	// Fibonacci hashing: the top 6 bits of the product depend on all the bits of the address and select one of the 64 shards.
+	return &_addressShards[((uint64_t)address * 0x9E3779B97F4A7C15ULL) >> 58];
+}
+
+- (JFObjectIdentifierShard*)shardForID:(NSUInteger)objectID
+{
+	// The IDs are sequential: consecutive ones go to consecutive shards.
+	return &_idShards[objectID % ShardsCount];
 }
 
 @end
@@ -340,54 +571,71 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
 
-@implementation JFObjectIdentifierLegacyImplementation
+@implementation JFObjectIdentifierSentinel
 
 // =================================================================================================
 // MARK: Fields - Identifiers
 // =================================================================================================
 
-@synthesize needsCleanRegistry = _needsCleanRegistry;
-@synthesize nextFreeID = _nextFreeID;
-@synthesize registry = _registry;
+@synthesize address = _address;
+@synthesize implementation = _implementation;
+@synthesize object = _object;
+@synthesize objectID = _objectID;
 
 // =================================================================================================
-// MARK: Properties - Identifiers
+// MARK: Lifecycle
 // =================================================================================================
 
-- (NSUInteger)count
+- (void)dealloc
 {
-	LegacyRegistry* registry = self.registry;
-	@synchronized(registry)
-	{
-		return registry.count;
-	}
+	// The sentinel is released while its object is being deallocated, before the address can be reused by another object.
+	[_implementation removeSentinel:self];
 }
 
-- (BOOL)needsCleanRegistry
+- (instancetype)initWithImplementation:(JFObjectIdentifierImplementation*)implementation object:(id<NSObject>)object
 {
-	@synchronized(self)
-	{
-		return _needsCleanRegistry;
-	}
+	self = [super init];
+	
+	_address = (uintptr_t)(__bridge void*)object;
+	_implementation = implementation;
+	_object = object;
+	_objectID = 0;
+	
+	return self;
 }
 
-- (void)setNeedsCleanRegistry:(BOOL)needsCleanRegistry
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFObjectIdentifierLegacyImplementation
+{
+	NSUInteger _capacity;
+	NSUInteger _capacityShift;
+	NSUInteger _count;
+	NSUInteger _reclaimCursor;
+	CFMutableDictionaryRef _reverseRegistry;
+	JFObjectIdentifierLegacySlot* _slots;
+	NSUInteger _usedCount;
+}
+
+// =================================================================================================
+// MARK: Fields - Identifiers
+// =================================================================================================
+
+@synthesize nextFreeID = _nextFreeID;
+
+// =================================================================================================
+// MARK: Properties - Identifiers
+// =================================================================================================
+
+- (NSUInteger)count
 {
 	@synchronized(self)
 	{
-		if(_needsCleanRegistry == needsCleanRegistry)
-			return;
-		
-		_needsCleanRegistry = needsCleanRegistry;
+		return _count;
 	}
-	
-	if(!needsCleanRegistry)
-		return;
-	
-	JFWeakifySelf;
-	dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(CleanRegistryDelay * NSEC_PER_SEC)), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0), ^{
-		[weakSelf cleanRegistryIfNeeded];
-	});
 }
 
 - (NSUInteger)getAndIncrementNextFreeID
@@ -402,13 +650,35 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 // MARK: Lifecycle
 // =================================================================================================
 
+- (void)dealloc
+{
+	for(NSUInteger i = 0; i < _capacity; i++)
+	{
+		if(_slots[i].reference)
+			CFRelease(_slots[i].reference);
+	}
+	free(_slots);
+	
+	if(_reverseRegistry)
+		CFRelease(_reverseRegistry);
+}
+
 - (instancetype)init
 {
 	self = [super init];
 	
-	_needsCleanRegistry = NO;
+	JFObjectIdentifierLegacySlot* slots = calloc(MinimumCapacity, sizeof(JFObjectIdentifierLegacySlot));
+	if(!slots)
+		return nil;
+	
+	_capacity = MinimumCapacity;
+	_capacityShift = 64 - (NSUInteger)__builtin_ctzll(_capacity);
+	_count = 0;
 	_nextFreeID = 0;
-	_registry = [LegacyRegistry new];
+	_reclaimCursor = 0;
+	_reverseRegistry = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+	_slots = slots;
+	_usedCount = 0;
 	
 	return self;
 }
@@ -417,74 +687,94 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 // MARK: Methods - Identifiers
 // =================================================================================================
 
-- (void)cleanRegistry
+- (void)clearID:(id<NSObject>)object
 {
-	LegacyRegistry* registry = self.registry;
-	@synchronized(registry)
+	@synchronized(self)
 	{
-		for(Reference* reference in registry.allKeys)
-		{
-			if(!reference.object)
-				[registry removeObjectForKey:reference];
-		}
+		[self reclaimSlots];
+		
+		JFObjectIdentifierLegacySlot* slot = [self slotForObject:object];
+		if(slot)
+			[self removeSlot:slot];
 	}
 }
 
-- (void)cleanRegistryIfNeeded
+- (NSUInteger)getID:(id<NSObject>)object
 {
 	@synchronized(self)
 	{
-		if(![self needsCleanRegistry])
-			return;
+		[self reclaimSlots];
+		
+		JFObjectIdentifierLegacySlot* slot = [self slotForObject:object];
+		if(slot)
+			return slot->objectID;
+		
+		[self resizeSlotsIfNeeded];
+		
+		// The object is not registered: it takes the first slot of its probe sequence that is not in use.
+		uintptr_t address = (uintptr_t)(__bridge void*)object;
+		NSUInteger mask = _capacity - 1;
+		NSUInteger index = [self slotIndexForAddress:address];
+		while((_slots[index].address != 0) && (_slots[index].address != Tombstone))
+			index = (index + 1) & mask;
+		
+		slot = &_slots[index];
+		if(slot->address == 0)
+			_usedCount++;
+		
+		NSUInteger retVal = [self getAndIncrementNextFreeID];
+		slot->address = address;
+		slot->objectID = retVal;
+		slot->reference = CFBridgingRetain([Reference referenceWithObject:object]);
+		CFDictionarySetValue(_reverseRegistry, (const void*)(uintptr_t)retVal, (const void*)address);
+		_count++;
 		
-		self.needsCleanRegistry = NO;
+		return retVal;
 	}
-	
-	[self cleanRegistry];
 }
 
-- (void)clearID:(id<NSObject>)object
+- (id<NSObject> _Nullable)objectForID:(NSUInteger)objectID
 {
-	LegacyRegistry* registry = self.registry;
-	@synchronized(registry)
+	@synchronized(self)
 	{
-		Reference* reference = [self referenceForObject:object];
-		if(reference)
-			[registry removeObjectForKey:reference];
+		JFObjectIdentifierLegacySlot* slot = [self slotForObjectID:objectID];
+		return (slot ? ((__bridge Reference*)slot->reference).object : nil);
 	}
 }
 
-- (NSUInteger)getID:(id<NSObject>)object
+- (void)reclaimSlots
 {
-	LegacyRegistry* registry = self.registry;
-	@synchronized(registry)
+	// Instead of sweeping the whole table at once, every operation checks the next few slots: the entries of the deallocated objects are removed in a steady trickle.
+	NSUInteger mask = _capacity - 1;
+	for(NSUInteger i = 0; i < ReclaimedSlotsPerOperation; i++)
 	{
-		Reference* reference = [self referenceForObject:object];
-		if(reference)
-		{
-			NSNumber* value = [registry objectForKey:reference];
-			if(value != nil)
-				return [value unsignedIntegerValue];
-			
-			reference.object = object;
-		}
-		else
-			reference = [Reference referenceWithObject:object];
-		
-		NSUInteger retVal = [self getAndIncrementNextFreeID];
-		[registry setObject:@(retVal) forKey:reference];
-		
-		return retVal;
+		JFObjectIdentifierLegacySlot* slot = &_slots[_reclaimCursor];
+		_reclaimCursor = (_reclaimCursor + 1) & mask;
+		if((slot->address != 0) && (slot->address != Tombstone) && ![self isSlotAlive:slot])
+			[self removeSlot:slot];
 	}
 }
 
+- (void)removeSlot:(JFObjectIdentifierLegacySlot*)slot
+{
+	const void* key = (const void*)(uintptr_t)slot->objectID;
+	if(CFDictionaryGetValue(_reverseRegistry, key) == (const void*)slot->address)
+		CFDictionaryRemoveValue(_reverseRegistry, key);
+	
+	CFRelease(slot->reference);
+	slot->address = Tombstone;
+	slot->objectID = 0;
+	slot->reference = NULL;
+	_count--;
+}
+
 - (void)resetID:(NSUInteger)objectID
 {
-	LegacyRegistry* registry = self.registry;
-	@synchronized(registry)
+	@synchronized(self)
 	{
-		for(Reference* reference in [registry allKeysForObject:@(objectID)])
-			[registry removeObjectForKey:reference];
+		JFObjectIdentifierLegacySlot* slot = [self slotForObjectID:objectID];
+		if(slot)
+			[self removeSlot:slot];
 	}
 }
 
@@ -492,31 +782,102 @@ API_AVAILABLE(ios(8.0), macos(10.8))
 // MARK: Methods - Utilities
 // =================================================================================================
 
-- (Reference* _Nullable)referenceForObject:(id<NSObject>)object
+- (BOOL)isSlotAlive:(JFObjectIdentifierLegacySlot*)slot
+{
+	return (((__bridge Reference*)slot->reference).object != nil);
+}
+
+- (void)resizeSlotsIfNeeded
 {
-	Reference* retObj = nil;
-	BOOL needsCleanRegistry = NO;
+	// The load factor, tombstones included, is kept under 3/4.
+	if((_usedCount + 1) * 4 <= _capacity * 3)
+		return;
 	
-	for(Reference* reference in self.registry)
+	// The table grows only if the live entries fill more than half of it; otherwise it's rebuilt to get rid of the tombstones.
+	NSUInteger capacity = _capacity;
+	if((_count + 1) * 2 > capacity)
+		capacity *= 2;
+	
+	JFObjectIdentifierLegacySlot* slots = calloc(capacity, sizeof(JFObjectIdentifierLegacySlot));
+	if(!slots)
+		return;
+	
+	JFObjectIdentifierLegacySlot* oldSlots = _slots;
+	NSUInteger oldCapacity = _capacity;
+	
+	_capacity = capacity;
+	_capacityShift = 64 - (NSUInteger)__builtin_ctzll(capacity);
+	_count = 0;
+	_reclaimCursor = 0;
+	_slots = slots;
+	_usedCount = 0;
+	
+	NSUInteger mask = capacity - 1;
+	for(NSUInteger i = 0; i < oldCapacity; i++)
 	{
-		NSObject* referencedObject = reference.object;
-		if(!referencedObject)
-		{
-			needsCleanRegistry = YES;
+		JFObjectIdentifierLegacySlot* oldSlot = &oldSlots[i];
+		if((oldSlot->address == 0) || (oldSlot->address == Tombstone))
 			continue;
-		}
 		
-		if(referencedObject == object)
+		// The entries of the deallocated objects are dropped while moving.
+		if(![self isSlotAlive:oldSlot])
 		{
-			retObj = reference;
-			break;
+			CFDictionaryRemoveValue(_reverseRegistry, (const void*)(uintptr_t)oldSlot->objectID);
+			CFRelease(oldSlot->reference);
+			continue;
 		}
+		
+		NSUInteger index = [self slotIndexForAddress:oldSlot->address];
+		while(_slots[index].address != 0)
+			index = (index + 1) & mask;
+		
+		_slots[index] = *oldSlot;
+		_count++;
+		_usedCount++;
 	}
 	
-	if(needsCleanRegistry)
-		self.needsCleanRegistry = YES;
+	free(oldSlots);
+}
+
+- (JFObjectIdentifierLegacySlot* _Nullable)slotForObject:(id<NSObject>)object
+{
+	uintptr_t address = (uintptr_t)(__bridge void*)object;
+	NSUInteger mask = _capacity - 1;
+	for(NSUInteger index = [self slotIndexForAddress:address]; _slots[index].address != 0; index = (index + 1) & mask)
+	{
+		JFObjectIdentifierLegacySlot* slot = &_slots[index];
+		if(slot->address != address)
+			continue;
+		
+		// The address may belong to a new object, allocated where a registered one has been deallocated: the stale entry is turned into a tombstone on the spot.
+		if(((__bridge Reference*)slot->reference).object == object)
+			return slot;
+		
+		[self removeSlot:slot];
+	}
+	return NULL;
+}
+
+- (JFObjectIdentifierLegacySlot* _Nullable)slotForObjectID:(NSUInteger)objectID
+{
+	const void* address = NULL;
+	if(!CFDictionaryGetValueIfPresent(_reverseRegistry, (const void*)(uintptr_t)objectID, &address))
+		return NULL;
 	
-	return retObj;
+	NSUInteger mask = _capacity - 1;
+	for(NSUInteger index = [self slotIndexForAddress:(uintptr_t)address]; _slots[index].address != 0; index = (index + 1) & mask)
+	{
+		JFObjectIdentifierLegacySlot* slot = &_slots[index];
+		if((slot->address == (uintptr_t)address) && (slot->objectID == objectID))
+			return slot;
+	}
+	return NULL;
+}
+
+- (NSUInteger)slotIndexForAddress:(uintptr_t)address
+{
+	// Fibonacci hashing: the top bits of the product depend on all the bits of the address.
+	return (NSUInteger)(((uint64_t)address * 0x9E3779B97F4A7C15ULL) >> _capacityShift);
 }
 
 @end
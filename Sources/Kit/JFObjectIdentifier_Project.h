@@ -44,7 +44,7 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Lifecycle
 // =================================================================================================
 
-- (instancetype)initWithCurrentImplementation API_AVAILABLE(ios(8.0), macos(10.8));
+- (instancetype)initWithCurrentImplementation API_AVAILABLE(ios(10.0), macos(10.12));
 - (instancetype)initWithLegacyImplementation;
 
 @end
@@ -32,8 +32,32 @@ NS_ASSUME_NONNULL_BEGIN
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+/**
+ * A list of the ways the notifications waiting in the serial pipeline of an observers controller can be coalesced.
+ */
+typedef NS_ENUM(UInt8, JFObserversControllerCoalescingPolicy)
+{
+	/**
+	 * Every pending notification is delivered, in the order it has been sent.
+	 */
+	JFObserversControllerCoalescingPolicyNone,
+	
+	/**
+	 * Only the last pending notification is delivered: the previous ones are superseded and dropped.
+	 */
+	JFObserversControllerCoalescingPolicyLatestOnly,
+};
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
 /**
  * The `JFObserversController` manages the observers of its owner and dispatches notifications to them in many ways.
+ * The observers are notified in the order they have been added. Adding and removing observers never slows down the notifications, which iterate an immutable snapshot of the observers that is copied again only after a change.
  * `ObserverType` defines the type of the object that is observing the owner and is expected to handle the dispatched notifications.
  * @warning On systems where the `weak` keyword is not available, to prevent the risk of a dangling pointer creation you must manually remove any observer before it gets deallocated.
  */
@@ -44,10 +68,24 @@ NS_ASSUME_NONNULL_BEGIN
 // =================================================================================================
 
 /**
- * The number of registered observers.
+ * The number of registered observers; the observers deallocated without being removed are not counted.
  */
 @property (assign, readonly) NSUInteger count;
 
+// =================================================================================================
+// MARK: Properties - Notifications
+// =================================================================================================
+
+/**
+ * How the notifications waiting in the serial pipeline are coalesced; the default value is `JFObserversControllerCoalescingPolicyNone`.
+ */
+@property (assign) JFObserversControllerCoalescingPolicy coalescingPolicy;
+
+/**
+ * The block that is called when an observer notified concurrently exceeds its timeout: it's called once when the timeout expires, with `finished` set to `NO`, and again when the observer eventually returns, with `finished` set to `YES` and the actual duration of the notification.
+ */
+@property (copy, nullable) void (^slowObserverHandler)(ObserverType observer, NSTimeInterval duration, BOOL finished);
+
 // =================================================================================================
 // MARK: Methods - Notifications
 // =================================================================================================
@@ -65,6 +103,16 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)notifyObservers:(void(^)(ObserverType observer))notificationBlock async:(BOOL)async;
 
+/**
+ * Asynchronously dispatch a notification block to the registered observers concurrently, so that a slow observer does not delay the others.
+ * @discussion At most `maxConcurrentObservers` observers are notified at the same time. An observer that exceeds the timeout is reported to the `slowObserverHandler` and stops counting against the limit, letting the next observer start; its notification block is not interrupted.
+ * @param notificationBlock The notification block to execute against each registered observer.
+ * @param maxConcurrentObservers The maximum number of observers notified at the same time, or `0` for no limit.
+ * @param timeout The time after which an observer is considered slow, or `0` for no timeout.
+ * @param completion The block to execute when every observer has either returned or exceeded the timeout.
+ */
+- (void)notifyObservers:(void(^)(ObserverType observer))notificationBlock maxConcurrentObservers:(NSUInteger)maxConcurrentObservers timeout:(NSTimeInterval)timeout completion:(void(^ _Nullable)(void))completion;
+
 /**
  * Dispatch a notification block to each registered observer.
  * @param notificationBlock The notification block to execute against each registered observer.
@@ -74,6 +122,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)notifyObservers:(void(^)(ObserverType observer))notificationBlock queue:(NSOperationQueue*)queue waitUntilFinished:(BOOL)waitUntilFinished;
 
+/**
+ * Asynchronously dispatch a notification block to each registered observer through the serial pipeline of the controller, so that each observer receives the notifications in the order they have been sent.
+ * @discussion The notifications sent while the pipeline is busy are collected and delivered together as a batch, observer by observer, with a single dispatch; they may be coalesced according to the value of the property `coalescingPolicy`. The observers are the ones registered when the batch is delivered.
+ * @param notificationBlock The notification block to execute against each registered observer.
+ */
+- (void)notifyObserversSerially:(void(^)(ObserverType observer))notificationBlock;
+
 // =================================================================================================
 // MARK: Methods - Observers
 // =================================================================================================
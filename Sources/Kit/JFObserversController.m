@@ -26,9 +26,10 @@
 
 #import "JFObserversController.h"
 
+#import <os/lock.h>
+
 #import "JFBlocks.h"
 #import "JFPreprocessorMacros.h"
-#import "JFReferences.h"
 #import "JFShortcuts.h"
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -38,10 +39,64 @@ NS_ASSUME_NONNULL_BEGIN
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 // =================================================================================================
-// MARK: Macros - Types
+// MARK: Macros
+// =================================================================================================
+
+#define Entry JFObserversControllerEntry
+#define FanOut JFObserversControllerFanOut
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * A registered observer: it's held weakly, together with its address, so that its entry can still be found after it has been deallocated.
+ */
+@interface JFObserversControllerEntry : NSObject
+
+// =================================================================================================
+// MARK: Properties - Observers
+// =================================================================================================
+
+@property (assign, nonatomic, readonly) uintptr_t address;
+@property (weak, nonatomic, readonly, nullable) id observer;
+@property (assign, nonatomic, getter=isRemoved) BOOL removed;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithObserver:(id)observer NS_DESIGNATED_INITIALIZER;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * A concurrent notification in progress: it starts a new observer whenever a running one returns or exceeds the timeout, so that no more than the given number of observers are running at the same time.
+ */
+@interface JFObserversControllerFanOut : NSObject
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithController:(JFObserversController*)controller snapshot:(NSArray<Entry*>*)snapshot notificationBlock:(void(^)(id observer))notificationBlock timeout:(NSTimeInterval)timeout completion:(JFBlock _Nullable)completion NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - Notifications
 // =================================================================================================
 
-#define Reference JFWeakReference
+- (void)complete;
+- (BOOL)finishSlot;
+- (void)notifyObserver:(id)observer;
+- (void)releaseSlot;
+- (void)startNextObserver;
+- (void)startWithMaxConcurrentObservers:(NSUInteger)maxConcurrentObservers;
+
+@end
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
@@ -52,8 +107,15 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Properties - Observers
 // =================================================================================================
 
-@property (assign, nonatomic) BOOL needsCleanUp;
-@property (strong, nonatomic, readonly) NSMutableArray<Reference<ObserverType>*>* references;
+@property (assign) BOOL needsCleanUp;
+@property (strong, nullable) NSArray<Entry*>* publishedEntries;
+
+// =================================================================================================
+// MARK: Methods - Notifications
+// =================================================================================================
+
+- (void)deliverPendingNotifications;
+- (void)notifyEntries:(NSArray<Entry*>*)entries notificationBlock:(void(^)(ObserverType observer))notificationBlock;
 
 // =================================================================================================
 // MARK: Methods - Observers
@@ -61,7 +123,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)cleanUp;
 - (void)cleanUpIfNeeded;
-- (Reference<ObserverType>* _Nullable)referenceForObserver:(ObserverType)observer;
+- (void)compactEntries;
+- (void)removeEntry:(Entry*)entry;
+- (NSArray<Entry*>*)snapshot;
 
 @end
 
@@ -69,13 +133,33 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: -
 
 @implementation JFObserversController
+{
+	// The registered observers, guarded by `_observersLock`: the entries in the order they have been added, an index of them keyed by address that doesn't retain its values, and the number of entries marked as removed but not yet compacted away.
+	NSMutableArray<Entry*>* _entries;
+	CFMutableDictionaryRef _Nullable _entriesIndex;
+	os_unfair_lock _observersLock;
+	NSUInteger _removedEntriesCount;
+	
+	// The serial pipeline, guarded by `_pipelineLock`.
+	BOOL _deliveryScheduled;
+	NSMutableArray<void(^)(id)>* _Nullable _pendingNotifications;
+	dispatch_queue_t _Nullable _pipelineQueue;
+	os_unfair_lock _pipelineLock;
+}
+
+// =================================================================================================
+// MARK: Properties - Notifications
+// =================================================================================================
+
+@synthesize coalescingPolicy = _coalescingPolicy;
+@synthesize slowObserverHandler = _slowObserverHandler;
 
 // =================================================================================================
 // MARK: Properties - Observers
 // =================================================================================================
 
 @synthesize needsCleanUp = _needsCleanUp;
-@synthesize references = _references;
+@synthesize publishedEntries = _publishedEntries;
 
 // =================================================================================================
 // MARK: Properties (Accessors) - Observers
@@ -83,49 +167,63 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSUInteger)count
 {
-	NSArray<Reference<id>*>* references = self.references;
-	@synchronized(references)
+	NSUInteger retVal = 0;
+	for(Entry* entry in [self snapshot])
 	{
-		NSUInteger retVal = 0;
-		for(Reference<id>* reference in references)
-		{
-			if(reference.object)
-				retVal++;
-			else
-				self.needsCleanUp = YES;
-		}
-		return retVal;
+		if(entry.observer)
+			retVal++;
+		else
+			self.needsCleanUp = YES;
 	}
+	return retVal;
+}
+
+- (BOOL)needsCleanUp
+{
+	return __atomic_load_n(&_needsCleanUp, __ATOMIC_RELAXED);
 }
 
 - (void)setNeedsCleanUp:(BOOL)needsCleanUp
 {
-	if(needsCleanUp)
+	if(!needsCleanUp)
 	{
-		if(_needsCleanUp)
-			return;
-		
-		_needsCleanUp = needsCleanUp;
-		
-		JFWeakifySelf;
-		dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0), ^{
-			[weakSelf cleanUpIfNeeded];
-		});
+		__atomic_store_n(&_needsCleanUp, NO, __ATOMIC_RELAXED);
+		return;
 	}
-	else
-		_needsCleanUp = NO;
+	
+	// Only the first request schedules the clean up.
+	if(__atomic_exchange_n(&_needsCleanUp, YES, __ATOMIC_RELAXED))
+		return;
+	
+	JFWeakifySelf;
+	dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0), ^{
+		[weakSelf cleanUpIfNeeded];
+	});
 }
 
 // =================================================================================================
 // MARK: Lifecycle
 // =================================================================================================
 
+- (void)dealloc
+{
+	if(_entriesIndex)
+		CFRelease(_entriesIndex);
+}
+
 - (instancetype)init
 {
 	self = [super init];
 	
+	_coalescingPolicy = JFObserversControllerCoalescingPolicyNone;
+	_deliveryScheduled = NO;
+	_entries = [NSMutableArray<Entry*> new];
+	_entriesIndex = NULL;
 	_needsCleanUp = NO;
-	_references = [NSMutableArray<Reference<id>*> new];
+	_observersLock = OS_UNFAIR_LOCK_INIT;
+	_pipelineLock = OS_UNFAIR_LOCK_INIT;
+	_publishedEntries = @[];
+	_removedEntriesCount = 0;
 	
 	return self;
 }
@@ -134,6 +232,44 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - Notifications
 // =================================================================================================
 
+- (void)deliverPendingNotifications
+{
+	os_unfair_lock_lock(&_pipelineLock);
+	NSArray<void(^)(id)>* batch = _pendingNotifications;
+	_pendingNotifications = nil;
+	_deliveryScheduled = NO;
+	os_unfair_lock_unlock(&_pipelineLock);
+	
+	if(batch.count == 0)
+		return;
+	
+	// Each observer receives the whole batch at once, in the order the notifications have been sent; the notifications sent meanwhile schedule the next batch on the same serial queue.
+	for(Entry* entry in [self snapshot])
+	{
+		id observer = entry.observer;
+		if(!observer)
+		{
+			self.needsCleanUp = YES;
+			continue;
+		}
+		
+		for(void(^notificationBlock)(id) in batch)
+			notificationBlock(observer);
+	}
+}
+
+- (void)notifyEntries:(NSArray<Entry*>*)entries notificationBlock:(void(^)(id observer))notificationBlock
+{
+	for(Entry* entry in entries)
+	{
+		id observer = entry.observer;
+		if(observer)
+			notificationBlock(observer);
+		else
+			self.needsCleanUp = YES;
+	}
+}
+
 - (void)notifyObservers:(void(^)(id observer))notificationBlock;
 {
 	[self notifyObservers:notificationBlock async:YES];
@@ -141,46 +277,32 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)notifyObservers:(void(^)(id observer))notificationBlock async:(BOOL)async;
 {
-	NSArray<Reference<id>*>* references = self.references;
-	@synchronized(references)
-	{
-		references = [references copy];
-	}
-	
-	JFBlock block = ^(void)
-	{
-		for(Reference<id>* reference in references)
-		{
-			id observer = reference.object;
-			if(observer)
-				notificationBlock(observer);
-			else
-				self.needsCleanUp = YES;
-		}
-	};
-	
+	// The published array is immutable: it can be iterated directly.
+	NSArray<Entry*>* snapshot = [self snapshot];
 	if(!async)
 	{
-		block();
+		[self notifyEntries:snapshot notificationBlock:notificationBlock];
 		return;
 	}
 	
-	dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), block);
+	dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+		[self notifyEntries:snapshot notificationBlock:notificationBlock];
+	});
+}
+
+- (void)notifyObservers:(void(^)(id observer))notificationBlock maxConcurrentObservers:(NSUInteger)maxConcurrentObservers timeout:(NSTimeInterval)timeout completion:(void(^ _Nullable)(void))completion
+{
+	FanOut* fanOut = [[FanOut alloc] initWithController:self snapshot:[self snapshot] notificationBlock:notificationBlock timeout:timeout completion:completion];
+	[fanOut startWithMaxConcurrentObservers:maxConcurrentObservers];
 }
 
 - (void)notifyObservers:(void(^)(id observer))notificationBlock queue:(NSOperationQueue*)queue waitUntilFinished:(BOOL)waitUntilFinished;
 {
-	NSArray<Reference<id>*>* references = self.references;
-	@synchronized(references)
-	{
-		references = [references copy];
-	}
-	
 	NSBlockOperation* operation = [NSBlockOperation new];
-	for(Reference<id>* reference in references)
+	for(Entry* entry in [self snapshot])
 	{
 		[operation addExecutionBlock:^{
-			id observer = reference.object;
+			id observer = entry.observer;
 			if(observer)
 				notificationBlock(observer);
 			else
@@ -191,85 +313,338 @@ NS_ASSUME_NONNULL_BEGIN
 	[queue addOperations:@[operation] waitUntilFinished:waitUntilFinished];
 }
 
+- (void)notifyObserversSerially:(void(^)(id observer))notificationBlock
+{
+	JFObserversControllerCoalescingPolicy coalescingPolicy = self.coalescingPolicy;
+	
+	os_unfair_lock_lock(&_pipelineLock);
+	
+	if(!_pendingNotifications)
+		_pendingNotifications = [NSMutableArray<void(^)(id)> new];
+	else if(coalescingPolicy == JFObserversControllerCoalescingPolicyLatestOnly)
+		[_pendingNotifications removeAllObjects];
+	[_pendingNotifications addObject:[notificationBlock copy]];
+	
+	// A single delivery is scheduled for all the notifications sent before it starts.
+	BOOL shouldSchedule = !_deliveryScheduled;
+	_deliveryScheduled = YES;
+	
+	if(!_pipelineQueue)
+		_pipelineQueue = dispatch_queue_create("com.jackfelle.observersController.pipeline", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_DEFAULT, 0));
+	dispatch_queue_t queue = _pipelineQueue;
+	
+	os_unfair_lock_unlock(&_pipelineLock);
+	
+	if(shouldSchedule)
+	{
+		dispatch_async(queue, ^{
+			[self deliverPendingNotifications];
+		});
+	}
+}
+
 // =================================================================================================
 // MARK: Methods - Observers
 // =================================================================================================
 
 - (void)addObserver:(id)observer
 {
-	NSMutableArray<Reference<id>*>* references = self.references;
-	@synchronized(references)
+	const void* key = (__bridge const void*)observer;
+	
+	os_unfair_lock_lock(&_observersLock);
+	
+	if(!_entriesIndex)
+		_entriesIndex = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+	
+	Entry* oldEntry = (__bridge Entry*)CFDictionaryGetValue(_entriesIndex, key);
+	if(oldEntry)
 	{
-		Reference<id>* oldReference = [self referenceForObserver:observer];
-		if(!oldReference)
-			[references addObject:[Reference<id> referenceWithObject:observer]];
+		if(oldEntry.observer)
+		{
+			os_unfair_lock_unlock(&_observersLock);
+			return;
+		}
+		
+		// The entry belongs to a deallocated observer whose address has been reused.
+		[self removeEntry:oldEntry];
 	}
+	
+	Entry* entry = [[Entry alloc] initWithObserver:observer];
+	[_entries addObject:entry];
+	CFDictionarySetValue(_entriesIndex, key, (__bridge const void*)entry);
+	self.publishedEntries = nil;
+	
+	os_unfair_lock_unlock(&_observersLock);
 }
 
 - (void)cleanUp
 {
-	NSMutableArray<Reference<id>*>* references = self.references;
-	@synchronized(references)
+	os_unfair_lock_lock(&_observersLock);
+	
+	NSMutableArray<Entry*>* entries = _entries;
+	NSIndexSet* obsolete = [entries indexesOfObjectsPassingTest:^BOOL(Entry* entry, NSUInteger index, BOOL* stop) {
+		return (entry.isRemoved || !entry.observer);
+	}];
+	
+	if(obsolete.count > 0)
 	{
-		NSMutableArray<Reference<id>*>* obsolete = [NSMutableArray<Reference<id>*> arrayWithCapacity:references.count];
-		for(Reference<id>* reference in references)
-		{
-			if(!reference.object)
-				[obsolete addObject:reference];
-		}
-		[references removeObjectsInArray:obsolete];
+		CFMutableDictionaryRef entriesIndex = _entriesIndex;
+		[obsolete enumerateIndexesUsingBlock:^(NSUInteger index, BOOL* stop) {
+			Entry* entry = entries[index];
+			const void* key = (const void*)entry.address;
+			if(CFDictionaryGetValue(entriesIndex, key) == (__bridge const void*)entry)
+				CFDictionaryRemoveValue(entriesIndex, key);
+		}];
+		
+		[entries removeObjectsAtIndexes:obsolete];
+		_removedEntriesCount = 0;
+		self.publishedEntries = nil;
 	}
+	
+	os_unfair_lock_unlock(&_observersLock);
 }
 
 - (void)cleanUpIfNeeded
 {
-	if([self needsCleanUp])
+	if(!__atomic_exchange_n(&_needsCleanUp, NO, __ATOMIC_RELAXED))
+		return;
+	
+	[self cleanUp];
+}
+
+- (void)compactEntries
+{
+	// Must be called while holding `_observersLock`.
+	NSIndexSet* removed = [_entries indexesOfObjectsPassingTest:^BOOL(Entry* entry, NSUInteger index, BOOL* stop) {
+		return entry.isRemoved;
+	}];
+	[_entries removeObjectsAtIndexes:removed];
+	_removedEntriesCount = 0;
+}
+
+- (void)removeEntry:(Entry*)entry
+{
+	// Must be called while holding `_observersLock`. Removing the entry from the middle of the array would take linear time, so it's only marked as removed: the array is compacted the next time the published array is copied, or as soon as the removed entries outnumber the others, which keeps the cost of each removal constant on average.
+	entry.removed = YES;
+	_removedEntriesCount++;
+	if(_removedEntriesCount * 2 > _entries.count)
+		[self compactEntries];
+	self.publishedEntries = nil;
+}
+
+- (void)removeObserver:(id)observer
+{
+	const void* key = (__bridge const void*)observer;
+	
+	os_unfair_lock_lock(&_observersLock);
+	
+	// The entry is removed even if its weak reference has already been cleared, which is the case when an observer removes itself while being deallocated: no other live object can have the same address.
+	Entry* entry = (_entriesIndex ? (__bridge Entry*)CFDictionaryGetValue(_entriesIndex, key) : nil);
+	if(entry)
 	{
-		[self cleanUp];
-		self.needsCleanUp = NO;
+		CFDictionaryRemoveValue(_entriesIndex, key);
+		[self removeEntry:entry];
 	}
+	
+	os_unfair_lock_unlock(&_observersLock);
 }
 
-- (Reference<id>* _Nullable)referenceForObserver:(id)observer
+- (NSArray<Entry*>*)snapshot
 {
-	NSArray<Reference<id>*>* references = self.references;
-	@synchronized(references)
+	// The changes only invalidate the published array: it's copied again the first time it's needed, so that a burst of changes costs a single copy and the notifications in between take no lock.
+	NSArray<Entry*>* retObj = self.publishedEntries;
+	if(retObj)
+		return retObj;
+	
+	os_unfair_lock_lock(&_observersLock);
+	retObj = self.publishedEntries;
+	if(!retObj)
 	{
-		BOOL needsCleanUp = NO;
-		Reference<id>* retObj = nil;
+		if(_removedEntriesCount > 0)
+			[self compactEntries];
+		retObj = [_entries copy];
+		self.publishedEntries = retObj;
+	}
+	os_unfair_lock_unlock(&_observersLock);
+	
+	return retObj;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFObserversControllerEntry
+
+// =================================================================================================
+// MARK: Properties - Observers
+// =================================================================================================
+
+@synthesize address = _address;
+@synthesize observer = _observer;
+@synthesize removed = _removed;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithObserver:(id)observer
+{
+	self = [super init];
+	
+	_address = (uintptr_t)(__bridge void*)observer;
+	_observer = observer;
+	_removed = NO;
+	
+	return self;
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFObserversControllerFanOut
+{
+	JFBlock _Nullable _completion;
+	JFObserversController* _controller;
+	NSUInteger _count;
+	os_unfair_lock _lock;
+	NSUInteger _nextIndex;
+	void (^_notificationBlock)(id);
+	NSUInteger _releasedCount;
+	void (^_Nullable _slowObserverHandler)(id, NSTimeInterval, BOOL);
+	NSArray<Entry*>* _snapshot;
+	NSTimeInterval _timeout;
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithController:(JFObserversController*)controller snapshot:(NSArray<Entry*>*)snapshot notificationBlock:(void(^)(id observer))notificationBlock timeout:(NSTimeInterval)timeout completion:(JFBlock _Nullable)completion
+{
+	self = [super init];
+	
+	_completion = [completion copy];
+	_controller = controller;
+	_count = snapshot.count;
+	_lock = OS_UNFAIR_LOCK_INIT;
+	_nextIndex = 0;
+	_notificationBlock = [notificationBlock copy];
+	_releasedCount = 0;
+	_slowObserverHandler = controller.slowObserverHandler;
+	_snapshot = snapshot;
+	_timeout = timeout;
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Notifications
+// =================================================================================================
+
+- (void)complete
+{
+	JFBlock completion = _completion;
+	if(completion)
+		completion();
+}
+
+- (BOOL)finishSlot
+{
+	os_unfair_lock_lock(&_lock);
+	BOOL retVal = (++_releasedCount == _count);
+	os_unfair_lock_unlock(&_lock);
+	return retVal;
+}
+
+- (void)notifyObserver:(id)observer
+{
+	dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0);
+	dispatch_async(queue, ^{
+		// Whoever comes first between the observer and its timer releases the slot; the other one only reports.
+		BOOL __block released = NO;
+		NSTimeInterval timeout = self->_timeout;
+		void (^slowObserverHandler)(id, NSTimeInterval, BOOL) = self->_slowObserverHandler;
 		
-		for(Reference<id>* reference in references)
+		if(timeout > 0)
 		{
-			id temp = reference.object;
-			if(!temp)
-			{
-				needsCleanUp = YES;
-				continue;
-			}
-			
-			if(temp == observer)
-			{
-				retObj = reference;
-				break;
-			}
+			JFWeakify(observer, Observer);
+			dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeout * NSEC_PER_SEC)), queue, ^{
+				if(__atomic_exchange_n(&released, YES, __ATOMIC_ACQ_REL))
+					return;
+				
+				id strongObserver = weakObserver;
+				if(strongObserver && slowObserverHandler)
+					slowObserverHandler(strongObserver, timeout, NO);
+				[self releaseSlot];
+			});
 		}
 		
-		if(needsCleanUp)
-			self.needsCleanUp = YES;
+		CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+		self->_notificationBlock(observer);
+		NSTimeInterval duration = CFAbsoluteTimeGetCurrent() - start;
 		
-		return retObj;
+		if(!__atomic_exchange_n(&released, YES, __ATOMIC_ACQ_REL))
+			[self releaseSlot];
+		else if(slowObserverHandler)
+			slowObserverHandler(observer, duration, YES);
+	});
+}
+
+- (void)releaseSlot
+{
+	if([self finishSlot])
+		[self complete];
+	else
+		[self startNextObserver];
+}
+
+- (void)startNextObserver
+{
+	NSArray<Entry*>* snapshot = _snapshot;
+	while(YES)
+	{
+		os_unfair_lock_lock(&_lock);
+		Entry* entry = ((_nextIndex < snapshot.count) ? snapshot[_nextIndex++] : nil);
+		os_unfair_lock_unlock(&_lock);
+		
+		if(!entry)
+			return;
+		
+		id observer = entry.observer;
+		if(observer)
+		{
+			[self notifyObserver:observer];
+			return;
+		}
+		
+		// The deallocated observers are skipped on the spot, without going through the queue.
+		_controller.needsCleanUp = YES;
+		if([self finishSlot])
+		{
+			[self complete];
+			return;
+		}
 	}
 }
 
-- (void)removeObserver:(id)observer
+- (void)startWithMaxConcurrentObservers:(NSUInteger)maxConcurrentObservers
 {
-	NSMutableArray<Reference<id>*>* references = self.references;
-	@synchronized(references)
+	NSUInteger count = _count;
+	if(count == 0)
 	{
-		Reference<id>* oldReference = [self referenceForObserver:observer];
-		if(oldReference)
-			[references removeObject:oldReference];
+		JFBlock completion = _completion;
+		if(completion)
+			dispatch_async(dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), completion);
+		return;
 	}
+	
+	NSUInteger initialCount = ((maxConcurrentObservers == 0) ? count : MIN(maxConcurrentObservers, count));
+	for(NSUInteger i = 0; i < initialCount; i++)
+		[self startNextObserver];
 }
 
 @end
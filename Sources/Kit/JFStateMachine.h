@@ -30,6 +30,7 @@
 #import <JFKit/JFPreprocessorMacros.h>
 
 @class JFStateMachineTransition;
+@class JFStateMachineTransitionTable;
 
 @protocol JFStateMachineDelegate;
 
@@ -75,6 +76,48 @@ typedef NSInteger JFState;
  */
 typedef NSInteger JFStateTransition;
 
+/**
+ * A list of the mechanisms that a state machine can use to perform its transitions one at a time.
+ */
+typedef NS_ENUM(NSInteger, JFStateMachineBackend) {
+	
+	/**
+	 * Each transition is wrapped in an operation and enqueued on a private serial operation queue.
+	 */
+	JFStateMachineBackendOperationQueue,
+	
+	/**
+	 * Each transition is pushed on a lock-free queue that is drained on a shared global dispatch queue; it's much cheaper than an operation queue, especially when many state machines are used at the same time.
+	 */
+	JFStateMachineBackendSerialExecutor,
+};
+
+/**
+ * A rule of a transition table: it allows a transition to begin from a state and tells which state the machine reaches when the transition succeeds or fails.
+ */
+typedef struct {
+	
+	/**
+	 * The state from which the transition can begin.
+	 */
+	JFState beginningState;
+	
+	/**
+	 * The transition described by the rule.
+	 */
+	JFStateTransition transition;
+	
+	/**
+	 * The state of the machine when the transition succeeds.
+	 */
+	JFState endingStateOnSuccess;
+	
+	/**
+	 * The state of the machine when the transition fails.
+	 */
+	JFState endingStateOnFailure;
+} JFStateMachineTransitionRule;
+
 // =================================================================================================
 // MARK: Types - Errors
 // =================================================================================================
@@ -142,6 +185,15 @@ typedef NS_ENUM(NSInteger, JFStateMachineError) {
  */
 @property (class, strong, nonatomic, readonly) NSErrorDomain errorDomain;
 
+// =================================================================================================
+// MARK: Properties - Execution
+// =================================================================================================
+
+/**
+ * The mechanism used by the state machine to perform its transitions.
+ */
+@property (assign, nonatomic, readonly) JFStateMachineBackend backend;
+
 // =================================================================================================
 // MARK: Properties - Observers
 // =================================================================================================
@@ -155,6 +207,12 @@ typedef NS_ENUM(NSInteger, JFStateMachineError) {
 // MARK: Properties - State
 // =================================================================================================
 
+/**
+ * The table that describes the transitions of the machine, or `nil` if they are described only by the methods `beginningStatesForTransition:`, `endingStateForFailedTransition:` and `endingStateForSucceededTransition:`. The default value is `nil`.
+ * @discussion Subclasses should create the table only once and return always the same instance. By default those methods return the values of the table; as long as a subclass doesn't override any of them, the transitions contained by the table are validated and performed without calling them.
+ */
+@property (class, strong, nonatomic, readonly, nullable) JFStateMachineTransitionTable* transitionTable;
+
 /**
  * The current state of the machine.
  */
@@ -180,12 +238,21 @@ typedef NS_ENUM(NSInteger, JFStateMachineError) {
 - (instancetype)init NS_UNAVAILABLE;
 
 /**
- * Initializes the state machine with the given initial state and the delegate that will execute the state transitions.
+ * Initializes the state machine with the given initial state and the delegate that will execute the state transitions; the transitions are performed using an operation queue.
  * @param state The state that the machine will have in the beginning.
  * @param delegate The delegate that will execute the state transitions.
  * @return An initialized instance of the state machine.
  */
-- (instancetype)initWithState:(JFState)state delegate:(id<JFStateMachineDelegate>)delegate NS_DESIGNATED_INITIALIZER;
+- (instancetype)initWithState:(JFState)state delegate:(id<JFStateMachineDelegate>)delegate;
+
+/**
+ * Initializes the state machine with the given initial state, the delegate that will execute the state transitions and the mechanism used to perform them.
+ * @param state The state that the machine will have in the beginning.
+ * @param delegate The delegate that will execute the state transitions.
+ * @param backend The mechanism used to perform the state transitions.
+ * @return An initialized instance of the state machine.
+ */
+- (instancetype)initWithState:(JFState)state delegate:(id<JFStateMachineDelegate>)delegate backend:(JFStateMachineBackend)backend NS_DESIGNATED_INITIALIZER;
 
 // =================================================================================================
 // MARK: Methods - Execution
@@ -436,6 +503,95 @@ typedef NS_ENUM(NSInteger, JFStateMachineError) {
 
 @end
 
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * The class `JFStateMachineTransitionTable` compiles a list of transition rules into a dense matrix indexed by transition and state, so that a state machine can validate and perform a transition without allocating anything. A transition can reach different ending states depending on the state it begins from.
+ */
+@interface JFStateMachineTransitionTable : NSObject
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+/**
+ * NOT AVAILABLE
+ */
++ (instancetype)new NS_UNAVAILABLE;
+
+/**
+ * NOT AVAILABLE
+ */
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Initializes the table with the given rules.
+ * @param rules The rules of the table.
+ * @param count The number of rules.
+ * @return The initialized table.
+ * @warning This method raises an `NSInvalidArgumentException` if a rule uses the values `JFStateNotAvailable`, `JFStateTransitionNone` or `JFStateTransitionNotAvailable`, if two rules with the same beginning state and transition have different ending states, or if the states and transitions are too sparse to fit in a dense matrix.
+ */
+- (instancetype)initWithRules:(const JFStateMachineTransitionRule*)rules count:(NSUInteger)count NS_DESIGNATED_INITIALIZER;
+
+// =================================================================================================
+// MARK: Methods - State
+// =================================================================================================
+
+/**
+ * Returns the list of states from which the given transition can begin.
+ * @param transition The state transition.
+ * @return The list of states from which the given transition can begin, or an empty list if the table does not contain the given transition.
+ */
+- (NSArray<NSNumber*>*)beginningStatesForTransition:(JFStateTransition)transition;
+
+/**
+ * Returns whether the given transition can begin from the given state.
+ * @param transition The state transition.
+ * @param state The beginning state.
+ * @return `YES` if the table contains a rule for the given transition and state, `NO` otherwise.
+ */
+- (BOOL)canPerformTransition:(JFStateTransition)transition fromState:(JFState)state;
+
+/**
+ * Returns whether the table contains at least one rule for the given transition.
+ * @param transition The state transition.
+ * @return `YES` if the table contains the given transition, `NO` otherwise.
+ */
+- (BOOL)containsTransition:(JFStateTransition)transition;
+
+/**
+ * Returns the ending state for the given transition when it fails, whatever the beginning state is.
+ * @param transition The state transition.
+ * @return The ending state for the given transition when it fails, or `JFStateNotAvailable` if the table does not contain the given transition or if the ending state depends on the beginning state.
+ */
+- (JFState)endingStateForFailedTransition:(JFStateTransition)transition;
+
+/**
+ * Returns the ending state for the given transition when it fails after beginning from the given state.
+ * @param transition The state transition.
+ * @param state The beginning state.
+ * @return The ending state for the given transition when it fails, or `JFStateNotAvailable` if the transition can't begin from the given state.
+ */
+- (JFState)endingStateForFailedTransition:(JFStateTransition)transition fromState:(JFState)state;
+
+/**
+ * Returns the ending state for the given transition when it succeeds, whatever the beginning state is.
+ * @param transition The state transition.
+ * @return The ending state for the given transition when it succeeds, or `JFStateNotAvailable` if the table does not contain the given transition or if the ending state depends on the beginning state.
+ */
+- (JFState)endingStateForSucceededTransition:(JFStateTransition)transition;
+
+/**
+ * Returns the ending state for the given transition when it succeeds after beginning from the given state.
+ * @param transition The state transition.
+ * @param state The beginning state.
+ * @return The ending state for the given transition when it succeeds, or `JFStateNotAvailable` if the transition can't begin from the given state.
+ */
+- (JFState)endingStateForSucceededTransition:(JFStateTransition)transition fromState:(JFState)state;
+
+@end
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 NS_ASSUME_NONNULL_END
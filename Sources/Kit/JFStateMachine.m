@@ -26,6 +26,8 @@
 
 #import "JFStateMachine.h"
 
+#import <objc/runtime.h>
+
 #import "JFAsynchronousBlockOperation.h"
 #import "JFCompatibilityMacros.h"
 #import "JFErrorFactory.h"
@@ -37,6 +39,127 @@ NS_ASSUME_NONNULL_BEGIN
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
+// =================================================================================================
+// MARK: Macros
+// =================================================================================================
+
+#define MaximumCellsCount kJFStateMachineTransitionTableMaximumCellsCount
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+// =================================================================================================
+// MARK: Constants
+// =================================================================================================
+
+static NSUInteger const kJFStateMachineTransitionTableMaximumCellsCount = 1 << 16;
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@class JFStateMachineExecutorTask;
+
+// =================================================================================================
+// MARK: Types
+// =================================================================================================
+
+typedef void (^JFStateMachineExecutorBlock)(JFStateMachineExecutorTask* task);
+
+typedef struct {
+	JFState endingStateOnFailure;
+	JFState endingStateOnSuccess; // `JFStateNotAvailable` if the transition can't begin from the state of the cell.
+} JFStateMachineTransitionTableCell;
+
+typedef struct {
+	JFState endingStateOnFailure; // `JFStateNotAvailable` if it depends on the beginning state.
+	JFState endingStateOnSuccess; // `JFStateNotAvailable` if it depends on the beginning state.
+	BOOL registered;
+} JFStateMachineTransitionTableRow;
+
+typedef NS_ENUM(UInt8, JFStateMachineExecutorState)
+{
+	JFStateMachineExecutorStateExecuting,
+	JFStateMachineExecutorStateFinished,
+	JFStateMachineExecutorStateReturned,
+};
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * The unit of work that a state machine executes for each transition, whatever the backend is; the transition is over only when `finish` is called.
+ */
+@protocol JFStateMachineTask <NSObject>
+
+- (void)finish;
+- (void)waitUntilFinished;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFAsynchronousBlockOperation (JFStateMachine) <JFStateMachineTask>
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * A serial executor of asynchronous tasks that does not own any thread: producers push the tasks on lock-free stacks (one per priority) and, when the executor is idle, the first one schedules a drain on a global dispatch queue. The drain takes the stacks all at once and executes the tasks one by one; a task that finishes before its block returns lets the drain go on in place, otherwise the next drain is scheduled by the task itself when it finishes.
+ */
+@interface JFStateMachineExecutor : NSObject
+
+// =================================================================================================
+// MARK: Methods - Execution
+// =================================================================================================
+
+- (void)cancelAllTasks;
+- (BOOL)completeTask:(JFStateMachineExecutorTask*)task;
+- (JFStateMachineExecutorTask*)dequeueTask;
+- (JFStateMachineExecutorTask*)enqueueTaskWithBlock:(JFStateMachineExecutorBlock)block highPriority:(BOOL)highPriority;
+- (void)executeTasks;
+- (void)finishTask:(JFStateMachineExecutorTask*)task;
+- (void)scheduleExecution;
+- (void)waitUntilAllTasksAreFinished;
+- (void)waitUntilTaskIsFinished:(JFStateMachineExecutorTask*)task;
+- (void)waitWhile:(BOOL (^)(void))condition;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+/**
+ * A task enqueued on a `JFStateMachineExecutor`: while it's waiting to be executed, the executor owns it and links it to the next one through the property `next`.
+ */
+@interface JFStateMachineExecutorTask : NSObject <JFStateMachineTask>
+
+// =================================================================================================
+// MARK: Properties - Execution
+// =================================================================================================
+
+@property (copy, nonatomic, readonly) JFStateMachineExecutorBlock block;
+@property (assign, nonatomic, getter=isCancelled) BOOL cancelled;
+@property (strong, nonatomic, readonly) JFStateMachineExecutor* executor;
+@property (assign, getter=isFinished) BOOL finished;
+@property (assign, nonatomic, readonly) NSUInteger generation;
+@property (assign, nonatomic, nullable) void* next;
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithExecutor:(JFStateMachineExecutor*)executor block:(JFStateMachineExecutorBlock)block generation:(NSUInteger)generation NS_DESIGNATED_INITIALIZER;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
 @interface JFStateMachine (/* Private */)
 
 // =================================================================================================
@@ -49,9 +172,10 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Properties - Execution
 // =================================================================================================
 
-@property (strong, nonatomic, nullable) NSOperation* executingOperation;
+@property (strong, nonatomic, nullable) id<JFStateMachineTask> executingTask;
 @property (strong, nonatomic, nullable) JFStateMachineTransition* executingTransition;
-@property (strong, nonatomic, readonly) NSOperationQueue* executionQueue;
+@property (strong, nonatomic, readonly, nullable) NSOperationQueue* executionQueue;
+@property (strong, nonatomic, readonly, nullable) JFStateMachineExecutor* executor;
 
 // =================================================================================================
 // MARK: Properties - Observers
@@ -63,12 +187,17 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Properties - State
 // =================================================================================================
 
+@property (strong, nonatomic, readonly, nullable) JFStateMachineTransitionTable* directTable;
+@property (class, assign, nonatomic, readonly) BOOL overridesTransitionMethods;
 @property (assign, readwrite) JFState state;
+@property (strong, nonatomic, readonly, nullable) JFStateMachineTransitionTable* table;
 
 // =================================================================================================
 // MARK: Methods - Execution
 // =================================================================================================
 
++ (void)cancelTransition:(JFStateMachineTransition*)transition transitionString:(NSString* _Nullable)transitionString underlyingError:(NSError* _Nullable)underlyingError;
+- (void)executeTransition:(JFStateMachineTransition*)transition transitionString:(NSString* _Nullable)transitionString task:(id<JFStateMachineTask>)task;
 - (void)perform:(JFStateMachineTransition*)transition waitUntilFinished:(BOOL)waitUntilFinished queuePriority:(NSOperationQueuePriority)priority;
 
 // =================================================================================================
@@ -82,15 +211,31 @@ NS_ASSUME_NONNULL_BEGIN
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
 
+@interface JFStateMachineTransitionTable (/* Private */)
+
+// =================================================================================================
+// MARK: Methods - State
+// =================================================================================================
+
+- (JFStateMachineTransitionTableCell* _Nullable)cellForTransition:(JFStateTransition)transition state:(JFState)state;
+- (JFStateMachineTransitionTableCell* _Nullable)cellsForTransition:(JFStateTransition)transition;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
 @implementation JFStateMachine
 
 // =================================================================================================
 // MARK: Properties - Execution
 // =================================================================================================
 
-@synthesize executingOperation = _executingOperation;
+@synthesize backend = _backend;
+@synthesize executingTask = _executingTask;
 @synthesize executingTransition = _executingTransition;
 @synthesize executionQueue = _executionQueue;
+@synthesize executor = _executor;
 
 // =================================================================================================
 // MARK: Properties - Observers
@@ -102,7 +247,9 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Properties - State
 // =================================================================================================
 
+@synthesize directTable = _directTable;
 @synthesize state = _state;
+@synthesize table = _table;
 
 // =================================================================================================
 // MARK: Properties (Accessors) - Errors
@@ -127,6 +274,36 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Properties (Accessors) - State
 // =================================================================================================
 
++ (BOOL)overridesTransitionMethods
+{
+	// Each class is checked only once, when its first machine is created.
+	static CFMutableDictionaryRef cache = NULL;
+	const void* key = (__bridge const void*)self;
+	@synchronized(JFStateMachine.class)
+	{
+		if(!cache)
+			cache = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+		
+		const void* value = CFDictionaryGetValue(cache, key);
+		if(value)
+			return (value == kCFBooleanTrue);
+		
+		BOOL retVal = NO;
+		SEL selectors[] = {@selector(beginningStatesForTransition:), @selector(endingStateForFailedTransition:), @selector(endingStateForSucceededTransition:)};
+		for(NSUInteger i = 0; i < sizeof(selectors) / sizeof(selectors[0]); i++)
+		{
+			if(class_getMethodImplementation(self, selectors[i]) != class_getMethodImplementation(JFStateMachine.class, selectors[i]))
+			{
+				retVal = YES;
+				break;
+			}
+		}
+		
+		CFDictionarySetValue(cache, key, (retVal ? kCFBooleanTrue : kCFBooleanFalse));
+		return retVal;
+	}
+}
+
 - (JFState)state
 {
 	@synchronized(self)
@@ -152,6 +329,11 @@ NS_ASSUME_NONNULL_BEGIN
 	}
 }
 
++ (JFStateMachineTransitionTable* _Nullable)transitionTable
+{
+	return nil;
+}
+
 // =================================================================================================
 // MARK: Lifecycle
 // =================================================================================================
@@ -159,15 +341,39 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)dealloc
 {
 	[self.executionQueue cancelAllOperations];
+	[self.executor cancelAllTasks];
 }
 
 - (instancetype)initWithState:(JFState)state delegate:(id<JFStateMachineDelegate>)delegate
+{
+	return [self initWithState:state delegate:delegate backend:JFStateMachineBackendOperationQueue];
+}
+
+- (instancetype)initWithState:(JFState)state delegate:(id<JFStateMachineDelegate>)delegate backend:(JFStateMachineBackend)backend
 {
 	self = [super init];
 	
+	_backend = backend;
 	_delegate = delegate;
-	_executionQueue = JFCreateSerialOperationQueue(ClassName);
 	_state = state;
+	_table = self.class.transitionTable;
+	
+	// The table can be consulted directly only if the subclass relies on it to describe the transitions: the methods that it overrides must be called instead.
+	_directTable = (self.class.overridesTransitionMethods ? nil : _table);
+	
+	switch(backend)
+	{
+		case JFStateMachineBackendSerialExecutor:
+		{
+			_executor = [JFStateMachineExecutor new];
+			break;
+		}
+		default:
+		{
+			_executionQueue = JFCreateSerialOperationQueue(ClassName);
+			break;
+		}
+	}
 	
 	return self;
 }
@@ -176,75 +382,48 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - Execution
 // =================================================================================================
 
-- (void)perform:(JFStateMachineTransition*)transition
-{
-	[self perform:transition waitUntilFinished:NO];
-}
-
-- (void)perform:(JFStateMachineTransition*)transition waitUntilFinished:(BOOL)waitUntilFinished
++ (void)cancelTransition:(JFStateMachineTransition*)transition transitionString:(NSString* _Nullable)transitionString underlyingError:(NSError* _Nullable)underlyingError
 {
-	[self perform:transition waitUntilFinished:waitUntilFinished queuePriority:NSOperationQueuePriorityNormal];
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+	JFFailableClosure* closure = transition.closure;
+	JFSimpleCompletion* completion = transition.completion;
+	if(!closure && !completion)
+		return;
+	
+	NSInteger errorCode = JFStateMachineErrorTransitionCancelled;
+	NSString* errorDescription = [NSString stringWithFormat:@"Transition '%@' cancelled.", transitionString];
+	NSError* error = [self.errorFactory errorWithCode:errorCode description:errorDescription underlyingError:underlyingError];
+	
+	if(closure)
+		[closure executeWithError:error async:YES];
+	else if(completion)
+		[completion executeWithError:error async:YES];
+#pragma GCC diagnostic pop
 }
 
-- (void)perform:(JFStateMachineTransition*)transition waitUntilFinished:(BOOL)waitUntilFinished queuePriority:(NSOperationQueuePriority)priority
+- (void)executeTransition:(JFStateMachineTransition*)transition transitionString:(NSString* _Nullable)transitionString task:(id<JFStateMachineTask>)task
 {
 	JFErrorFactory* errorFactory = self.class.errorFactory;
-	NSString* transitionString = [self stringFromTransition:transition.transition];
 	
-	JFOptionalErrorBlock cancelBlock = ^(NSError* _Nullable underlyingError) {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-		JFFailableClosure* closure = transition.closure;
-		JFSimpleCompletion* completion = transition.completion;
-		if(!closure && !completion)
-			return;
-		
-		NSInteger errorCode = JFStateMachineErrorTransitionCancelled;
-		NSString* errorDescription = [NSString stringWithFormat:@"Transition '%@' cancelled.", transitionString];
-		NSError* error = [errorFactory errorWithCode:errorCode description:errorDescription underlyingError:underlyingError];
-		
-		if(closure)
-			[closure executeWithError:error async:YES];
-		else if(completion)
-			[completion executeWithError:error async:YES];
-#pragma GCC diagnostic pop
-	};
-	
-	NSError* error = nil;
-	if(![self isValidTransition:transition.transition error:&error])
+	id<JFStateMachineDelegate> delegate = self.delegate;
+	if(!delegate)
 	{
-		cancelBlock(error);
+		[JFStateMachine cancelTransition:transition transitionString:transitionString underlyingError:[errorFactory errorWithCode:JFStateMachineErrorMissingDelegate]];
+		[task finish];
 		return;
 	}
 	
-	BOOL __block shouldSkipIsCancelledCheckOnCompletion = NO;
+	JFState state = self.state;
+	JFStateMachineTransitionTable* table = self.directTable;
+	BOOL isTableTransition = [table containsTransition:transition.transition];
 	
-	JFAsynchronousBlockOperation* __block operation = nil;
-	
-	JFWeakifySelf;
-	operation = [[JFAsynchronousBlockOperation alloc] initWithExecutionBlock:^{
-		shouldSkipIsCancelledCheckOnCompletion = YES;
-		
-		JFStrongifySelf;
-		if(!strongSelf)
-		{
-			cancelBlock([errorFactory errorWithCode:JFStateMachineErrorDeallocated]);
-			[operation finish];
-			return;
-		}
-		
-		id<JFStateMachineDelegate> delegate = strongSelf.delegate;
-		if(!delegate)
-		{
-			cancelBlock([errorFactory errorWithCode:JFStateMachineErrorMissingDelegate]);
-			[operation finish];
-			return;
-		}
-		
-		JFState state = strongSelf.state;
-		NSArray<NSNumber*>* beginningStates = [strongSelf beginningStatesForTransition:transition.transition];
-		
-		BOOL isBeginningStateWrong = YES;
+	BOOL isBeginningStateWrong = YES;
+	if(isTableTransition)
+		isBeginningStateWrong = ![table canPerformTransition:transition.transition fromState:state];
+	else
+	{
+		NSArray<NSNumber*>* beginningStates = [self beginningStatesForTransition:transition.transition];
 		for(NSNumber* beginningState in beginningStates)
 		{
 			if(beginningState.unsignedIntegerValue == state)
@@ -253,102 +432,170 @@ NS_ASSUME_NONNULL_BEGIN
 				break;
 			}
 		}
-		
-		if(isBeginningStateWrong)
-		{
-			NSString* errorDescription = [NSString stringWithFormat:@"Transition '%@' not allowed from state '%@'.", transitionString, [strongSelf stringFromState:state]];
-			cancelBlock([errorFactory errorWithCode:JFStateMachineErrorTransitionNotAllowed description:errorDescription]);
-			[operation finish];
-			return;
-		}
-		
-		if([delegate respondsToSelector:@selector(stateMachine:willPerform:context:)])
-			[delegate stateMachine:strongSelf willPerform:transition.transition context:transition.context];
-		
-		@synchronized(strongSelf)
+	}
+	
+	if(isBeginningStateWrong)
+	{
+		NSString* errorDescription = [NSString stringWithFormat:@"Transition '%@' not allowed from state '%@'.", transitionString, [self stringFromState:state]];
+		[JFStateMachine cancelTransition:transition transitionString:transitionString underlyingError:[errorFactory errorWithCode:JFStateMachineErrorTransitionNotAllowed description:errorDescription]];
+		[task finish];
+		return;
+	}
+	
+	if([delegate respondsToSelector:@selector(stateMachine:willPerform:context:)])
+		[delegate stateMachine:self willPerform:transition.transition context:transition.context];
+	
+	@synchronized(self)
+	{
+		self.executingTask = task;
+		self.executingTransition = transition;
+	}
+	
+	JFWeakifySelf;
+	JFFailableClosure* closure = [JFFailableClosure newWithBlock:^(BOOL succeeded, NSError* _Nullable error) {
+		JFStrongifySelf;
+		if(strongSelf)
 		{
-			strongSelf.executingOperation = operation;
-			strongSelf.executingTransition = transition;
-		}
-		
-		JFFailableClosure* closure = [JFFailableClosure newWithBlock:^(BOOL succeeded, NSError* _Nullable error) {
-			JFStrongifySelf;
-			if(strongSelf)
+			JFState endingState;
+			if(isTableTransition)
+				endingState = (succeeded ? [table endingStateForSucceededTransition:transition.transition fromState:state] : [table endingStateForFailedTransition:transition.transition fromState:state]);
+			else
+				endingState = (succeeded ? [strongSelf endingStateForSucceededTransition:transition.transition] : [strongSelf endingStateForFailedTransition:transition.transition]);
+			
+			@synchronized(strongSelf)
 			{
-				JFState endingState = (succeeded ? [strongSelf endingStateForSucceededTransition:transition.transition] : [strongSelf endingStateForFailedTransition:transition.transition]);
-				
-				@synchronized(strongSelf)
-				{
-					strongSelf.executingOperation = nil;
-					strongSelf.executingTransition = nil;
-					strongSelf.state = endingState;
-				}
-				
-				id<JFStateMachineDelegate> delegate = strongSelf.delegate;
-				if(delegate && [delegate respondsToSelector:@selector(stateMachine:didPerform:context:)])
-					[delegate stateMachine:strongSelf didPerform:transition.transition context:transition.context];
+				strongSelf.executingTask = nil;
+				strongSelf.executingTransition = nil;
+				strongSelf.state = endingState;
 			}
 			
+			id<JFStateMachineDelegate> delegate = strongSelf.delegate;
+			if(delegate && [delegate respondsToSelector:@selector(stateMachine:didPerform:context:)])
+				[delegate stateMachine:strongSelf didPerform:transition.transition context:transition.context];
+		}
+		
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-			JFFailableClosure* closure = transition.closure;
-			JFSimpleCompletion* completion = transition.completion;
-			if(closure || completion)
+		JFFailableClosure* closure = transition.closure;
+		JFSimpleCompletion* completion = transition.completion;
+		if(closure || completion)
+		{
+			if(closure)
 			{
-				if(closure)
-				{
-					if(succeeded)
-						[closure executeAsync:YES];
-					else
-						[closure executeWithError:error async:YES];
-				}
-				else if(completion)
-				{
-					if(succeeded)
-						[completion executeAsync:YES];
-					else
-						[completion executeWithError:error async:YES];
-				}
+				if(succeeded)
+					[closure executeAsync:YES];
+				else
+					[closure executeWithError:error async:YES];
 			}
-#pragma GCC diagnostic pop
-
-			if(strongSelf)
+			else if(completion)
 			{
-				JFStateMachineTransition* nextTransition = (succeeded ? transition.nextTransitionOnSuccess : transition.nextTransitionOnFailure);
-				if(nextTransition)
-					[strongSelf perform:nextTransition waitUntilFinished:NO queuePriority:NSOperationQueuePriorityHigh];
+				if(succeeded)
+					[completion executeAsync:YES];
+				else
+					[completion executeWithError:error async:YES];
 			}
-			
-			[operation finish];
-		}];
-		
-		if(!delegate)
+		}
+#pragma GCC diagnostic pop
+
+		if(strongSelf)
 		{
-			[closure execute];
-			return;
+			JFStateMachineTransition* nextTransition = (succeeded ? transition.nextTransitionOnSuccess : transition.nextTransitionOnFailure);
+			if(nextTransition)
+				[strongSelf perform:nextTransition waitUntilFinished:NO queuePriority:NSOperationQueuePriorityHigh];
 		}
 		
-		if([delegate respondsToSelector:@selector(stateMachine:perform:context:closure:)])
-			[delegate stateMachine:strongSelf perform:transition.transition context:transition.context closure:closure];
-		else if([delegate respondsToSelector:@selector(stateMachine:perform:context:completion:)])
-		{
+		[task finish];
+	}];
+	
+	if([delegate respondsToSelector:@selector(stateMachine:perform:context:closure:)])
+		[delegate stateMachine:self perform:transition.transition context:transition.context closure:closure];
+	else if([delegate respondsToSelector:@selector(stateMachine:perform:context:completion:)])
+	{
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-			[delegate stateMachine:strongSelf perform:transition.transition context:transition.context completion:[JFSimpleCompletion completionWithSuccessBlock:^{
-				[closure execute];
-			} failureBlock:^(NSError* error) {
-				[closure executeWithError:error];
-			}]];
+		[delegate stateMachine:self perform:transition.transition context:transition.context completion:[JFSimpleCompletion completionWithSuccessBlock:^{
+			[closure execute];
+		} failureBlock:^(NSError* error) {
+			[closure executeWithError:error];
+		}]];
 #pragma GCC diagnostic pop
+	}
+	else
+		[closure execute];
+}
+
+- (void)perform:(JFStateMachineTransition*)transition
+{
+	[self perform:transition waitUntilFinished:NO];
+}
+
+- (void)perform:(JFStateMachineTransition*)transition waitUntilFinished:(BOOL)waitUntilFinished
+{
+	[self perform:transition waitUntilFinished:waitUntilFinished queuePriority:NSOperationQueuePriorityNormal];
+}
+
+- (void)perform:(JFStateMachineTransition*)transition waitUntilFinished:(BOOL)waitUntilFinished queuePriority:(NSOperationQueuePriority)priority
+{
+	JFErrorFactory* errorFactory = self.class.errorFactory;
+	NSString* transitionString = [self stringFromTransition:transition.transition];
+	
+	NSError* error = nil;
+	if(![self isValidTransition:transition.transition error:&error])
+	{
+		[JFStateMachine cancelTransition:transition transitionString:transitionString underlyingError:error];
+		return;
+	}
+	
+	JFWeakifySelf;
+	
+	JFStateMachineExecutor* executor = self.executor;
+	if(executor)
+	{
+		JFStateMachineExecutorTask* task = [executor enqueueTaskWithBlock:^(JFStateMachineExecutorTask* task) {
+			if(task.isCancelled)
+			{
+				[JFStateMachine cancelTransition:transition transitionString:transitionString underlyingError:nil];
+				[task finish];
+				return;
+			}
+			
+			JFStrongifySelf;
+			if(!strongSelf)
+			{
+				[JFStateMachine cancelTransition:transition transitionString:transitionString underlyingError:[errorFactory errorWithCode:JFStateMachineErrorDeallocated]];
+				[task finish];
+				return;
+			}
+			
+			[strongSelf executeTransition:transition transitionString:transitionString task:task];
+		} highPriority:(priority > NSOperationQueuePriorityNormal)];
+		
+		if(waitUntilFinished)
+			[task waitUntilFinished];
+		return;
+	}
+	
+	BOOL __block shouldSkipIsCancelledCheckOnCompletion = NO;
+	
+	JFAsynchronousBlockOperation* __block operation = nil;
+	
+	operation = [[JFAsynchronousBlockOperation alloc] initWithExecutionBlock:^{
+		shouldSkipIsCancelledCheckOnCompletion = YES;
+		
+		JFStrongifySelf;
+		if(!strongSelf)
+		{
+			[JFStateMachine cancelTransition:transition transitionString:transitionString underlyingError:[errorFactory errorWithCode:JFStateMachineErrorDeallocated]];
+			[operation finish];
 			return;
 		}
-		else
-			[closure execute];
+		
+		[strongSelf executeTransition:transition transitionString:transitionString task:operation];
 	}];
 	
 	operation.completionBlock = ^{
 		if(!shouldSkipIsCancelledCheckOnCompletion && [operation isCancelled])
-			cancelBlock(nil);
+			[JFStateMachine cancelTransition:transition transitionString:transitionString underlyingError:nil];
 		operation = nil;
 	};
 	
@@ -372,16 +619,17 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)waitUntilAllTransitionsAreFinished
 {
 	[self.executionQueue waitUntilAllOperationsAreFinished];
+	[self.executor waitUntilAllTasksAreFinished];
 }
 
 - (void)waitUntilCurrentTransitionIsFinished
 {
-	NSOperation* operation;
+	id<JFStateMachineTask> task;
 	@synchronized(self)
 	{
-		operation = self.executingOperation;
+		task = self.executingTask;
 	}
-	[operation waitUntilFinished];
+	[task waitUntilFinished];
 }
 
 // =================================================================================================
@@ -415,6 +663,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)clearDelegate
 {
 	[self.executionQueue cancelAllOperations];
+	[self.executor cancelAllTasks];
 	self.delegate = nil;
 }
 
@@ -424,17 +673,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSArray<NSNumber*>*)beginningStatesForTransition:(JFStateTransition)transition
 {
-	return @[];
+	JFStateMachineTransitionTable* table = self.table;
+	return (table ? [table beginningStatesForTransition:transition] : @[]);
 }
 
 - (JFState)endingStateForFailedTransition:(JFStateTransition)transition
 {
-	return JFStateNotAvailable;
+	JFStateMachineTransitionTable* table = self.table;
+	return (table ? [table endingStateForFailedTransition:transition] : JFStateNotAvailable);
 }
 
 - (JFState)endingStateForSucceededTransition:(JFStateTransition)transition
 {
-	return JFStateNotAvailable;
+	JFStateMachineTransitionTable* table = self.table;
+	return (table ? [table endingStateForSucceededTransition:transition] : JFStateNotAvailable);
 }
 
 - (BOOL)isValidTransition:(JFStateTransition)transition error:(NSError* __autoreleasing _Nullable *)outError
@@ -448,6 +700,10 @@ NS_ASSUME_NONNULL_BEGIN
 	if((transition == JFStateTransitionNone) || (transition == JFStateTransitionNotAvailable))
 		return errorBlock(JFStateMachineErrorTransitionNotValid);
 	
+	// The rules of the table have already been validated when the table was created.
+	if([self.directTable containsTransition:transition])
+		return YES;
+	
 	if([self beginningStatesForTransition:transition].count == 0)
 		return errorBlock(JFStateMachineErrorBeginningStateNotValid);
 	
@@ -475,6 +731,280 @@ NS_ASSUME_NONNULL_BEGIN
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 // MARK: -
 
+@implementation JFAsynchronousBlockOperation (JFStateMachine)
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+// =================================================================================================
+// MARK: Functions - Execution
+// =================================================================================================
+
+static void JFStateMachineExecutorExecuteTasks(void* context)
+{
+	JFStateMachineExecutor* executor = (__bridge_transfer JFStateMachineExecutor*)context;
+	[executor executeTasks];
+}
+
+static void* _Nullable JFStateMachineExecutorPopTask(void* _Nullable * _Nonnull pending, void* _Nullable * _Nonnull head)
+{
+	void* retVal = *pending;
+	if(!retVal)
+	{
+		// The producers push on a stack: it's taken all at once and reversed to restore the enqueuing order.
+		void* node = __atomic_exchange_n(head, NULL, __ATOMIC_ACQUIRE);
+		while(node)
+		{
+			JFStateMachineExecutorTask* task = (__bridge JFStateMachineExecutorTask*)node;
+			void* next = task.next;
+			task.next = retVal;
+			retVal = node;
+			node = next;
+		}
+	}
+	
+	if(retVal)
+		*pending = ((__bridge JFStateMachineExecutorTask*)retVal).next;
+	
+	return retVal;
+}
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFStateMachineExecutor
+{
+	NSUInteger _generation;
+	void* _Nullable _highPriorityHead;
+	void* _Nullable _highPriorityPending;
+	void* _Nullable _normalPriorityHead;
+	void* _Nullable _normalPriorityPending;
+	JFStateMachineExecutorState _state;
+	NSUInteger _tasksCount;
+	NSCondition* _waitCondition;
+	NSUInteger _waitersCount;
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)init
+{
+	self = [super init];
+	
+	_generation = 0;
+	_highPriorityHead = NULL;
+	_highPriorityPending = NULL;
+	_normalPriorityHead = NULL;
+	_normalPriorityPending = NULL;
+	_state = JFStateMachineExecutorStateReturned;
+	_tasksCount = 0;
+	_waitCondition = [NSCondition new];
+	_waitersCount = 0;
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - Execution
+// =================================================================================================
+
+- (void)cancelAllTasks
+{
+	// The tasks enqueued so far belong to an old generation: they are still dequeued in order, but marked as cancelled.
+	__atomic_add_fetch(&_generation, 1, __ATOMIC_ACQ_REL);
+}
+
+- (BOOL)completeTask:(JFStateMachineExecutorTask*)task
+{
+	task.finished = YES;
+	NSUInteger remaining = __atomic_sub_fetch(&_tasksCount, 1, __ATOMIC_SEQ_CST);
+	
+	if(__atomic_load_n(&_waitersCount, __ATOMIC_SEQ_CST) > 0)
+	{
+		NSCondition* condition = _waitCondition;
+		[condition lock];
+		[condition broadcast];
+		[condition unlock];
+	}
+	
+	return (remaining > 0);
+}
+
+- (JFStateMachineExecutorTask*)dequeueTask
+{
+	void* node = JFStateMachineExecutorPopTask(&_highPriorityPending, &_highPriorityHead);
+	if(!node)
+		node = JFStateMachineExecutorPopTask(&_normalPriorityPending, &_normalPriorityHead);
+	
+	// A positive count of tasks guarantees that at least one of them has already been pushed.
+	return (__bridge_transfer JFStateMachineExecutorTask*)node;
+}
+
+- (JFStateMachineExecutorTask*)enqueueTaskWithBlock:(JFStateMachineExecutorBlock)block highPriority:(BOOL)highPriority
+{
+	JFStateMachineExecutorTask* retObj = [[JFStateMachineExecutorTask alloc] initWithExecutor:self block:block generation:__atomic_load_n(&_generation, __ATOMIC_ACQUIRE)];
+	
+	void* node = (__bridge_retained void*)retObj;
+	void* _Nullable * head = (highPriority ? &_highPriorityHead : &_normalPriorityHead);
+	void* next = __atomic_load_n(head, __ATOMIC_RELAXED);
+	do
+	{
+		retObj.next = next;
+	}
+	while(!__atomic_compare_exchange_n(head, &next, node, YES, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+	
+	// Only the task that finds the executor idle schedules the execution; the others are picked up by the running one.
+	if(__atomic_fetch_add(&_tasksCount, 1, __ATOMIC_SEQ_CST) == 0)
+		[self scheduleExecution];
+	
+	return retObj;
+}
+
+- (void)executeTasks
+{
+	while(YES)
+	{
+		JFStateMachineExecutorTask* task = [self dequeueTask];
+		task.cancelled = (task.generation != __atomic_load_n(&_generation, __ATOMIC_ACQUIRE));
+		
+		__atomic_store_n(&_state, JFStateMachineExecutorStateExecuting, __ATOMIC_RELEASE);
+		task.block(task);
+		
+		// If the task is still running, the execution resumes when it finishes.
+		if(__atomic_exchange_n(&_state, JFStateMachineExecutorStateReturned, __ATOMIC_ACQ_REL) != JFStateMachineExecutorStateFinished)
+			return;
+		
+		if(![self completeTask:task])
+			return;
+	}
+}
+
+- (void)finishTask:(JFStateMachineExecutorTask*)task
+{
+	// If the block of the task has not returned yet, the task is completed by `executeTasks`.
+	if(__atomic_exchange_n(&_state, JFStateMachineExecutorStateFinished, __ATOMIC_ACQ_REL) != JFStateMachineExecutorStateReturned)
+		return;
+	
+	if([self completeTask:task])
+		[self scheduleExecution];
+}
+
+- (void)scheduleExecution
+{
+	dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0);
+	dispatch_async_f(queue, (__bridge_retained void*)self, JFStateMachineExecutorExecuteTasks);
+}
+
+- (void)waitUntilAllTasksAreFinished
+{
+	if(__atomic_load_n(&_tasksCount, __ATOMIC_SEQ_CST) == 0)
+		return;
+	
+	[self waitWhile:^BOOL{
+		return (__atomic_load_n(&self->_tasksCount, __ATOMIC_SEQ_CST) > 0);
+	}];
+}
+
+- (void)waitUntilTaskIsFinished:(JFStateMachineExecutorTask*)task
+{
+	if(task.isFinished)
+		return;
+	
+	[self waitWhile:^BOOL{
+		return !task.isFinished;
+	}];
+}
+
+- (void)waitWhile:(BOOL (^)(void))condition
+{
+	NSCondition* waitCondition = _waitCondition;
+	[waitCondition lock];
+	__atomic_add_fetch(&_waitersCount, 1, __ATOMIC_SEQ_CST);
+	while(condition())
+		[waitCondition wait];
+	__atomic_sub_fetch(&_waitersCount, 1, __ATOMIC_SEQ_CST);
+	[waitCondition unlock];
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFStateMachineExecutorTask
+{
+	BOOL _finished;
+	BOOL _finishing;
+}
+
+// =================================================================================================
+// MARK: Properties - Execution
+// =================================================================================================
+
+@synthesize block = _block;
+@synthesize cancelled = _cancelled;
+@synthesize executor = _executor;
+@synthesize generation = _generation;
+@synthesize next = _next;
+
+// =================================================================================================
+// MARK: Properties (Accessors) - Execution
+// =================================================================================================
+
+- (BOOL)isFinished
+{
+	return __atomic_load_n(&_finished, __ATOMIC_SEQ_CST);
+}
+
+- (void)setFinished:(BOOL)finished
+{
+	__atomic_store_n(&_finished, finished, __ATOMIC_SEQ_CST);
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (instancetype)initWithExecutor:(JFStateMachineExecutor*)executor block:(JFStateMachineExecutorBlock)block generation:(NSUInteger)generation
+{
+	self = [super init];
+	
+	_block = [block copy];
+	_cancelled = NO;
+	_executor = executor;
+	_finished = NO;
+	_finishing = NO;
+	_generation = generation;
+	_next = NULL;
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods (JFStateMachineTask) - Execution
+// =================================================================================================
+
+- (void)finish
+{
+	// Like `JFAsynchronousOperation`, finishing a task twice does nothing.
+	if(!__atomic_exchange_n(&_finishing, YES, __ATOMIC_ACQ_REL))
+		[self.executor finishTask:self];
+}
+
+- (void)waitUntilFinished
+{
+	[self.executor waitUntilTaskIsFinished:self];
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
 @implementation JFStateMachineTransition
 
 // =================================================================================================
@@ -517,6 +1047,194 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFStateMachineTransitionTable
+{
+	JFStateMachineTransitionTableCell* _Nullable _cells;
+	JFState _minimumState;
+	JFStateTransition _minimumTransition;
+	JFStateMachineTransitionTableRow* _Nullable _rows;
+	NSUInteger _statesCount;
+	NSUInteger _transitionsCount;
+}
+
+// =================================================================================================
+// MARK: Lifecycle
+// =================================================================================================
+
+- (void)dealloc
+{
+	free(_cells);
+	free(_rows);
+}
+
+- (instancetype)initWithRules:(const JFStateMachineTransitionRule*)rules count:(NSUInteger)count
+{
+	self = [super init];
+	
+	JFState minimumState = (count > 0) ? rules[0].beginningState : 0;
+	JFState maximumState = minimumState;
+	JFStateTransition minimumTransition = (count > 0) ? rules[0].transition : 0;
+	JFStateTransition maximumTransition = minimumTransition;
+	
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		JFStateMachineTransitionRule rule = rules[i];
+		if((rule.transition == JFStateTransitionNone) || (rule.transition == JFStateTransitionNotAvailable) || (rule.beginningState == JFStateNotAvailable) || (rule.endingStateOnFailure == JFStateNotAvailable) || (rule.endingStateOnSuccess == JFStateNotAvailable))
+			@throw [NSException exceptionWithName:NSInvalidArgumentException reason:[NSString stringWithFormat:@"%@<%@>: Rule not valid. [index = '%@']", ClassName, JFStringFromPointer(self), JFStringFromNSUInteger(i)] userInfo:nil];
+		
+		minimumState = MIN(minimumState, rule.beginningState);
+		maximumState = MAX(maximumState, rule.beginningState);
+		minimumTransition = MIN(minimumTransition, rule.transition);
+		maximumTransition = MAX(maximumTransition, rule.transition);
+	}
+	
+	// The spans are computed without sign, so that they can't overflow.
+	NSUInteger statesSpan = (NSUInteger)maximumState - (NSUInteger)minimumState;
+	NSUInteger transitionsSpan = (NSUInteger)maximumTransition - (NSUInteger)minimumTransition;
+	if((statesSpan >= MaximumCellsCount) || (transitionsSpan >= MaximumCellsCount) || ((statesSpan + 1) * (transitionsSpan + 1) > MaximumCellsCount))
+		@throw [NSException exceptionWithName:NSInvalidArgumentException reason:[NSString stringWithFormat:@"%@<%@>: Rules too sparse. [states = '%@'; transitions = '%@']", ClassName, JFStringFromPointer(self), JFStringFromNSUInteger(statesSpan + 1), JFStringFromNSUInteger(transitionsSpan + 1)] userInfo:nil];
+	
+	NSUInteger statesCount = ((count > 0) ? statesSpan + 1 : 0);
+	NSUInteger transitionsCount = ((count > 0) ? transitionsSpan + 1 : 0);
+	
+	JFStateMachineTransitionTableCell* cells = NULL;
+	JFStateMachineTransitionTableRow* rows = NULL;
+	if(count > 0)
+	{
+		cells = malloc(sizeof(JFStateMachineTransitionTableCell) * statesCount * transitionsCount);
+		rows = malloc(sizeof(JFStateMachineTransitionTableRow) * transitionsCount);
+		if(!cells || !rows)
+		{
+			free(cells);
+			free(rows);
+			@throw [NSException exceptionWithName:NSMallocException reason:[NSString stringWithFormat:@"%@<%@>: Failed to allocate the matrix.", ClassName, JFStringFromPointer(self)] userInfo:nil];
+		}
+		
+		for(NSUInteger i = 0; i < statesCount * transitionsCount; i++)
+			cells[i] = (JFStateMachineTransitionTableCell){JFStateNotAvailable, JFStateNotAvailable};
+		for(NSUInteger i = 0; i < transitionsCount; i++)
+			rows[i] = (JFStateMachineTransitionTableRow){JFStateNotAvailable, JFStateNotAvailable, NO};
+	}
+	
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		JFStateMachineTransitionRule rule = rules[i];
+		NSUInteger transitionIndex = (NSUInteger)rule.transition - (NSUInteger)minimumTransition;
+		
+		JFStateMachineTransitionTableCell* cell = &cells[transitionIndex * statesCount + ((NSUInteger)rule.beginningState - (NSUInteger)minimumState)];
+		if((cell->endingStateOnSuccess != JFStateNotAvailable) && ((cell->endingStateOnFailure != rule.endingStateOnFailure) || (cell->endingStateOnSuccess != rule.endingStateOnSuccess)))
+		{
+			free(cells);
+			free(rows);
+			@throw [NSException exceptionWithName:NSInvalidArgumentException reason:[NSString stringWithFormat:@"%@<%@>: Conflicting rules. [index = '%@']", ClassName, JFStringFromPointer(self), JFStringFromNSUInteger(i)] userInfo:nil];
+		}
+		cell->endingStateOnFailure = rule.endingStateOnFailure;
+		cell->endingStateOnSuccess = rule.endingStateOnSuccess;
+		
+		JFStateMachineTransitionTableRow* row = &rows[transitionIndex];
+		if(!row->registered)
+		{
+			row->endingStateOnFailure = rule.endingStateOnFailure;
+			row->endingStateOnSuccess = rule.endingStateOnSuccess;
+			row->registered = YES;
+			continue;
+		}
+		
+		if(row->endingStateOnFailure != rule.endingStateOnFailure)
+			row->endingStateOnFailure = JFStateNotAvailable;
+		if(row->endingStateOnSuccess != rule.endingStateOnSuccess)
+			row->endingStateOnSuccess = JFStateNotAvailable;
+	}
+	
+	_cells = cells;
+	_minimumState = minimumState;
+	_minimumTransition = minimumTransition;
+	_rows = rows;
+	_statesCount = statesCount;
+	_transitionsCount = transitionsCount;
+	
+	return self;
+}
+
+// =================================================================================================
+// MARK: Methods - State
+// =================================================================================================
+
+- (NSArray<NSNumber*>*)beginningStatesForTransition:(JFStateTransition)transition
+{
+	JFStateMachineTransitionTableCell* _Nullable cells = [self cellsForTransition:transition];
+	if(!cells)
+		return @[];
+	
+	NSMutableArray<NSNumber*>* retObj = [NSMutableArray<NSNumber*> array];
+	for(NSUInteger i = 0; i < _statesCount; i++)
+	{
+		if(cells[i].endingStateOnSuccess != JFStateNotAvailable)
+			[retObj addObject:@(_minimumState + (JFState)i)];
+	}
+	return [retObj copy];
+}
+
+- (BOOL)canPerformTransition:(JFStateTransition)transition fromState:(JFState)state
+{
+	JFStateMachineTransitionTableCell* _Nullable cell = [self cellForTransition:transition state:state];
+	return (cell && (cell->endingStateOnSuccess != JFStateNotAvailable));
+}
+
+- (JFStateMachineTransitionTableCell* _Nullable)cellForTransition:(JFStateTransition)transition state:(JFState)state
+{
+	JFStateMachineTransitionTableCell* _Nullable cells = [self cellsForTransition:transition];
+	if(!cells || (state < _minimumState))
+		return NULL;
+	
+	NSUInteger stateIndex = (NSUInteger)state - (NSUInteger)_minimumState;
+	return ((stateIndex < _statesCount) ? &cells[stateIndex] : NULL);
+}
+
+- (JFStateMachineTransitionTableCell* _Nullable)cellsForTransition:(JFStateTransition)transition
+{
+	if(![self containsTransition:transition])
+		return NULL;
+	
+	return &_cells[((NSUInteger)transition - (NSUInteger)_minimumTransition) * _statesCount];
+}
+
+- (BOOL)containsTransition:(JFStateTransition)transition
+{
+	if(transition < _minimumTransition)
+		return NO;
+	
+	NSUInteger transitionIndex = (NSUInteger)transition - (NSUInteger)_minimumTransition;
+	return ((transitionIndex < _transitionsCount) && _rows[transitionIndex].registered);
+}
+
+- (JFState)endingStateForFailedTransition:(JFStateTransition)transition
+{
+	return ([self containsTransition:transition] ? _rows[(NSUInteger)transition - (NSUInteger)_minimumTransition].endingStateOnFailure : JFStateNotAvailable);
+}
+
+- (JFState)endingStateForFailedTransition:(JFStateTransition)transition fromState:(JFState)state
+{
+	JFStateMachineTransitionTableCell* _Nullable cell = [self cellForTransition:transition state:state];
+	return (cell ? cell->endingStateOnFailure : JFStateNotAvailable);
+}
+
+- (JFState)endingStateForSucceededTransition:(JFStateTransition)transition
+{
+	return ([self containsTransition:transition] ? _rows[(NSUInteger)transition - (NSUInteger)_minimumTransition].endingStateOnSuccess : JFStateNotAvailable);
+}
+
+- (JFState)endingStateForSucceededTransition:(JFStateTransition)transition fromState:(JFState)state
+{
+	JFStateMachineTransitionTableCell* _Nullable cell = [self cellForTransition:transition state:state];
+	return (cell ? cell->endingStateOnSuccess : JFStateNotAvailable);
+}
+
+@end
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 NS_ASSUME_NONNULL_END
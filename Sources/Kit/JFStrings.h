@@ -250,6 +250,7 @@ FOUNDATION_EXPORT NSString* JFStringFromCGFloat(CGFloat value);
 
 /**
  * Creates a string using the given value.
+ * @discussion The string contains the shortest representation that converts back to the same value, and it doesn't depend on the locale of the process (see `JFNumberConversionPrintDouble`). Unlike the `%g` format, the number of significant digits is not limited to six and the exponent has no leading zeros: `1234567` is written as `1234567` and not as `1.23457e+06`, `0.1 + 0.2` as `0.30000000000000004` and not as `0.3`, `1.5e-7` as `1.5e-7` and not as `1.5e-07`.
  * @param value A double value.
  * @return A string containing the given value.
  */
@@ -257,6 +258,7 @@ FOUNDATION_EXPORT NSString* JFStringFromDouble(double value);
 
 /**
  * Creates a string using the given value.
+ * @discussion The string contains the shortest representation that converts back to the same value, and it doesn't depend on the locale of the process (see `JFNumberConversionPrintFloat`). Like in `JFStringFromDouble`, the number of significant digits is not limited to six and the exponent has no leading zeros: `16777216` is written as `16777216` and not as `1.67772e+07`.
  * @param value A float value.
  * @return A string containing the given value.
  */
@@ -26,6 +26,7 @@
 
 #import "JFStrings.h"
 
+#import "JFNumberConversion.h"
 #import "JFPreprocessorMacros.h"
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -257,12 +258,16 @@ NSString* JFStringFromCGFloat(CGFloat value)
 
 NSString* JFStringFromDouble(double value)
 {
-	return [NSString stringWithFormat:@"%lg", value];
+	char buffer[JFNumberConversionBufferSize];
+	NSUInteger length = JFNumberConversionPrintDouble(value, buffer);
+	return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
 }
 
 NSString* JFStringFromFloat(float value)
 {
-	return [NSString stringWithFormat:@"%g", value];
+	char buffer[JFNumberConversionBufferSize];
+	NSUInteger length = JFNumberConversionPrintFloat(value, buffer);
+	return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
 }
 
 NSString* JFStringFromFloat32(Float32 value)
@@ -58,6 +58,21 @@ NS_ASSUME_NONNULL_BEGIN
 	return (self.transition == JFSwitchTransitionOpening);
 }
 
++ (JFStateMachineTransitionTable*)transitionTable
+{
+	static JFStateMachineTransitionTable* retObj = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		// Beginning state, transition, ending state on success, ending state on failure.
+		JFStateMachineTransitionRule rules[] = {
+			{JFSwitchStateOpen, JFSwitchTransitionClosing, JFSwitchStateClosed, JFSwitchStateOpen},
+			{JFSwitchStateClosed, JFSwitchTransitionOpening, JFSwitchStateOpen, JFSwitchStateClosed},
+		};
+		retObj = [[JFStateMachineTransitionTable alloc] initWithRules:rules count:sizeof(rules) / sizeof(rules[0])];
+	});
+	return retObj;
+}
+
 // =================================================================================================
 // MARK: Lifecycle
 // =================================================================================================
@@ -105,78 +120,6 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - State
 // =================================================================================================
 
-- (NSArray<NSNumber*>*)beginningStatesForTransition:(JFStateTransition)transition
-{
-	NSArray<NSNumber*>* retObj;
-	switch(transition)
-	{
-		case JFSwitchTransitionClosing:
-		{
-			retObj = @[@(JFSwitchStateOpen)];
-			break;
-		}
-		case JFSwitchTransitionOpening:
-		{
-			retObj = @[@(JFSwitchStateClosed)];
-			break;
-		}
-		default:
-		{
-			retObj = [super beginningStatesForTransition:transition];
-			break;
-		}
-	}
-	return retObj;
-}
-
-- (JFState)endingStateForFailedTransition:(JFStateTransition)transition
-{
-	JFState retVal;
-	switch(transition)
-	{
-		case JFSwitchTransitionClosing:
-		{
-			retVal = JFSwitchStateOpen;
-			break;
-		}
-		case JFSwitchTransitionOpening:
-		{
-			retVal = JFSwitchStateClosed;
-			break;
-		}
-		default:
-		{
-			retVal = [super endingStateForFailedTransition:transition];
-			break;
-		}
-	}
-	return retVal;
-}
-
-- (JFState)endingStateForSucceededTransition:(JFStateTransition)transition
-{
-	JFState retVal;
-	switch(transition)
-	{
-		case JFSwitchTransitionClosing:
-		{
-			retVal = JFSwitchStateClosed;
-			break;
-		}
-		case JFSwitchTransitionOpening:
-		{
-			retVal = JFSwitchStateOpen;
-			break;
-		}
-		default:
-		{
-			retVal = [super endingStateForSucceededTransition:transition];
-			break;
-		}
-	}
-	return retVal;
-}
-
 - (NSString* _Nullable)stringFromState:(JFState)state
 {
 	NSString* retObj = nil;
@@ -26,6 +26,8 @@
 
 #import <XCTest/XCTest.h>
 
+#include <unistd.h>
+
 #import "JFByteStream.h"
 
 #import "JFStrings.h"
@@ -45,6 +47,13 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)testConstants;
 - (void)testFunctions;
 
+// =================================================================================================
+// MARK: Methods - Tests (Ownership)
+// =================================================================================================
+
+- (void)testMapping;
+- (void)testOwnership;
+
 @end
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -110,6 +119,66 @@ NS_ASSUME_NONNULL_BEGIN
 	XCTAssert((byteStream.length == length), @"The length of the bytes is '%@'; it should be '%@'.", JFStringFromNSUInteger(byteStream.length), JFStringFromNSUInteger(length));
 }
 
+// =================================================================================================
+// MARK: Methods - Tests (Ownership)
+// =================================================================================================
+
+- (void)testMapping
+{
+	NSUInteger pageSize = (NSUInteger)getpagesize();
+	NSMutableData* data = [NSMutableData dataWithLength:(pageSize * 3)];
+	Byte* bytes = (Byte*)data.mutableBytes;
+	for(NSUInteger index = 0; index < data.length; index++)
+		bytes[index] = (Byte)(index % 251);
+	
+	NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+	XCTAssertTrue([data writeToFile:path atomically:NO], @"Failed to write the file. [path = '%@']", path);
+	
+	// JFByteStreamMapFile
+	JFByteStream byteStream = JFByteStreamZero;
+	NSError* error = nil;
+	XCTAssertTrue(JFByteStreamMapFile(path, &byteStream, &error), @"Failed to map the file. [error = '%@']", error);
+	XCTAssert((byteStream.ownership == JFByteStreamOwnershipMapped), @"The stream should own a mapped file region.");
+	XCTAssert(JFByteStreamEqualToByteStream(byteStream, JFByteStreamMake(bytes, data.length)), @"The mapped stream is not equal to the content of the file.");
+	JFByteStreamFree(byteStream);
+	
+	// JFByteStreamMapFileRegion
+	NSUInteger offset = pageSize + 7;
+	XCTAssertTrue(JFByteStreamMapFileRegion(path, offset, pageSize, &byteStream, &error), @"Failed to map the file region. [error = '%@']", error);
+	XCTAssert(JFByteStreamEqualToByteStream(byteStream, JFByteStreamMake(bytes + offset, pageSize)), @"The mapped stream is not equal to the region of the file.");
+	JFByteStreamFree(byteStream);
+	
+	XCTAssertFalse(JFByteStreamMapFileRegion(path, offset, pageSize * 2, &byteStream, &error), @"A region going past the end of the file should not be mapped.");
+	XCTAssertEqualObjects(error.domain, NSPOSIXErrorDomain, @"The error domain is '%@'; it should be '%@'.", error.domain, NSPOSIXErrorDomain);
+	
+	[[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+	XCTAssertFalse(JFByteStreamMapFile(path, &byteStream, &error), @"A missing file should not be mapped.");
+	XCTAssert((error.code == ENOENT), @"The error code is '%@'; it should be '%@'.", JFStringFromNSInteger(error.code), JFStringFromNSInteger(ENOENT));
+}
+
+- (void)testOwnership
+{
+	// JFByteStreamMakeWithData
+	NSData* data = [@"Prova" dataUsingEncoding:NSUTF8StringEncoding];
+	JFByteStream byteStream = JFByteStreamMakeWithData(data);
+	XCTAssert((byteStream.bytes == data.bytes), @"The stream should wrap the bytes of the data object without copying them.");
+	XCTAssert((byteStream.ownership == JFByteStreamOwnershipObject), @"The stream should own the data object.");
+	
+	// JFByteStreamSlice
+	JFByteStream slice = JFByteStreamSlice(byteStream, NSMakeRange(1, 10));
+	XCTAssert((slice.bytes == byteStream.bytes + 1), @"The slice should point inside the source stream.");
+	XCTAssert((slice.length == 4), @"The length of the slice is '%@'; it should be '4'.", JFStringFromNSUInteger(slice.length));
+	XCTAssert((slice.ownership == JFByteStreamOwnershipNone), @"The slice should not own its bytes.");
+	JFByteStreamFree(slice);
+	
+	// JFByteStreamRealloc
+	JFByteStream copy = JFByteStreamRealloc(JFByteStreamSlice(byteStream, NSMakeRange(0, 2)), 3);
+	XCTAssert((copy.ownership == JFByteStreamOwnershipMalloc), @"A reallocated view should own a copy of its bytes.");
+	XCTAssert((memcmp(copy.bytes, "Pr", 2) == 0), @"The reallocated view should keep its bytes.");
+	JFByteStreamFree(copy);
+	JFByteStreamFree(byteStream);
+}
+
 @end
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
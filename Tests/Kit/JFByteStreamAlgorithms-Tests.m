@@ -0,0 +1,287 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFByteStreamAlgorithms.h"
+
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFByteStreamAlgorithms_Tests : XCTestCase
+
+// =================================================================================================
+// MARK: Methods - Tests
+// =================================================================================================
+
+- (void)testComparison;
+- (void)testEncoding;
+- (void)testHashing;
+- (void)testSearch;
+
+// =================================================================================================
+// MARK: Methods - Tests (Performance)
+// =================================================================================================
+
+- (void)testCommonPrefixPerformance;
+- (void)testCRC32CPerformance;
+- (void)testHexEncodingPerformance;
+- (void)testSearchPerformance;
+- (void)testXXHash64Performance;
+
+// =================================================================================================
+// MARK: Methods - Utilities
+// =================================================================================================
+
+- (JFByteStream)byteStreamWithString:(const char*)string;
+- (void)measureKernel:(void (^)(JFByteStream byteStream))block;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFByteStreamAlgorithms_Tests
+
+// =================================================================================================
+// MARK: Methods - Tests
+// =================================================================================================
+
+- (void)testComparison
+{
+	Byte bytes1[100];
+	Byte bytes2[100];
+	for(NSUInteger index = 0; index < 100; index++)
+		bytes1[index] = bytes2[index] = (Byte)index;
+	
+	// JFByteStreamCommonPrefixLength
+	JFByteStream byteStream1 = JFByteStreamMake(bytes1, sizeof(bytes1));
+	JFByteStream byteStream2 = JFByteStreamMake(bytes2, sizeof(bytes2));
+	NSUInteger length = JFByteStreamCommonPrefixLength(byteStream1, byteStream2);
+	XCTAssertEqual(length, 100, @"The length of the common prefix is '%@'; it should be '100'.", JFStringFromNSUInteger(length));
+	length = JFByteStreamCommonPrefixLength(byteStream1, JFByteStreamMake(bytes2, 40));
+	XCTAssertEqual(length, 40, @"The length of the common prefix is '%@'; it should be '40'.", JFStringFromNSUInteger(length));
+	length = JFByteStreamCommonPrefixLength(byteStream1, JFByteStreamZero);
+	XCTAssertEqual(length, 0, @"The length of the common prefix is '%@'; it should be '0'.", JFStringFromNSUInteger(length));
+	
+	// Mismatches inside and outside of the vector blocks.
+	for(NSUInteger index = 0; index < 100; index++)
+	{
+		bytes2[index] ^= 0x80;
+		length = JFByteStreamCommonPrefixLength(byteStream1, byteStream2);
+		XCTAssertEqual(length, index, @"The length of the common prefix is '%@'; it should be '%@'.", JFStringFromNSUInteger(length), JFStringFromNSUInteger(index));
+		bytes2[index] ^= 0x80;
+	}
+	
+	// JFByteStreamHasPrefix
+	XCTAssertTrue(JFByteStreamHasPrefix(byteStream1, JFByteStreamMake(bytes2, 50)), @"The stream should have the first 50 bytes of the other stream as prefix.");
+	XCTAssertTrue(JFByteStreamHasPrefix(byteStream1, JFByteStreamZero), @"The stream should have the empty stream as prefix.");
+	XCTAssertFalse(JFByteStreamHasPrefix(JFByteStreamMake(bytes1, 50), byteStream2), @"The stream should not have a longer stream as prefix.");
+	XCTAssertFalse(JFByteStreamHasPrefix([self byteStreamWithString:"abc"], [self byteStreamWithString:"abd"]), @"The stream 'abc' should not have 'abd' as prefix.");
+}
+
+- (void)testEncoding
+{
+	// JFByteStreamEncodeBase64
+	const char* strings[] = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+	const char* encodings[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy"};
+	for(NSUInteger index = 0; index < 7; index++)
+	{
+		char chars[16];
+		NSUInteger length = JFByteStreamEncodeBase64([self byteStreamWithString:strings[index]], chars);
+		XCTAssertEqual(length, strlen(encodings[index]), @"The length of the encoding of '%s' is '%@'; it should be '%@'.", strings[index], JFStringFromNSUInteger(length), JFStringFromNSUInteger(strlen(encodings[index])));
+		XCTAssertEqual(length, JFByteStreamBase64EncodedLength(strlen(strings[index])), @"The length of the encoding of '%s' doesn't match the expected encoded length.", strings[index]);
+		XCTAssertEqual(memcmp(chars, encodings[index], length), 0, @"The encoding of '%s' should be '%s'.", strings[index], encodings[index]);
+		
+		// JFByteStreamDecodeBase64
+		Byte bytes[16];
+		NSUInteger decodedLength = 0;
+		XCTAssertTrue(JFByteStreamDecodeBase64(encodings[index], length, bytes, &decodedLength), @"Failed to decode '%s'.", encodings[index]);
+		XCTAssertEqual(decodedLength, strlen(strings[index]), @"The length of the decoding of '%s' is '%@'; it should be '%@'.", encodings[index], JFStringFromNSUInteger(decodedLength), JFStringFromNSUInteger(strlen(strings[index])));
+		XCTAssertEqual(memcmp(bytes, strings[index], decodedLength), 0, @"The decoding of '%s' should be '%s'.", encodings[index], strings[index]);
+	}
+	
+	Byte bytes[256];
+	NSUInteger length = 0;
+	XCTAssertFalse(JFByteStreamDecodeBase64("Zm9", 3, bytes, &length), @"A truncated encoding should not be decoded.");
+	XCTAssertFalse(JFByteStreamDecodeBase64("Zm!v", 4, bytes, &length), @"An encoding with invalid characters should not be decoded.");
+	XCTAssertFalse(JFByteStreamDecodeBase64("Z===", 4, bytes, &length), @"An encoding with too much padding should not be decoded.");
+	XCTAssertFalse(JFByteStreamDecodeBase64("Zg==Zg==", 8, bytes, &length), @"An encoding with padding in the middle should not be decoded.");
+	
+	for(NSUInteger index = 0; index < 256; index++)
+		bytes[index] = (Byte)index;
+	
+	// JFByteStreamEncodeHex
+	// The vector kernel encodes the first 16 bytes of each block, the scalar loop the rest.
+	char chars[512];
+	JFByteStreamEncodeHex(JFByteStreamMake(bytes, 256), chars);
+	XCTAssertEqual(memcmp(chars, "000102030405060708090a0b0c0d0e0f10", 34), 0, @"The encoding of the first bytes is not the expected one.");
+	XCTAssertEqual(memcmp(chars + 502, "fbfcfdfeff", 10), 0, @"The encoding of the last bytes is not the expected one.");
+	
+	// JFByteStreamDecodeHex
+	Byte decoded[256];
+	XCTAssertTrue(JFByteStreamDecodeHex(chars, 512, decoded), @"Failed to decode the hexadecimal encoding.");
+	XCTAssertEqual(memcmp(decoded, bytes, 256), 0, @"The decoded bytes are not equal to the encoded ones.");
+	XCTAssertTrue(JFByteStreamDecodeHex("AbCd", 4, decoded), @"Failed to decode a mixed case hexadecimal encoding.");
+	XCTAssertEqual(decoded[0], 0xAB, @"The first decoded byte should be '0xAB'.");
+	XCTAssertEqual(decoded[1], 0xCD, @"The second decoded byte should be '0xCD'.");
+	XCTAssertFalse(JFByteStreamDecodeHex("0g", 2, decoded), @"An encoding with invalid characters should not be decoded.");
+	XCTAssertFalse(JFByteStreamDecodeHex("0", 1, decoded), @"An encoding with an odd length should not be decoded.");
+}
+
+- (void)testHashing
+{
+	// JFByteStreamCRC32C
+	JFByteStream check = [self byteStreamWithString:"123456789"];
+	XCTAssertEqual(JFByteStreamCRC32C(check, 0), 0xE3069283, @"The checksum of the check string is not the expected one.");
+	XCTAssertEqual(JFByteStreamCRC32C(JFByteStreamMake(check.bytes + 4, 5), JFByteStreamCRC32C(JFByteStreamMake(check.bytes, 4), 0)), 0xE3069283, @"The checksum computed in two steps should be equal to the one computed at once.");
+	XCTAssertEqual(JFByteStreamCRC32C(JFByteStreamZero, 0), 0, @"The checksum of the empty stream should be '0'.");
+	
+	// JFByteStreamXXHash64
+	XCTAssertEqual(JFByteStreamXXHash64(JFByteStreamZero, 0), 0xEF46DB3751D8E999, @"The hash of the empty stream is not the expected one.");
+	XCTAssertEqual(JFByteStreamXXHash64([self byteStreamWithString:"a"], 1), 0xDEC2BC81C3CD46C6, @"The hash of 'a' is not the expected one.");
+	XCTAssertEqual(JFByteStreamXXHash64([self byteStreamWithString:"abc"], 0), 0x44BC2CF5AD770999, @"The hash of 'abc' is not the expected one.");
+	XCTAssertEqual(JFByteStreamXXHash64([self byteStreamWithString:"Nobody inspects the spammish repetition"], 0), 0xFBCEA83C8A378BF1, @"The hash of a string longer than a stripe is not the expected one.");
+	
+	Byte bytes[1024];
+	for(NSUInteger index = 0; index < 1024; index++)
+		bytes[index] = (Byte)index;
+	XCTAssertEqual(JFByteStreamXXHash64(JFByteStreamMake(bytes, sizeof(bytes)), 1), 0x3BD9FD41C5EC08C9, @"The hash of a long stream is not the expected one.");
+}
+
+- (void)testSearch
+{
+	// JFByteStreamIndexOfByte
+	JFByteStream byteStream = [self byteStreamWithString:"abracadabra, the quick brown fox jumps over the lazy dog; abracadabra"];
+	NSUInteger index = JFByteStreamIndexOfByte(byteStream, 'q', 0);
+	XCTAssertEqual(index, 17, @"The index of 'q' is '%@'; it should be '17'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByte(byteStream, 'a', 1);
+	XCTAssertEqual(index, 3, @"The index of 'a' from '1' is '%@'; it should be '3'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByte(byteStream, '!', 0);
+	XCTAssertEqual(index, NSNotFound, @"The index of '!' is '%@'; it should be 'NSNotFound'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByte(byteStream, 'a', byteStream.length);
+	XCTAssertEqual(index, NSNotFound, @"The index of 'a' from the end is '%@'; it should be 'NSNotFound'.", JFStringFromNSUInteger(index));
+	
+	// JFByteStreamIndexOfByteStream
+	index = JFByteStreamIndexOfByteStream(byteStream, [self byteStreamWithString:"abra"], 0);
+	XCTAssertEqual(index, 0, @"The index of 'abra' is '%@'; it should be '0'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, [self byteStreamWithString:"abra"], 1);
+	XCTAssertEqual(index, 7, @"The index of 'abra' from '1' is '%@'; it should be '7'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, [self byteStreamWithString:"abracadabra"], 1);
+	XCTAssertEqual(index, 58, @"The index of 'abracadabra' from '1' is '%@'; it should be '58'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, [self byteStreamWithString:"lazy dog"], 0);
+	XCTAssertEqual(index, 48, @"The index of 'lazy dog' is '%@'; it should be '48'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, [self byteStreamWithString:"lazy cat"], 0);
+	XCTAssertEqual(index, NSNotFound, @"The index of 'lazy cat' is '%@'; it should be 'NSNotFound'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, [self byteStreamWithString:"a"], 60);
+	XCTAssertEqual(index, 61, @"The index of 'a' from '60' is '%@'; it should be '61'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, JFByteStreamZero, 5);
+	XCTAssertEqual(index, 5, @"The index of the empty stream from '5' is '%@'; it should be '5'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, byteStream, 0);
+	XCTAssertEqual(index, 0, @"The index of the stream in itself is '%@'; it should be '0'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, byteStream, 1);
+	XCTAssertEqual(index, NSNotFound, @"The index of the stream in itself from '1' is '%@'; it should be 'NSNotFound'.", JFStringFromNSUInteger(index));
+	index = JFByteStreamIndexOfByteStream(byteStream, [self byteStreamWithString:"ra"], byteStream.length + 1);
+	XCTAssertEqual(index, NSNotFound, @"The index of 'ra' past the end is '%@'; it should be 'NSNotFound'.", JFStringFromNSUInteger(index));
+}
+
+// =================================================================================================
+// MARK: Methods - Tests (Performance)
+// =================================================================================================
+
+- (void)testCommonPrefixPerformance
+{
+	[self measureKernel:^(JFByteStream byteStream) {
+		JFByteStreamCommonPrefixLength(byteStream, byteStream);
+	}];
+}
+
+- (void)testCRC32CPerformance
+{
+	[self measureKernel:^(JFByteStream byteStream) {
+		JFByteStreamCRC32C(byteStream, 0);
+	}];
+}
+
+- (void)testHexEncodingPerformance
+{
+	[self measureKernel:^(JFByteStream byteStream) {
+		char* chars = malloc(byteStream.length * 2);
+		JFByteStreamEncodeHex(byteStream, chars);
+		free(chars);
+	}];
+}
+
+- (void)testSearchPerformance
+{
+	[self measureKernel:^(JFByteStream byteStream) {
+		Byte pattern[] = {0x00, 0x11, 0x22, 0x33, 0x44};
+		JFByteStreamIndexOfByteStream(byteStream, JFByteStreamMake(pattern, sizeof(pattern)), 0);
+	}];
+}
+
+- (void)testXXHash64Performance
+{
+	[self measureKernel:^(JFByteStream byteStream) {
+		JFByteStreamXXHash64(byteStream, 0);
+	}];
+}
+
+// =================================================================================================
+// MARK: Methods - Utilities
+// =================================================================================================
+
+- (JFByteStream)byteStreamWithString:(const char*)string
+{
+	return JFByteStreamMake((Byte*)string, strlen(string));
+}
+
+- (void)measureKernel:(void (^)(JFByteStream byteStream))block
+{
+	NSUInteger length = 64 * 1024 * 1024;
+	JFByteStream byteStream = JFByteStreamAlloc(length);
+	for(NSUInteger index = 0; index < length; index++)
+		byteStream.bytes[index] = (Byte)(index * 31 + (index >> 8));
+	
+	[self measureBlock:^{
+		block(byteStream);
+	}];
+	
+	JFByteStreamFree(byteStream);
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,198 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFByteStreamBuilder.h"
+
+#import "JFStrings.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFByteStreamBuilder_Tests : XCTestCase
+
+// =================================================================================================
+// MARK: Methods - Tests
+// =================================================================================================
+
+- (void)testAppend;
+- (void)testArena;
+- (void)testCapacity;
+
+// =================================================================================================
+// MARK: Methods - Tests (Performance)
+// =================================================================================================
+
+- (void)testPerformance;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFByteStreamBuilder_Tests
+
+// =================================================================================================
+// MARK: Methods - Tests
+// =================================================================================================
+
+- (void)testAppend
+{
+	// JFByteStreamBuilderAppend*
+	JFByteStreamBuilder builder = JFByteStreamBuilderAlloc(0);
+	XCTAssertTrue(JFByteStreamBuilderAppendByte(&builder, 0xFF), @"Failed to append a byte.");
+	XCTAssertTrue(JFByteStreamBuilderAppendUInt16BigEndian(&builder, 0x0102), @"Failed to append a big endian 16-bit integer.");
+	XCTAssertTrue(JFByteStreamBuilderAppendUInt16LittleEndian(&builder, 0x0102), @"Failed to append a little endian 16-bit integer.");
+	XCTAssertTrue(JFByteStreamBuilderAppendUInt32BigEndian(&builder, 0x01020304), @"Failed to append a big endian 32-bit integer.");
+	XCTAssertTrue(JFByteStreamBuilderAppendUInt64LittleEndian(&builder, 0x0102030405060708), @"Failed to append a little endian 64-bit integer.");
+	XCTAssertTrue(JFByteStreamBuilderAppendVarint(&builder, 300), @"Failed to append a varint.");
+	XCTAssertTrue(JFByteStreamBuilderAppendSignedVarint(&builder, -2), @"Failed to append a signed varint.");
+	XCTAssertFalse(builder.failed, @"The builder should not be marked as failed.");
+	
+	// JFByteStreamBuilderFinish
+	Byte expected[] = {0xFF, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x03, 0x04, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0xAC, 0x02, 0x03};
+	JFByteStream stream = JFByteStreamBuilderFinish(&builder);
+	XCTAssertTrue(JFByteStreamEqualToByteStream(stream, JFByteStreamMake(expected, sizeof(expected))), @"The appended bytes are not the expected ones.");
+	XCTAssertEqual(builder.stream.length, 0, @"The length of the finished builder is '%@'; it should be '0'.", JFStringFromNSUInteger(builder.stream.length));
+	XCTAssertEqual(builder.capacity, 0, @"The capacity of the finished builder is '%@'; it should be '0'.", JFStringFromNSUInteger(builder.capacity));
+	JFByteStreamFree(stream);
+	
+	// The 10 bytes of the longest varint.
+	builder = JFByteStreamBuilderAlloc(0);
+	JFByteStreamBuilderAppendSignedVarint(&builder, INT64_MIN);
+	XCTAssertEqual(builder.stream.length, 10, @"The length of the longest varint is '%@'; it should be '10'.", JFStringFromNSUInteger(builder.stream.length));
+	JFByteStreamBuilderFree(&builder);
+}
+
+- (void)testArena
+{
+	// JFByteStreamBuilderAllocInArena
+	JFByteStreamArena* arena = JFByteStreamArenaCreate(256);
+	
+	for(NSUInteger round = 0; round < 3; round++)
+	{
+		JFByteStreamBuilder builders[16];
+		for(NSUInteger index = 0; index < 16; index++)
+		{
+			builders[index] = JFByteStreamBuilderAllocInArena(arena, 4);
+			for(NSUInteger count = 0; count < index * 10; count++)
+				XCTAssertTrue(JFByteStreamBuilderAppendByte(&builders[index], (Byte)(index + count)), @"Failed to append byte '%@' to builder '%@'.", JFStringFromNSUInteger(count), JFStringFromNSUInteger(index));
+		}
+		
+		// The buffers grown in other slabs must keep their content.
+		for(NSUInteger index = 0; index < 16; index++)
+		{
+			XCTAssertEqual(builders[index].stream.length, index * 10, @"The length of builder '%@' is '%@'; it should be '%@'.", JFStringFromNSUInteger(index), JFStringFromNSUInteger(builders[index].stream.length), JFStringFromNSUInteger(index * 10));
+			for(NSUInteger count = 0; count < index * 10; count++)
+				XCTAssertEqual(builders[index].stream.bytes[count], (Byte)(index + count), @"The byte '%@' of builder '%@' has not been preserved.", JFStringFromNSUInteger(count), JFStringFromNSUInteger(index));
+		}
+		
+		// JFByteStreamArenaReset
+		JFByteStreamArenaReset(arena);
+	}
+	
+	// JFByteStreamBuilderShrinkToFit
+	JFByteStreamBuilder builder = JFByteStreamBuilderAllocInArena(arena, 0);
+	Byte buffer[1000] = {1};
+	XCTAssertTrue(JFByteStreamBuilderAppendBytes(&builder, buffer, sizeof(buffer)), @"Failed to append the bytes to the builder.");
+	XCTAssertTrue(JFByteStreamBuilderShrinkToFit(&builder), @"Failed to shrink the builder.");
+	XCTAssertEqual(builder.capacity, sizeof(buffer), @"The capacity of the builder is '%@'; it should be '%@'.", JFStringFromNSUInteger(builder.capacity), JFStringFromNSUInteger(sizeof(buffer)));
+	
+	// JFByteStreamBuilderFinish
+	JFByteStream stream = JFByteStreamBuilderFinish(&builder);
+	XCTAssertEqual(stream.length, sizeof(buffer), @"The length of the stream is '%@'; it should be '%@'.", JFStringFromNSUInteger(stream.length), JFStringFromNSUInteger(sizeof(buffer)));
+	XCTAssertEqual(stream.bytes[0], 1, @"The first byte of the stream has not been preserved.");
+	
+	JFByteStreamArenaDestroy(arena);
+}
+
+- (void)testCapacity
+{
+	// JFByteStreamBuilderReserve
+	JFByteStreamBuilder builder = JFByteStreamBuilderAlloc(10);
+	XCTAssertEqual(builder.capacity, 10, @"The capacity of the builder is '%@'; it should be '10'.", JFStringFromNSUInteger(builder.capacity));
+	XCTAssertTrue(JFByteStreamBuilderReserve(&builder, 1000), @"Failed to reserve capacity.");
+	XCTAssertGreaterThanOrEqual(builder.capacity, 1000, @"The capacity of the builder is '%@'; it should be at least '1000'.", JFStringFromNSUInteger(builder.capacity));
+	XCTAssertEqual(builder.stream.length, 0, @"The length of the builder is '%@'; it should be '0'.", JFStringFromNSUInteger(builder.stream.length));
+	
+	// JFByteStreamBuilderExtend
+	Byte* bytes = JFByteStreamBuilderExtend(&builder, 3);
+	XCTAssertTrue(bytes != NULL, @"The pointer to the extended bytes is NULL.");
+	memcpy(bytes, "abc", 3);
+	
+	// JFByteStreamBuilderShrinkToFit
+	XCTAssertTrue(JFByteStreamBuilderShrinkToFit(&builder), @"Failed to shrink the builder.");
+	XCTAssertEqual(builder.capacity, 3, @"The capacity of the builder is '%@'; it should be '3'.", JFStringFromNSUInteger(builder.capacity));
+	XCTAssertEqual(memcmp(builder.stream.bytes, "abc", 3), 0, @"The content of the builder has not been preserved.");
+	
+	// JFByteStreamBuilderReset
+	JFByteStreamBuilderReset(&builder);
+	XCTAssertEqual(builder.stream.length, 0, @"The length of the builder is '%@'; it should be '0'.", JFStringFromNSUInteger(builder.stream.length));
+	XCTAssertEqual(builder.capacity, 3, @"The capacity of the builder is '%@'; it should be '3'.", JFStringFromNSUInteger(builder.capacity));
+	
+	// Failures.
+	XCTAssertFalse(JFByteStreamBuilderReserve(&builder, NSUIntegerMax), @"Reserving the maximum capacity should fail.");
+	XCTAssertTrue(builder.failed, @"The builder should be marked as failed.");
+	XCTAssertFalse(JFByteStreamBuilderAppendByte(&builder, 0), @"Appending to a failed builder should fail.");
+	JFByteStreamBuilderFree(&builder);
+}
+
+// =================================================================================================
+// MARK: Methods - Tests (Performance)
+// =================================================================================================
+
+- (void)testPerformance
+{
+	[self measureBlock:^{
+		JFByteStreamArena* arena = JFByteStreamArenaCreate(0);
+		for(NSUInteger iteration = 0; iteration < 1000; iteration++)
+		{
+			JFByteStreamBuilder builder = JFByteStreamBuilderAllocInArena(arena, 0);
+			for(uint64_t value = 0; value < 1000; value++)
+				JFByteStreamBuilderAppendVarint(&builder, value);
+			JFByteStreamArenaReset(arena);
+		}
+		JFByteStreamArenaDestroy(arena);
+		
+		JFByteStreamBuilder builder = JFByteStreamBuilderAlloc(0);
+		for(uint32_t value = 0; value < 1000000; value++)
+			JFByteStreamBuilderAppendUInt32BigEndian(&builder, value);
+		XCTAssertEqual(builder.stream.length, 4000000, @"The length of the builder is '%@'; it should be '4000000'.", JFStringFromNSUInteger(builder.stream.length));
+		JFByteStreamBuilderFree(&builder);
+	}];
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,287 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFCBORSerializer.h"
+#import "JFJSONArray.h"
+#import "JFJSONObject.h"
+#import "JFJSONSerializer.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+API_AVAILABLE(ios(8.0), macos(10.9))
+@interface JFCBORSerializer_Tests : XCTestCase
+
+@property (strong, nonatomic, readonly) NSArray<id<JFJSONConvertibleValue>>* jsonArray;
+@property (strong, nonatomic, readonly) NSData* jsonArrayData;
+@property (strong, nonatomic, readonly) NSDictionary<NSString*, id<JFJSONConvertibleValue>>* jsonObject;
+@property (strong, nonatomic, readonly) NSData* jsonObjectData;
+@property (strong, nonatomic, readonly) JFCBORSerializer* serializer;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFCBORSerializer_Tests
+
+@synthesize jsonArray = _jsonArray;
+@synthesize jsonArrayData = _jsonArrayData;
+@synthesize jsonObject = _jsonObject;
+@synthesize jsonObjectData = _jsonObjectData;
+@synthesize serializer = _serializer;
+
+- (NSArray<id<JFJSONConvertibleValue>>*)jsonArray
+{
+	NSArray<id<JFJSONConvertibleValue>>* retObj = _jsonArray;
+	if(!retObj)
+	{
+		retObj = [[JFJSONSerializer new] arrayFromData:self.jsonArrayData];
+		XCTAssertNotNil(retObj);
+		_jsonArray = retObj;
+	}
+	return retObj;
+}
+
+- (NSData*)jsonArrayData
+{
+	NSData* retObj = _jsonArrayData;
+	if(!retObj)
+	{
+		retObj = [[NSData alloc] initWithContentsOfURL:[[NSBundle bundleForClass:self.class] URLForResource:@"Array" withExtension:@"json"]];
+		XCTAssertNotNil(retObj);
+		_jsonArrayData = retObj;
+	}
+	return retObj;
+}
+
+- (NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)jsonObject
+{
+	NSDictionary<NSString*, id<JFJSONConvertibleValue>>* retObj = _jsonObject;
+	if(!retObj)
+	{
+		retObj = [[JFJSONSerializer new] dictionaryFromData:self.jsonObjectData];
+		XCTAssertNotNil(retObj);
+		_jsonObject = retObj;
+	}
+	return retObj;
+}
+
+- (NSData*)jsonObjectData
+{
+	NSData* retObj = _jsonObjectData;
+	if(!retObj)
+	{
+		retObj = [[NSData alloc] initWithContentsOfURL:[[NSBundle bundleForClass:self.class] URLForResource:@"Object" withExtension:@"json"]];
+		XCTAssertNotNil(retObj);
+		_jsonObjectData = retObj;
+	}
+	return retObj;
+}
+
+- (JFCBORSerializer*)serializer
+{
+	JFCBORSerializer* retObj = _serializer;
+	if(!retObj)
+	{
+		retObj = [JFCBORSerializer new];
+		XCTAssertNotNil(retObj);
+		_serializer = retObj;
+	}
+	return retObj;
+}
+
+- (void)testArrayRoundTrip
+{
+	JFCBORSerializer* serializer = self.serializer;
+	
+	XCTAssertNil([serializer arrayFromData:nil]);
+	XCTAssertNil([serializer arrayFromData:[NSData new]]);
+	XCTAssertNil([serializer dataFromArray:nil]);
+	XCTAssertNil([serializer dataFromArray:@[@[[NSObject new]]]]);
+	
+	NSArray<id<JFJSONConvertibleValue>>* source = self.jsonArray;
+	
+	NSData* data = [serializer dataFromArray:source];
+	XCTAssertNotNil(data);
+	XCTAssertNil([serializer dictionaryFromData:data]);
+	
+	NSArray<id<JFJSONConvertibleValue>>* result = [serializer arrayFromData:data];
+	XCTAssertNotNil(result);
+	XCTAssertEqualObjects(source, result);
+	
+	NSString* string = [serializer stringFromArray:source];
+	XCTAssertNotNil(string);
+	XCTAssertEqualObjects(source, [serializer arrayFromString:string]);
+}
+
+- (void)testDictionaryRoundTrip
+{
+	JFCBORSerializer* serializer = self.serializer;
+	
+	XCTAssertNil([serializer dictionaryFromData:nil]);
+	XCTAssertNil([serializer dictionaryFromData:[NSData new]]);
+	XCTAssertNil([serializer dataFromDictionary:nil]);
+	XCTAssertNil([serializer dataFromDictionary:@{@"":@[[NSObject new]]}]);
+	
+	NSDictionary<NSString*, id<JFJSONConvertibleValue>>* source = self.jsonObject;
+	
+	NSData* data = [serializer dataFromDictionary:source];
+	XCTAssertNotNil(data);
+	XCTAssertNil([serializer arrayFromData:data]);
+	
+	NSDictionary<NSString*, id<JFJSONConvertibleValue>>* result = [serializer dictionaryFromData:data];
+	XCTAssertNotNil(result);
+	XCTAssertEqualObjects(source, result);
+	
+	NSString* string = [serializer stringFromDictionary:source];
+	XCTAssertNotNil(string);
+	XCTAssertEqualObjects(source, [serializer dictionaryFromString:string]);
+}
+
+- (void)testInvalidData
+{
+	JFCBORSerializer* serializer = self.serializer;
+	
+	NSData* data = [serializer dataFromArray:self.jsonArray];
+	XCTAssertNil([serializer arrayFromData:[data subdataWithRange:NSMakeRange(0, data.length - 1)]]);
+	
+	NSMutableData* trailing = [data mutableCopy];
+	[trailing appendBytes:"\x00" length:1];
+	XCTAssertNil([serializer arrayFromData:trailing]);
+	
+	// Byte strings have no JSON counterpart.
+	XCTAssertNil([serializer arrayFromData:[NSData dataWithBytes:"\x81\x41\x00" length:3]]);
+	
+	// Map keys must be strings.
+	XCTAssertNil([serializer dictionaryFromData:[NSData dataWithBytes:"\xA1\x01\x02" length:3]]);
+	
+	// Huge declared lengths must not be trusted.
+	XCTAssertNil([serializer arrayFromData:[NSData dataWithBytes:"\x9B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF" length:9]]);
+}
+
+- (void)testInvalidStrings
+{
+	JFCBORSerializer* serializer = self.serializer;
+	
+	// An unpaired surrogate can't be converted to UTF-8.
+	unichar surrogate = 0xD800;
+	NSString* string = [NSString stringWithCharacters:&surrogate length:1];
+	
+	XCTAssertNil([serializer dataFromArray:@[string]]);
+	XCTAssertNil([serializer dataFromDictionary:@{@"key":string}]);
+	XCTAssertNil([serializer dataFromDictionary:@{string:@"value"}]);
+	XCTAssertNotNil([serializer dataFromArray:@[@""]]);
+}
+
+- (void)testIndefiniteLengths
+{
+	// [_ "a", {_ "b": (_ "c", "d")}]
+	NSData* data = [NSData dataWithBytes:"\x9F\x61\x61\xBF\x61\x62\x7F\x61\x63\x61\x64\xFF\xFF\xFF" length:14];
+	NSArray<id<JFJSONConvertibleValue>>* expected = @[@"a", @{@"b":@"cd"}];
+	XCTAssertEqualObjects([self.serializer arrayFromData:data], expected);
+}
+
+- (void)testNodes
+{
+	JFCBORSerializer* serializer = self.serializer;
+	
+	JFJSONObject* source = [JFJSONObject objectWithData:self.jsonObjectData];
+	XCTAssertNotNil(source);
+	
+	source.serializer = serializer;
+	NSData* data = source.dataValue;
+	XCTAssertNotNil(data);
+	XCTAssertEqualObjects([serializer dictionaryFromData:data], self.jsonObject);
+	
+	JFJSONObject* object = [JFJSONObject objectWithData:data serializer:serializer];
+	XCTAssertNotNil(object);
+	XCTAssertEqualObjects(object, source);
+	XCTAssertTrue([[object valueForKey:@"object"] isKindOfClass:JFJSONObject.class]);
+	XCTAssertTrue([[object valueForKey:@"array"] isKindOfClass:JFJSONArray.class]);
+	XCTAssertEqualObjects(object.dictionaryValue, self.jsonObject);
+	
+	JFJSONArray* array = [[JFJSONArray alloc] initWithData:[serializer dataFromArray:self.jsonArray] serializer:serializer];
+	XCTAssertNotNil(array);
+	XCTAssertEqualObjects(array.arrayValue, self.jsonArray);
+	XCTAssertEqualObjects([serializer arrayFromData:array.dataValue], self.jsonArray);
+	
+	XCTAssertNil([[JFJSONArray alloc] initWithData:data serializer:serializer]);
+}
+
+- (void)testPackedArrays
+{
+	JFCBORSerializer* serializer = self.serializer;
+	
+	int64_t integers[] = {0, 24, -25, INT64_MIN, INT64_MAX};
+	JFJSONArray* source = [[JFJSONArray alloc] initWithIntegers:integers count:5];
+	source.serializer = serializer;
+	
+	NSData* data = source.dataValue;
+	XCTAssertEqualObjects([serializer arrayFromData:data], source.arrayValue);
+	
+	JFJSONArray* result = [[JFJSONArray alloc] initWithData:data serializer:serializer];
+	XCTAssertEqual(result.storage, JFJSONArrayStorageIntegers);
+	XCTAssertEqualObjects(result, source);
+	
+	JFJSONObject* object = [JFJSONObject objectWithData:[serializer dataFromDictionary:@{@"values":@[@0.5, @(-0.25)], @"mixed":@[@1, @0.5]}] serializer:serializer];
+	XCTAssertEqual([object arrayForKey:@"values"].storage, JFJSONArrayStorageDoubles);
+	XCTAssertEqual([object arrayForKey:@"mixed"].storage, JFJSONArrayStorageObjects);
+	XCTAssertEqualObjects([object arrayForKey:@"mixed"].arrayValue, (@[@1, @0.5]));
+}
+
+- (void)testNumbers
+{
+	JFCBORSerializer* serializer = self.serializer;
+	
+	NSArray<NSNumber*>* source = @[@0, @23, @24, @255, @256, @65535, @65536, @(UINT32_MAX), @(INT64_MAX), @(UINT64_MAX), @(-1), @(-24), @(-25), @(INT64_MIN), @1.5f, @(-0.1), @(DBL_MAX), @YES, @NO];
+	NSArray<NSNumber*>* result = (NSArray<NSNumber*>*)[serializer arrayFromData:[serializer dataFromArray:source]];
+	XCTAssertEqualObjects(source, result);
+	
+	XCTAssertEqual(result[9].unsignedLongLongValue, UINT64_MAX);
+	XCTAssertEqual(result[13].longLongValue, INT64_MIN);
+	XCTAssertEqual(strcmp(result[14].objCType, @encode(float)), 0);
+	XCTAssertEqual(strcmp(result[15].objCType, @encode(double)), 0);
+	XCTAssertEqual(result[17], (NSNumber*)kCFBooleanTrue);
+	XCTAssertEqual(result[18], (NSNumber*)kCFBooleanFalse);
+	
+	// Half precision values are widened while decoding.
+	NSArray<NSNumber*>* halves = (NSArray<NSNumber*>*)[serializer arrayFromData:[NSData dataWithBytes:"\x82\xF9\x3C\x00\xF9\xC4\x00" length:7]];
+	XCTAssertEqualObjects(halves, (@[@1.0, @(-4.0)]));
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -329,6 +329,100 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertEqualObjects(jsonArray.arrayValue, self.array);
 }
 
+- (void)testPackedStorage
+{
+	NSArray<id<JFJSONConvertibleValue>>* integers = @[@1, @(-2), @(INT64_MAX)];
+	NSArray<id<JFJSONConvertibleValue>>* doubles = @[@0.5, @(-1.25)];
+	
+	XCTAssertEqual([[JFJSONArray alloc] initWithArray:integers].storage, JFJSONArrayStorageIntegers);
+	XCTAssertEqual([[JFJSONArray alloc] initWithArray:doubles].storage, JFJSONArrayStorageDoubles);
+	XCTAssertEqual([[JFJSONArray alloc] initWithArray:@[@1, @0.5]].storage, JFJSONArrayStorageObjects);
+	XCTAssertEqual([[JFJSONArray alloc] initWithArray:@[@YES, @NO]].storage, JFJSONArrayStorageObjects);
+	XCTAssertEqual([[JFJSONArray alloc] initWithArray:@[@(UINT64_MAX)]].storage, JFJSONArrayStorageObjects);
+	XCTAssertEqual([[JFJSONArray alloc] initWithString:@"[1, 2, 3]"].storage, JFJSONArrayStorageIntegers);
+	
+	JFJSONArray* jsonArray = [[JFJSONArray alloc] initWithArray:integers];
+	XCTAssertEqual(jsonArray.count, 3);
+	XCTAssertEqualObjects(jsonArray.arrayValue, integers);
+	XCTAssertEqualObjects([jsonArray numberAtIndex:1], @(-2));
+	XCTAssertEqualObjects(jsonArray, [JFJSONArray arrayWithString:jsonArray.stringValue]);
+	XCTAssertEqualObjects(jsonArray.copy, jsonArray);
+	
+	int64_t buffer[3] = {0};
+	XCTAssertTrue([jsonArray getIntegers:buffer range:NSMakeRange(1, 2)]);
+	XCTAssertEqual(buffer[0], -2);
+	XCTAssertEqual(buffer[1], INT64_MAX);
+	XCTAssertFalse([jsonArray getIntegers:buffer range:NSMakeRange(2, 2)]);
+	
+	NSUInteger count = 0;
+	for(NSNumber* number in jsonArray)
+		XCTAssertEqualObjects(number, integers[count++]);
+	XCTAssertEqual(count, 3);
+	
+	[jsonArray addNumber:@4];
+	[jsonArray insertNumber:@0 atIndex:0];
+	[jsonArray removeValueAtIndex:1];
+	XCTAssertEqual(jsonArray.storage, JFJSONArrayStorageIntegers);
+	XCTAssertEqualObjects(jsonArray.arrayValue, (@[@0, @(-2), @(INT64_MAX), @4]));
+	
+	[jsonArray addString:@""];
+	XCTAssertEqual(jsonArray.storage, JFJSONArrayStorageObjects);
+	XCTAssertEqualObjects(jsonArray.arrayValue, (@[@0, @(-2), @(INT64_MAX), @4, @""]));
+	XCTAssertFalse([jsonArray getIntegers:buffer range:NSMakeRange(3, 2)]);
+	
+	double values[] = {1.5, 2.5};
+	jsonArray = [[JFJSONArray alloc] initWithDoubles:values count:2];
+	XCTAssertEqual(jsonArray.storage, JFJSONArrayStorageDoubles);
+	XCTAssertEqualObjects(jsonArray, [[JFJSONArray alloc] initWithArray:@[@1.5, @2.5]]);
+	
+	int64_t others[] = {1};
+	[jsonArray addIntegers:others count:1];
+	XCTAssertEqual(jsonArray.storage, JFJSONArrayStorageObjects);
+	XCTAssertEqualObjects(jsonArray.arrayValue, (@[@1.5, @2.5, @1]));
+	
+	[jsonArray removeAllValues];
+	[jsonArray addIntegers:others count:1];
+	XCTAssertEqual(jsonArray.storage, JFJSONArrayStorageIntegers);
+}
+
+- (void)testSharedKeyLayouts
+{
+	NSArray<id<JFJSONConvertibleValue>>* array = @[@{@"id":@1, @"name":@"a"}, @{@"name":@"b", @"id":@2}, @{@"id":@3}];
+	
+	JFJSONArray* jsonArray = [[JFJSONArray alloc] initWithArray:array];
+	XCTAssertEqualObjects(jsonArray.arrayValue, array);
+	
+	JFJSONObject* first = [jsonArray objectAtIndex:0];
+	JFJSONObject* second = [jsonArray objectAtIndex:1];
+	JFJSONObject* third = [jsonArray objectAtIndex:2];
+	XCTAssertEqualObjects(first.allKeys, second.allKeys);
+	XCTAssertEqual([first.allKeys indexOfObjectIdenticalTo:third.allKeys.firstObject], [first.allKeys indexOfObject:@"id"]);
+	XCTAssertEqualObjects(first, [[JFJSONObject alloc] initWithDictionary:(NSDictionary<NSString*, id<JFJSONConvertibleValue>>*)array[0]]);
+	
+	[second setString:@"a" forKey:@"name"];
+	[second setNumber:@1 forKey:@"id"];
+	XCTAssertEqualObjects(first, second);
+	XCTAssertEqual(first.hash, second.hash);
+	
+	[second setNullForKey:@"extra"];
+	XCTAssertEqual(second.count, 3);
+	XCTAssertNotEqualObjects(first, second);
+	
+	[second removeValueForKey:@"extra"];
+	XCTAssertEqualObjects(first, second);
+	
+	[first removeValueForKey:@"name"];
+	XCTAssertNotEqualObjects(first, third);
+	
+	[first setNumber:@3 forKey:@"id"];
+	XCTAssertEqualObjects(first, third);
+	XCTAssertEqualObjects(third.copy, third);
+	
+	[first removeAllValues];
+	XCTAssertEqual(first.count, 0);
+	XCTAssertEqualObjects(second.dictionaryValue, array[0]);
+}
+
 - (void)testIsEqual
 {
 	JFJSONArray* jsonArray = [self newJSONArray];
@@ -345,6 +439,27 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertEqualObjects(jsonArray2, jsonArray);
 }
 
+- (void)testHash
+{
+	int64_t integers[] = {1, 2, 3};
+	JFJSONArray* packedJSONArray = [[JFJSONArray alloc] initWithIntegers:integers count:3];
+	JFJSONArray* jsonArray = [[JFJSONArray alloc] initWithArray:@[@1.0, @2.0, @3.0]];
+	XCTAssertEqualObjects(packedJSONArray, jsonArray);
+	XCTAssertEqual(packedJSONArray.hash, jsonArray.hash);
+	
+	[jsonArray replaceWithNumber:@4 atIndex:2];
+	XCTAssertNotEqual(packedJSONArray.hash, jsonArray.hash);
+	XCTAssertNotEqualObjects(packedJSONArray, jsonArray);
+	
+	// Changing a nested node must change the hash of the array containing it.
+	JFJSONArray* outerJSONArray = [[JFJSONArray alloc] initWithArray:@[@[@1, @2, @3]]];
+	NSUInteger hash = outerJSONArray.hash;
+	[[outerJSONArray arrayAtIndex:0] addNull];
+	XCTAssertNotEqual(outerJSONArray.hash, hash);
+	[[outerJSONArray arrayAtIndex:0] removeValueAtIndex:3];
+	XCTAssertEqual(outerJSONArray.hash, hash);
+}
+
 - (void)testAddArray
 {
 	JFJSONArray* jsonArray = [self newJSONArray];
@@ -633,6 +748,43 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertEqualObjects(jsonArray, copiedJSONArray);
 }
 
+- (void)testCopyOnWrite
+{
+	JFJSONArray* jsonArray = [[JFJSONArray alloc] initWithArray:@[@{@"name": @"0"}, @[@0, @1]]];
+	JFJSONArray* copiedJSONArray = [jsonArray copy];
+	XCTAssertEqualObjects(jsonArray, copiedJSONArray);
+	XCTAssertEqual(jsonArray.hash, copiedJSONArray.hash);
+	
+	// Changing a node of the copy must not affect the original array.
+	[[copiedJSONArray objectAtIndex:0] setString:@"1" forKey:@"name"];
+	XCTAssertEqualObjects([[jsonArray objectAtIndex:0] stringForKey:@"name"], @"0");
+	XCTAssertEqualObjects([[copiedJSONArray objectAtIndex:0] stringForKey:@"name"], @"1");
+	
+	// Changing the original array must not affect the copy.
+	[[jsonArray arrayAtIndex:1] addNull];
+	XCTAssertEqual([jsonArray arrayAtIndex:1].count, 3);
+	XCTAssertEqual([copiedJSONArray arrayAtIndex:1].count, 2);
+	
+	// A node handed out before copying must not affect the copy.
+	JFJSONArray* numbers = [jsonArray arrayAtIndex:1];
+	copiedJSONArray = [jsonArray copy];
+	[numbers removeAllValues];
+	XCTAssertEqual([jsonArray arrayAtIndex:1].count, 0);
+	XCTAssertEqual([copiedJSONArray arrayAtIndex:1].count, 3);
+	
+	// A copy of a copy must not be affected either, even after the original array is gone.
+	JFJSONObject* object = nil;
+	@autoreleasepool
+	{
+		JFJSONArray* originalJSONArray = [[JFJSONArray alloc] initWithArray:@[@{@"name": @"0"}]];
+		object = [originalJSONArray objectAtIndex:0];
+		copiedJSONArray = [[originalJSONArray copy] copy];
+	}
+	[object setString:@"1" forKey:@"name"];
+	XCTAssertEqualObjects([object stringForKey:@"name"], @"1");
+	XCTAssertEqualObjects([[copiedJSONArray objectAtIndex:0] stringForKey:@"name"], @"0");
+}
+
 - (void)testFastEnumeration
 {
 	NSUInteger count = 10;
@@ -814,6 +966,58 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	}
 }
 
+- (void)testParallelProcessing
+{
+	NSUInteger count = 10000;
+	
+	JFJSONArray* jsonArray = [self newJSONArray];
+	NSUInteger sum = 0;
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		[jsonArray addNumber:@(index)];
+		sum += index;
+	}
+	
+	for(NSNumber* grainSize in @[@0, @1, @7, @(count)])
+	{
+		NSArray* squares = [jsonArray mapValuesWithGrainSize:grainSize.unsignedIntegerValue usingBlock:^id _Nullable(NSUInteger index, id<JFJSONValue> value) {
+			return ((index == 3) ? nil : @(((NSNumber*)value).unsignedIntegerValue * 2));
+		}];
+		XCTAssertEqual(squares.count, count);
+		XCTAssertEqualObjects(squares[2], @4);
+		XCTAssertEqualObjects(squares[3], NSNull.null);
+		XCTAssertEqualObjects(squares.lastObject, @((count - 1) * 2));
+		
+		JFJSONArray* evens = [jsonArray filterValuesWithGrainSize:grainSize.unsignedIntegerValue usingBlock:^BOOL(NSUInteger index, id<JFJSONValue> value) {
+			return (((NSNumber*)value).unsignedIntegerValue % 2 == 0);
+		}];
+		XCTAssertEqual(evens.count, count / 2);
+		XCTAssertEqualObjects([evens numberAtIndex:1], @2);
+		XCTAssertEqualObjects([evens numberAtIndex:evens.count - 1], @(count - 2));
+		
+		NSNumber* total = [jsonArray reduceValuesWithGrainSize:grainSize.unsignedIntegerValue initialValue:@0 usingBlock:^id _Nullable(id _Nullable result, NSUInteger index, id<JFJSONValue> value) {
+			return @([result unsignedIntegerValue] + ((NSNumber*)value).unsignedIntegerValue);
+		} combineBlock:^id _Nullable(id _Nullable result, id _Nullable other) {
+			return @([result unsignedIntegerValue] + [other unsignedIntegerValue]);
+		}];
+		XCTAssertEqualObjects(total, @(sum));
+		
+		// The order of the chunks is preserved even when the combination is not commutative.
+		NSString* digits = [jsonArray reduceValuesWithGrainSize:grainSize.unsignedIntegerValue initialValue:@"" usingBlock:^id _Nullable(id _Nullable result, NSUInteger index, id<JFJSONValue> value) {
+			return ((index < 10) ? [result stringByAppendingString:((NSNumber*)value).stringValue] : result);
+		} combineBlock:^id _Nullable(id _Nullable result, id _Nullable other) {
+			return [result stringByAppendingString:other];
+		}];
+		XCTAssertEqualObjects(digits, @"0123456789");
+	}
+	
+	XCTAssertEqualObjects([[self newJSONArray] reduceValuesWithGrainSize:0 initialValue:@42 usingBlock:^id _Nullable(id _Nullable result, NSUInteger index, id<JFJSONValue> value) {
+		return nil;
+	} combineBlock:^id _Nullable(id _Nullable result, id _Nullable other) {
+		return nil;
+	}], @42);
+}
+
 - (void)testObjectAtIndexedSubscript
 {
 	if(@available(macOS 10.8, *))
@@ -0,0 +1,251 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFJSONArray.h"
+#import "JFJSONDecoder.h"
+#import "JFJSONObject.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONDecoderTestsAuthor : NSObject
+
+@property (copy, nonatomic, nullable) NSString* name;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONDecoderTestsBook : NSObject
+
+@property (strong, nonatomic, nullable) JFJSONDecoderTestsAuthor* author;
+@property (assign, nonatomic, getter=isAvailable) BOOL available;
+@property (copy, nonatomic, nullable) NSString* city;
+@property (assign, nonatomic) NSInteger identifier;
+@property (assign, nonatomic) double price;
+@property (copy, nonatomic, nullable) NSArray<JFJSONDecoderTestsAuthor*>* reviewers;
+@property (strong, nonatomic, nullable) JFJSONArray* tags;
+@property (copy, nonatomic, nullable) NSString* title;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@interface JFJSONDecoder_Tests : XCTestCase
+
+@property (strong, nonatomic, readonly) JFJSONDecoder* decoder;
+
+- (NSData*)recordsDataWithCount:(NSUInteger)count;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDecoder_Tests
+
+@synthesize decoder = _decoder;
+
+- (JFJSONDecoder*)decoder
+{
+	JFJSONDecoder* retObj = _decoder;
+	if(!retObj)
+	{
+		JFJSONDecoder* authorDecoder = [JFJSONDecoder decoderWithModelClass:JFJSONDecoderTestsAuthor.class fields:@[
+			[JFJSONField fieldWithProperty:@"name" keyPath:@"name" type:JFJSONFieldTypeString],
+		]];
+		XCTAssertNotNil(authorDecoder);
+		
+		retObj = [JFJSONDecoder decoderWithModelClass:JFJSONDecoderTestsBook.class fields:@[
+			[JFJSONField fieldWithProperty:@"author" keyPath:@"author" decoder:authorDecoder],
+			[JFJSONField fieldWithProperty:@"available" keyPath:@"available" type:JFJSONFieldTypeNumber defaultValue:@YES],
+			[JFJSONField optionalFieldWithProperty:@"city" keyPath:@"author.address.city" type:JFJSONFieldTypeString],
+			[JFJSONField fieldWithProperty:@"identifier" keyPath:@"id" type:JFJSONFieldTypeNumber],
+			[JFJSONField fieldWithProperty:@"price" keyPath:@"price" type:JFJSONFieldTypeNumber],
+			[[JFJSONField alloc] initWithProperty:@"reviewers" keyPath:@"reviewers" type:JFJSONFieldTypeModelArray decoder:authorDecoder defaultValue:nil optional:YES],
+			[JFJSONField optionalFieldWithProperty:@"tags" keyPath:@"tags" type:JFJSONFieldTypeArray],
+			[JFJSONField fieldWithProperty:@"title" keyPath:@"title" type:JFJSONFieldTypeString],
+		]];
+		XCTAssertNotNil(retObj);
+		_decoder = retObj;
+	}
+	return retObj;
+}
+
+- (NSData*)recordsDataWithCount:(NSUInteger)count
+{
+	NSMutableString* string = [NSMutableString stringWithString:@"["];
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		if(index > 0)
+			[string appendString:@","];
+		[string appendFormat:@"{\"id\": %@, \"title\": \"Book %@\", \"price\": %@.5, \"available\": %@, \"author\": {\"name\": \"Author %@\", \"address\": {\"city\": \"City\"}}}", @(index), @(index), @(index % 100), ((index % 2) ? @"true" : @"false"), @(index % 10)];
+	}
+	[string appendString:@"]"];
+	return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)testDecoding
+{
+	NSData* data = [@"{\"id\": 7, \"title\": \"Title\", \"price\": 9.5, \"tags\": [\"a\", \"b\"], \"author\": {\"name\": \"Name\", \"address\": {\"city\": \"Rome\"}}, \"reviewers\": [{\"name\": \"First\"}, {\"name\": \"Second\"}]}" dataUsingEncoding:NSUTF8StringEncoding];
+	JFJSONObject* object = [JFJSONObject objectWithData:data];
+	XCTAssertNotNil(object);
+	
+	NSError* error = nil;
+	JFJSONDecoderTestsBook* treeBook = [self.decoder decodeObject:object error:&error];
+	XCTAssertNil(error);
+	JFJSONDecoderTestsBook* dataBook = [self.decoder decodeObjectFromData:data error:&error];
+	XCTAssertNil(error);
+	
+	for(JFJSONDecoderTestsBook* book in @[treeBook, dataBook])
+	{
+		XCTAssertEqual(book.identifier, 7);
+		XCTAssertEqualObjects(book.title, @"Title");
+		XCTAssertEqual(book.price, 9.5);
+		XCTAssertTrue(book.isAvailable);
+		XCTAssertEqualObjects(book.author.name, @"Name");
+		XCTAssertEqualObjects(book.city, @"Rome");
+		XCTAssertEqual(book.reviewers.count, 2);
+		XCTAssertEqualObjects(book.reviewers.lastObject.name, @"Second");
+		XCTAssertEqualObjects(book.tags.arrayValue, (@[@"a", @"b"]));
+	}
+	
+	// The decoded nodes are not shared with the record.
+	[treeBook.tags addString:@"c"];
+	XCTAssertEqual([object arrayForKey:@"tags"].count, 2);
+}
+
+- (void)testErrors
+{
+	NSError* error = nil;
+	XCTAssertNil([self.decoder decodeObjectFromData:[@"[1, 2]" dataUsingEncoding:NSUTF8StringEncoding] error:&error]);
+	XCTAssertEqualObjects(error.domain, JFJSONDecoder.errorDomain);
+	XCTAssertEqual(error.code, JFJSONDecoderErrorInvalidData);
+	
+	error = nil;
+	XCTAssertNil([self.decoder decodeObject:[JFJSONObject objectWithString:@"{\"id\": 1, \"price\": 1, \"author\": {\"name\": \"Name\"}}"] error:&error]);
+	XCTAssertEqual(error.code, JFJSONDecoderErrorMissingValue);
+	
+	error = nil;
+	XCTAssertNil([self.decoder decodeObject:[JFJSONObject objectWithString:@"{\"id\": \"1\", \"title\": \"Title\", \"price\": 1, \"author\": {\"name\": \"Name\"}}"] error:&error]);
+	XCTAssertEqual(error.code, JFJSONDecoderErrorTypeMismatch);
+	
+	error = nil;
+	XCTAssertNil([self.decoder decodeArrayFromData:[@"[{\"id\": 1, \"title\": \"Title\", \"price\": 1, \"author\": {\"name\": 2}}]" dataUsingEncoding:NSUTF8StringEncoding] error:&error]);
+	XCTAssertEqual(error.code, JFJSONDecoderErrorTypeMismatch);
+	XCTAssertNotNil(error.userInfo[NSUnderlyingErrorKey]);
+	
+	XCTAssertNil([JFJSONDecoder decoderWithModelClass:JFJSONDecoderTestsBook.class fields:@[[JFJSONField fieldWithProperty:@"missing" keyPath:@"missing" type:JFJSONFieldTypeString]]]);
+	XCTAssertNil([JFJSONDecoder decoderWithModelClass:JFJSONDecoderTestsBook.class fields:@[[JFJSONField fieldWithProperty:@"price" keyPath:@"price" type:JFJSONFieldTypeString]]]);
+	XCTAssertNil([JFJSONDecoder decoderWithModelClass:JFJSONDecoderTestsBook.class fields:@[[JFJSONField fieldWithProperty:@"title" keyPath:@"a..b" type:JFJSONFieldTypeString]]]);
+	XCTAssertNil([JFJSONDecoder decoderWithModelClass:JFJSONDecoderTestsBook.class fields:@[[JFJSONField optionalFieldWithProperty:@"reviewers" keyPath:@"reviewers" type:JFJSONFieldTypeModelArray]]]);
+}
+
+- (void)testManualDecodingPerformance
+{
+	JFJSONArray* records = [JFJSONArray arrayWithData:[self recordsDataWithCount:100000]];
+	XCTAssertNotNil(records);
+	
+	[self measureBlock:^{
+		NSMutableArray<JFJSONDecoderTestsBook*>* books = [NSMutableArray<JFJSONDecoderTestsBook*> arrayWithCapacity:records.count];
+		for(NSUInteger index = 0; index < records.count; index++)
+		{
+			JFJSONObject* record = [records objectAtIndex:index];
+			JFJSONObject* author = [record objectForKey:@"author"];
+			JFJSONDecoderTestsBook* book = [JFJSONDecoderTestsBook new];
+			book.author = [JFJSONDecoderTestsAuthor new];
+			book.author.name = [author stringForKey:@"name"];
+			book.available = ([record numberForKey:@"available"] ?: @YES).boolValue;
+			book.city = [[author objectForKey:@"address"] stringForKey:@"city"];
+			book.identifier = [record numberForKey:@"id"].integerValue;
+			book.price = [record numberForKey:@"price"].doubleValue;
+			book.title = [record stringForKey:@"title"];
+			[books addObject:book];
+		}
+		XCTAssertEqual(books.count, 100000);
+	}];
+}
+
+- (void)testTreeDecodingPerformance
+{
+	JFJSONArray* records = [JFJSONArray arrayWithData:[self recordsDataWithCount:100000]];
+	XCTAssertNotNil(records);
+	
+	JFJSONDecoder* decoder = self.decoder;
+	[self measureBlock:^{
+		XCTAssertEqual([decoder decodeArray:records error:nil].count, 100000);
+	}];
+}
+
+- (void)testDataDecodingPerformance
+{
+	NSData* data = [self recordsDataWithCount:100000];
+	
+	JFJSONDecoder* decoder = self.decoder;
+	[self measureBlock:^{
+		XCTAssertEqual([decoder decodeArrayFromData:data error:nil].count, 100000);
+	}];
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDecoderTestsAuthor
+
+@synthesize name = _name;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDecoderTestsBook
+
+@synthesize author = _author;
+@synthesize available = _available;
+@synthesize city = _city;
+@synthesize identifier = _identifier;
+@synthesize price = _price;
+@synthesize reviewers = _reviewers;
+@synthesize tags = _tags;
+@synthesize title = _title;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
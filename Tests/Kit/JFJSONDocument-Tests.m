@@ -0,0 +1,153 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFJSONDocument.h"
+#import "JFJSONPath.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONDocument_Tests : XCTestCase
+
+@property (strong, nonatomic, readonly) NSData* data;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONDocument_Tests
+
+@synthesize data = _data;
+
+- (NSData*)data
+{
+	NSData* retObj = _data;
+	if(!retObj)
+	{
+		retObj = [@"{\"name\": \"Caf\\u00e9 \\ud83d\\ude00\", \"count\": 3, \"price\": -12.5e1, \"big\": 18446744073709551616, \"flags\": [true, false, null], \"items\": [{\"id\": 1}, {\"id\": 2}, {\"id\": 3, \"tags\": [\"a\", \"b\"]}], \"empty\": {}}" dataUsingEncoding:NSUTF8StringEncoding];
+		_data = retObj;
+	}
+	return retObj;
+}
+
+- (void)testParsing
+{
+	JFJSONDocument* document = [JFJSONDocument documentWithData:self.data];
+	XCTAssertNotNil(document);
+	XCTAssertGreaterThan(document.size, 0);
+	
+	JFJSONDocumentObject* root = (JFJSONDocumentObject*)document.root;
+	XCTAssertTrue([root isKindOfClass:JFJSONDocumentObject.class]);
+	XCTAssertEqual(root.count, 7);
+	XCTAssertEqualObjects(root.allKeys, (@[@"name", @"count", @"price", @"big", @"flags", @"items", @"empty"]));
+	XCTAssertEqualObjects([root arrayForKey:@"items"].arrayValue, (@[@{@"id": @1}, @{@"id": @2}, @{@"id": @3, @"tags": @[@"a", @"b"]}]));
+	
+	XCTAssertEqualObjects([root stringForKey:@"name"], @"Café 😀");
+	XCTAssertEqualObjects([root numberForKey:@"count"], @3);
+	XCTAssertEqualObjects([root numberForKey:@"price"], @(-125.0));
+	XCTAssertEqualObjects([root numberForKey:@"big"], @18446744073709551616.0);
+	XCTAssertNil([root numberForKey:@"name"]);
+	XCTAssertNil([root stringForKey:@"missing"]);
+	XCTAssertTrue([root hasValueForKey:@"empty"]);
+	XCTAssertFalse([root hasValueForKey:@"missing"]);
+	XCTAssertEqual([root objectForKey:@"empty"].count, 0);
+	
+	JFJSONDocumentArray* flags = [root arrayForKey:@"flags"];
+	XCTAssertEqualObjects([flags numberAtIndex:0], @YES);
+	XCTAssertEqualObjects([flags numberAtIndex:1], @NO);
+	XCTAssertTrue([flags isNullAtIndex:2]);
+	XCTAssertFalse([flags isNullAtIndex:3]);
+	XCTAssertThrows([flags valueAtIndex:3]);
+	
+	JFJSONDocumentArray* items = [root arrayForKey:@"items"];
+	XCTAssertEqualObjects([[items objectAtIndex:2] arrayForKey:@"tags"][1], @"b");
+	XCTAssertEqualObjects([[JFJSONPath pathWithPointer:@"/items/2/tags/0"] firstValueInNode:root], @"a");
+	
+	NSMutableArray<NSNumber*>* identifiers = [NSMutableArray<NSNumber*> array];
+	for(JFJSONDocumentObject* item in items)
+		[identifiers addObject:[item numberForKey:@"id"]];
+	XCTAssertEqualObjects(identifiers, (@[@1, @2, @3]));
+	
+	[identifiers removeAllObjects];
+	[items enumerateValuesWithOptions:NSEnumerationReverse usingBlock:^BOOL(NSUInteger index, id<JFJSONValue> value) {
+		[identifiers addObject:[(JFJSONDocumentObject*)value numberForKey:@"id"]];
+		return NO;
+	}];
+	XCTAssertEqualObjects(identifiers, (@[@3, @2, @1]));
+	XCTAssertEqualObjects(items.valueEnumerator.allObjects, ((@[[items objectAtIndex:0], [items objectAtIndex:1], [items objectAtIndex:2]])));
+}
+
+- (void)testInvalidData
+{
+	NSArray<NSString*>* strings = @[@"", @"{", @"[1,]", @"{\"a\" 1}", @"[01]", @"[1.]", @"\"\\ud800\"", @"[\"\\x\"]", @"tru", @"[] []"];
+	for(NSString* string in strings)
+		XCTAssertNil([JFJSONDocument documentWithData:[string dataUsingEncoding:NSUTF8StringEncoding]], @"%@", string);
+	
+	XCTAssertNil([[JFJSONDocumentArray alloc] initWithString:@"{}" serializer:nil]);
+	XCTAssertNotNil([[JFJSONDocumentObject alloc] initWithString:@"{}" serializer:nil]);
+	XCTAssertEqualObjects([JFJSONDocument documentWithData:[@" 42 " dataUsingEncoding:NSUTF8StringEncoding]].root, @42);
+}
+
+- (void)testLifetime
+{
+	JFJSONDocumentArray* items = nil;
+	@autoreleasepool
+	{
+		JFJSONDocumentObject* root = [[JFJSONDocumentObject alloc] initWithData:self.data serializer:nil];
+		items = [root arrayForKey:@"items"];
+	}
+	
+	// The view keeps the document alive, even when the root is gone.
+	XCTAssertEqualObjects([[items objectAtIndex:0] numberForKey:@"id"], @1);
+	XCTAssertNotNil(items.dataValue);
+}
+
+- (void)testPerformance
+{
+	NSMutableArray* records = [NSMutableArray arrayWithCapacity:10000];
+	for(NSUInteger index = 0; index < 10000; index++)
+		[records addObject:@{@"id": @(index), @"name": [NSString stringWithFormat:@"Record %@", @(index)], @"score": @(index * 0.5), @"active": @(index % 2 == 0)}];
+	NSData* data = [NSJSONSerialization dataWithJSONObject:records options:0 error:NULL];
+	
+	[self measureBlock:^{
+		JFJSONDocument* document = [JFJSONDocument documentWithData:data];
+		XCTAssertEqual(((JFJSONDocumentArray*)document.root).count, 10000);
+	}];
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -385,6 +385,44 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertEqualObjects(jsonObject2, jsonObject);
 }
 
+- (void)testHash
+{
+	NSDictionary* dictionary = @{@"list": @[@1, @"2", [NSNull null]], @"object": @{@"name": @"0", @"value": @YES}};
+	JFJSONObject* jsonObject = [[JFJSONObject alloc] initWithDictionary:dictionary];
+	JFJSONObject* otherJSONObject = [[JFJSONObject alloc] initWithDictionary:dictionary];
+	XCTAssertEqualObjects(jsonObject, otherJSONObject);
+	XCTAssertEqual(jsonObject.hash, otherJSONObject.hash);
+	
+	NSSet<JFJSONObject*>* set = [NSSet setWithObjects:jsonObject, otherJSONObject, nil];
+	XCTAssertEqual(set.count, 1);
+	
+	// Changing a nested node must change the hash of the object containing it.
+	NSUInteger hash = jsonObject.hash;
+	[[jsonObject objectForKey:@"object"] setString:@"1" forKey:@"name"];
+	XCTAssertNotEqual(jsonObject.hash, hash);
+	XCTAssertNotEqualObjects(jsonObject, otherJSONObject);
+	
+	[[jsonObject objectForKey:@"object"] setString:@"0" forKey:@"name"];
+	XCTAssertEqual(jsonObject.hash, hash);
+	XCTAssertEqualObjects(jsonObject, otherJSONObject);
+	
+	// Changing a node nested deeper must change the hash of every node along the path, while the other nodes keep theirs.
+	JFJSONArray* list = [jsonObject arrayForKey:@"list"];
+	[list addObject:[self newJSONObject]];
+	JFJSONObject* item = [list objectAtIndex:3];
+	hash = jsonObject.hash;
+	NSUInteger listHash = list.hash;
+	NSUInteger objectHash = [jsonObject objectForKey:@"object"].hash;
+	[item setNullForKey:@"null"];
+	XCTAssertNotEqual(jsonObject.hash, hash);
+	XCTAssertNotEqual(list.hash, listHash);
+	XCTAssertEqual([jsonObject objectForKey:@"object"].hash, objectHash);
+	
+	[item removeValueForKey:@"null"];
+	XCTAssertEqual(jsonObject.hash, hash);
+	XCTAssertEqual(list.hash, listHash);
+}
+
 - (void)testArrayForKey
 {
 	JFJSONObject* jsonObject = [self newJSONObject];
@@ -549,6 +587,28 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertEqual([jsonObject valueForKey:key], value);
 }
 
+- (void)testTypedAccessPerformance
+{
+	NSArray<NSString*>* keys = @[@"array", @"null", @"number", @"object", @"string"];
+	NSArray<id<JFJSONValue>>* values = @[[JFJSONArray new], [NSNull null], @1, [JFJSONObject new], @"string"];
+	
+	[self measureBlock:^{
+		JFJSONObject* jsonObject = [self newJSONObject];
+		for(NSUInteger iteration = 0; iteration < 20000; iteration++)
+		{
+			for(NSUInteger index = 0; index < keys.count; index++)
+				[jsonObject setValue:values[index] forKey:keys[index]];
+			
+			XCTAssertNotNil([jsonObject arrayForKey:@"array"]);
+			XCTAssertTrue([jsonObject isNullForKey:@"null"]);
+			XCTAssertNotNil([jsonObject numberForKey:@"number"]);
+			XCTAssertNotNil([jsonObject objectForKey:@"object"]);
+			XCTAssertNotNil([jsonObject stringForKey:@"string"]);
+			XCTAssertNil([jsonObject numberForKey:@"string"]);
+		}
+	}];
+}
+
 - (void)testCopy
 {
 	JFJSONObject* jsonObject = [self newJSONObject];
@@ -573,6 +633,115 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertEqualObjects(jsonObject, copiedJSONObject);
 }
 
+- (void)testCopyOnWrite
+{
+	JFJSONObject* jsonObject = [[JFJSONObject alloc] initWithDictionary:@{@"list": @[@0, @1], @"object": @{@"name": @"0"}}];
+	JFJSONObject* copiedJSONObject = [jsonObject copy];
+	XCTAssertEqualObjects(jsonObject, copiedJSONObject);
+	XCTAssertEqual(jsonObject.hash, copiedJSONObject.hash);
+	
+	// Changing a node of the copy must not affect the original object.
+	[[copiedJSONObject objectForKey:@"object"] setString:@"1" forKey:@"name"];
+	XCTAssertEqualObjects([[jsonObject objectForKey:@"object"] stringForKey:@"name"], @"0");
+	XCTAssertEqualObjects([[copiedJSONObject objectForKey:@"object"] stringForKey:@"name"], @"1");
+	
+	// Changing the original object must not affect the copy.
+	[jsonObject setNullForKey:@"list"];
+	XCTAssertTrue([jsonObject isNullForKey:@"list"]);
+	XCTAssertEqual([copiedJSONObject arrayForKey:@"list"].count, 2);
+	
+	// A node handed out before copying must not affect the copy.
+	JFJSONObject* object = [jsonObject objectForKey:@"object"];
+	copiedJSONObject = [jsonObject copy];
+	[object removeAllValues];
+	XCTAssertEqual([jsonObject objectForKey:@"object"].count, 0);
+	XCTAssertEqual([copiedJSONObject objectForKey:@"object"].count, 1);
+	
+	// The same holds for objects storing their entries in a dictionary, even after the original object is gone.
+	JFJSONObject* node = nil;
+	@autoreleasepool
+	{
+		JFJSONObject* largeJSONObject = [[JFJSONObject alloc] initWithCapacity:16];
+		for(NSUInteger index = 0; index < 16; index++)
+			[largeJSONObject setNumber:@(index) forKey:JFStringFromNSUInteger(index)];
+		[largeJSONObject setObject:[self newJSONObject] forKey:@"node"];
+		node = [largeJSONObject objectForKey:@"node"];
+		copiedJSONObject = [largeJSONObject copy];
+	}
+	[node setNullForKey:@"null"];
+	XCTAssertEqual(node.count, 1);
+	XCTAssertEqual([copiedJSONObject objectForKey:@"node"].count, 0);
+}
+
+- (void)testSmallObjects
+{
+	// Up to 8 entries are stored inline; the 9th moves them to a dictionary.
+	JFJSONObject* jsonObject = [self newJSONObject];
+	NSMutableArray<NSString*>* keys = [NSMutableArray<NSString*> array];
+	for(NSUInteger index = 0; index < 8; index++)
+	{
+		NSString* key = JFStringFromNSUInteger(index);
+		[jsonObject setNumber:@(index) forKey:[key mutableCopy]];
+		[keys addObject:key];
+	}
+	XCTAssertEqual(jsonObject.count, 8);
+	XCTAssertEqualObjects(jsonObject.allKeys, keys);
+	XCTAssertEqualObjects([jsonObject numberForKey:@"7"], @7);
+	
+	[jsonObject removeValueForKey:@"3"];
+	[keys removeObject:@"3"];
+	XCTAssertNil([jsonObject valueForKey:@"3"]);
+	XCTAssertEqualObjects(jsonObject.allKeys, keys);
+	
+	NSMutableArray<NSString*>* enumeratedKeys = [NSMutableArray<NSString*> array];
+	for(NSString* key in jsonObject)
+		[enumeratedKeys addObject:key];
+	XCTAssertEqualObjects(enumeratedKeys, keys);
+	
+	JFJSONObject* copiedJSONObject = [jsonObject copy];
+	[copiedJSONObject setString:@"copy" forKey:@"0"];
+	XCTAssertEqualObjects([jsonObject numberForKey:@"0"], @0);
+	
+	for(NSUInteger index = 8; index < 12; index++)
+		[jsonObject setNumber:@(index) forKey:JFStringFromNSUInteger(index)];
+	XCTAssertEqual(jsonObject.count, 11);
+	XCTAssertEqualObjects([jsonObject numberForKey:@"0"], @0);
+	XCTAssertEqualObjects([jsonObject numberForKey:@"11"], @11);
+	
+	// Objects with the same entries are equal whatever their storage.
+	JFJSONObject* otherJSONObject = [[JFJSONObject alloc] initWithCapacity:20];
+	[jsonObject enumerateKeysAndValuesUsingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+		[otherJSONObject setValue:value forKey:key];
+		return NO;
+	}];
+	XCTAssertEqualObjects(jsonObject, otherJSONObject);
+	XCTAssertEqual(jsonObject.hash, otherJSONObject.hash);
+	
+	[jsonObject removeAllValues];
+	XCTAssertEqual(jsonObject.count, 0);
+	[jsonObject setNullForKey:@"null"];
+	XCTAssertTrue([jsonObject isNullForKey:@"null"]);
+}
+
+- (void)testSmallObjectsPerformance
+{
+	NSArray<NSString*>* keys = @[@"id", @"name", @"score", @"active", @"kind"];
+	NSArray<id<JFJSONValue>>* values = @[@1, @"name", @0.5, @YES, @"kind"];
+	
+	[self measureBlock:^{
+		for(NSUInteger iteration = 0; iteration < 100000; iteration++)
+		{
+			JFJSONObject* jsonObject = [JFJSONObject new];
+			for(NSUInteger index = 0; index < keys.count; index++)
+				[jsonObject setValue:values[index] forKey:keys[index]];
+			
+			for(NSString* key in keys)
+				XCTAssertNotNil([jsonObject valueForKey:key]);
+			XCTAssertNil([jsonObject valueForKey:@"missing"]);
+		}
+	}];
+}
+
 - (void)testFastEnumeration
 {
 	NSUInteger count = 10;
@@ -775,6 +944,42 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertTrue(allValues.count == 0);
 }
 
+- (void)testParallelProcessing
+{
+	NSUInteger count = 1000;
+	
+	JFJSONObject* jsonObject = [self newJSONObject];
+	NSUInteger sum = 0;
+	for(NSUInteger index = 0; index < count; index++)
+	{
+		[jsonObject setNumber:@(index) forKey:JFStringFromNSUInteger(index)];
+		sum += index;
+	}
+	
+	for(NSNumber* grainSize in @[@0, @1, @7, @(count)])
+	{
+		NSDictionary<NSString*, id>* doubles = [jsonObject mapValuesWithGrainSize:grainSize.unsignedIntegerValue usingBlock:^id _Nullable(NSString* key, id<JFJSONValue> value) {
+			return @(((NSNumber*)value).unsignedIntegerValue * 2);
+		}];
+		XCTAssertEqual(doubles.count, count);
+		XCTAssertEqualObjects(doubles[@"21"], @42);
+		
+		JFJSONObject* evens = [jsonObject filterValuesWithGrainSize:grainSize.unsignedIntegerValue usingBlock:^BOOL(NSString* key, id<JFJSONValue> value) {
+			return (((NSNumber*)value).unsignedIntegerValue % 2 == 0);
+		}];
+		XCTAssertEqual(evens.count, count / 2);
+		XCTAssertEqualObjects([evens numberForKey:@"20"], @20);
+		XCTAssertNil([evens numberForKey:@"21"]);
+		
+		NSNumber* total = [jsonObject reduceValuesWithGrainSize:grainSize.unsignedIntegerValue initialValue:@0 usingBlock:^id _Nullable(id _Nullable result, NSString* key, id<JFJSONValue> value) {
+			return @([result unsignedIntegerValue] + ((NSNumber*)value).unsignedIntegerValue);
+		} combineBlock:^id _Nullable(id _Nullable result, id _Nullable other) {
+			return @([result unsignedIntegerValue] + [other unsignedIntegerValue]);
+		}];
+		XCTAssertEqualObjects(total, @(sum));
+	}
+}
+
 - (void)testObjectForKeyedSubscript
 {
 	if(@available(macOS 10.8, *))
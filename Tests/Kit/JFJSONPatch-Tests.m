@@ -0,0 +1,122 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFJSONArray.h"
+#import "JFJSONObject.h"
+#import "JFJSONPatch.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONPatch_Tests : XCTestCase
+
+- (JFJSONObject*)objectWithString:(NSString*)string;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONPatch_Tests
+
+- (JFJSONObject*)objectWithString:(NSString*)string
+{
+	JFJSONObject* retObj = [[JFJSONObject alloc] initWithString:string];
+	XCTAssertNotNil(retObj);
+	return retObj;
+}
+
+- (void)testApply
+{
+	JFJSONObject* object = [self objectWithString:@"{\"a\": 1, \"b\": {\"c\": [1, 2, 3]}, \"d~/e\": \"x\"}"];
+	JFJSONArray* operations = [[JFJSONArray alloc] initWithString:@"[{\"op\": \"test\", \"path\": \"/a\", \"value\": 1}, {\"op\": \"add\", \"path\": \"/b/c/-\", \"value\": 4}, {\"op\": \"remove\", \"path\": \"/b/c/0\"}, {\"op\": \"replace\", \"path\": \"/d~0~1e\", \"value\": {\"f\": null}}, {\"op\": \"move\", \"from\": \"/a\", \"path\": \"/g\"}, {\"op\": \"copy\", \"from\": \"/b/c\", \"path\": \"/h\"}]"];
+	JFJSONPatch* patch = [JFJSONPatch patchWithOperations:operations];
+	XCTAssertNotNil(patch);
+	XCTAssertTrue([patch applyToObject:object]);
+	XCTAssertEqualObjects(object, [self objectWithString:@"{\"b\": {\"c\": [2, 3, 4]}, \"d~/e\": {\"f\": null}, \"g\": 1, \"h\": [2, 3, 4]}"]);
+	
+	// A failed operation leaves the object untouched.
+	JFJSONObject* expected = [object copy];
+	patch = [JFJSONPatch patchWithOperations:[[JFJSONArray alloc] initWithString:@"[{\"op\": \"remove\", \"path\": \"/g\"}, {\"op\": \"test\", \"path\": \"/b/c/0\", \"value\": 3}]"]];
+	XCTAssertNotNil(patch);
+	XCTAssertFalse([patch applyToObject:object]);
+	XCTAssertEqualObjects(object, expected);
+}
+
+- (void)testInvalidOperations
+{
+	NSArray<NSString*>* strings = @[@"[{\"op\": \"jump\", \"path\": \"/a\"}]", @"[{\"op\": \"add\", \"path\": \"a\", \"value\": 1}]", @"[{\"op\": \"add\", \"path\": \"/a\"}]", @"[{\"op\": \"move\", \"from\": \"/a\", \"path\": \"/a/b\"}]", @"[{\"op\": \"remove\", \"path\": \"/a~2\"}]"];
+	for(NSString* string in strings)
+		XCTAssertNil([JFJSONPatch patchWithOperations:[[JFJSONArray alloc] initWithString:string]], @"%@", string);
+}
+
+- (void)testDiff
+{
+	JFJSONObject* source = [self objectWithString:@"{\"id\": 7, \"name\": \"old\", \"tags\": [\"a\", \"b\", \"c\"], \"nested\": {\"big\": [1, 2, 3, 4, 5], \"flag\": true}, \"gone\": null}"];
+	JFJSONObject* target = [self objectWithString:@"{\"id\": 7, \"name\": \"new\", \"tags\": [\"a\", \"x\", \"b\", \"c\"], \"nested\": {\"big\": [1, 2, 3, 4, 5], \"flag\": false}, \"added\": {\"k\": 1}}"];
+	
+	JFJSONPatch* patch = [JFJSONPatch patchFromObject:source toObject:target];
+	XCTAssertEqual(patch.operations.count, 5);
+	XCTAssertEqual([JFJSONPatch patchFromObject:source toObject:[source copy]].operations.count, 0);
+	
+	JFJSONObject* object = [source copy];
+	XCTAssertTrue([patch applyToObject:object]);
+	XCTAssertEqualObjects(object, target);
+	
+	// The patch survives a round trip through JSON data.
+	JFJSONPatch* decoded = [JFJSONPatch patchWithOperations:[[JFJSONArray alloc] initWithData:patch.operations.dataValue]];
+	object = [source copy];
+	XCTAssertTrue([decoded applyToObject:object]);
+	XCTAssertEqualObjects(object, target);
+}
+
+- (void)testMergePatch
+{
+	JFJSONObject* source = [self objectWithString:@"{\"title\": \"Hello\", \"author\": {\"given\": \"John\", \"family\": \"Doe\"}, \"tags\": [\"example\", \"sample\"], \"content\": \"This will be unchanged\"}"];
+	JFJSONObject* patch = [self objectWithString:@"{\"title\": \"Hello!\", \"phone\": \"+01-123-456-7890\", \"author\": {\"family\": null}, \"tags\": [\"example\"]}"];
+	JFJSONObject* target = [self objectWithString:@"{\"title\": \"Hello!\", \"author\": {\"given\": \"John\"}, \"tags\": [\"example\"], \"content\": \"This will be unchanged\", \"phone\": \"+01-123-456-7890\"}"];
+	
+	JFJSONObject* object = [source copy];
+	[JFJSONPatch applyMergePatch:patch toObject:object];
+	XCTAssertEqualObjects(object, target);
+	
+	JFJSONObject* diff = [JFJSONPatch mergePatchFromObject:source toObject:target];
+	XCTAssertEqualObjects(diff, patch);
+	XCTAssertEqual([JFJSONPatch mergePatchFromObject:source toObject:[source copy]].count, 0);
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,166 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFJSONArray.h"
+#import "JFJSONObject.h"
+#import "JFJSONPath.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONPath_Tests : XCTestCase
+
+@property (strong, nonatomic, readonly) NSData* data;
+@property (strong, nonatomic, readonly) JFJSONObject* jsonObject;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONPath_Tests
+
+@synthesize data = _data;
+@synthesize jsonObject = _jsonObject;
+
+- (NSData*)data
+{
+	NSData* retObj = _data;
+	if(!retObj)
+	{
+		retObj = [@"{\"store\": {\"name\": \"Shop\", \"a/b\": 1, \"m~n\": 2, \"books\": [{\"title\": \"First\", \"price\": 8.95, \"tags\": [\"x\", \"]\"]}, {\"title\": \"Second\", \"price\": 12.99, \"isbn\": \"0-553\"}, {\"title\": \"Th\\u0069rd\", \"price\": 22.99, \"isbn\": \"0-395\"}]}, \"count\": 3}" dataUsingEncoding:NSUTF8StringEncoding];
+		_data = retObj;
+	}
+	return retObj;
+}
+
+- (JFJSONObject*)jsonObject
+{
+	JFJSONObject* retObj = _jsonObject;
+	if(!retObj)
+	{
+		retObj = [[JFJSONObject alloc] initWithData:self.data];
+		XCTAssertNotNil(retObj);
+		_jsonObject = retObj;
+	}
+	return retObj;
+}
+
+- (void)testInvalidPaths
+{
+	XCTAssertNil([JFJSONPath pathWithPointer:@"store"]);
+	XCTAssertNil([JFJSONPath pathWithPointer:@"/store/~2"]);
+	XCTAssertNil([JFJSONPath pathWithExpression:@"store.name"]);
+	XCTAssertNil([JFJSONPath pathWithExpression:@"$.store[0"]);
+	XCTAssertNil([JFJSONPath pathWithExpression:@"$.books[?(@.price =~ 1)]"]);
+}
+
+- (void)testPointer
+{
+	JFJSONObject* jsonObject = self.jsonObject;
+	
+	JFJSONPath* path = [JFJSONPath pathWithPointer:@"/store/books/1/title"];
+	XCTAssertNotNil(path);
+	XCTAssertTrue(path.isSingular);
+	XCTAssertEqualObjects([path firstValueInNode:jsonObject], @"Second");
+	XCTAssertEqualObjects([path firstValueInData:self.data], @"Second");
+	
+	XCTAssertEqualObjects([[JFJSONPath pathWithPointer:@"/store/a~1b"] firstValueInNode:jsonObject], @1);
+	XCTAssertEqualObjects([[JFJSONPath pathWithPointer:@"/store/m~0n"] firstValueInData:self.data], @2);
+	XCTAssertEqualObjects([[JFJSONPath pathWithPointer:@"/store/books/2/title"] firstValueInData:self.data], @"Third");
+	XCTAssertNil([[JFJSONPath pathWithPointer:@"/store/books/3"] firstValueInNode:jsonObject]);
+	XCTAssertNil([[JFJSONPath pathWithPointer:@"/store/books/01"] firstValueInData:self.data]);
+	
+	JFJSONPath* rootPath = [JFJSONPath pathWithPointer:@""];
+	XCTAssertEqualObjects([rootPath firstValueInNode:jsonObject], jsonObject);
+	XCTAssertEqualObjects([rootPath firstValueInData:self.data], jsonObject.dictionaryValue);
+}
+
+- (void)testExpression
+{
+	JFJSONObject* jsonObject = self.jsonObject;
+	NSData* data = self.data;
+	
+	JFJSONPath* path = [JFJSONPath pathWithExpression:@"$.store.books[*].title"];
+	XCTAssertNotNil(path);
+	XCTAssertFalse(path.isSingular);
+	NSArray* expected = @[@"First", @"Second", @"Third"];
+	XCTAssertEqualObjects([path valuesInNode:jsonObject], expected);
+	XCTAssertEqualObjects([path valuesInData:data], expected);
+	
+	path = [JFJSONPath pathWithExpression:@"$['store'].books[-1].price"];
+	XCTAssertEqualObjects([path firstValueInNode:jsonObject], @22.99);
+	XCTAssertEqualObjects([path firstValueInData:data], @22.99);
+	
+	path = [JFJSONPath pathWithExpression:@"$.store.books[?(@.isbn)].title"];
+	expected = @[@"Second", @"Third"];
+	XCTAssertEqualObjects([path valuesInNode:jsonObject], expected);
+	XCTAssertEqualObjects([path valuesInData:data], expected);
+	
+	path = [JFJSONPath pathWithExpression:@"$.store.books[?(@.price < 10)].title"];
+	XCTAssertEqualObjects([path valuesInNode:jsonObject], @[@"First"]);
+	XCTAssertEqualObjects([path valuesInData:data], @[@"First"]);
+	
+	path = [JFJSONPath pathWithExpression:@"$.store.books[?(@.title == 'Second')].price"];
+	XCTAssertEqualObjects([path firstValueInNode:jsonObject], @12.99);
+	XCTAssertEqualObjects([path firstValueInData:data], @12.99);
+	
+	path = [JFJSONPath pathWithExpression:@"$.store.books[0].tags[?(@ != 'x')]"];
+	XCTAssertEqualObjects([path valuesInData:data], @[@"]"]);
+}
+
+- (void)testInvalidData
+{
+	JFJSONPath* path = [JFJSONPath pathWithPointer:@"/store/books/0"];
+	XCTAssertNil([path valuesInData:[@"{\"store\": {\"books\": [" dataUsingEncoding:NSUTF8StringEncoding]]);
+	XCTAssertEqualObjects([path valuesInData:[@"{\"store\": 1}" dataUsingEncoding:NSUTF8StringEncoding]], @[]);
+}
+
+- (void)testPerformance
+{
+	NSMutableArray<JFJSONObject*>* documents = [NSMutableArray<JFJSONObject*> arrayWithCapacity:10000];
+	for(NSUInteger index = 0; index < 10000; index++)
+		[documents addObject:[self.jsonObject copy]];
+	
+	JFJSONPath* path = [JFJSONPath pathWithPointer:@"/store/books/2/isbn"];
+	[self measureBlock:^{
+		for(JFJSONObject* document in documents)
+			XCTAssertNotNil([path firstValueInNode:document]);
+	}];
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -348,6 +348,26 @@ API_AVAILABLE(ios(8.0), macos(10.7))
 	XCTAssertEqualObjects(source, result);
 }
 
+- (void)testNumbers
+{
+	JFJSONSerializer* serializer = self.serializer;
+	
+	NSArray<id<JFJSONConvertibleValue>>* source = @[@(0.1 + 0.2), @(1e21), @(1.5e-7), @(9007199254740993LL), @(INT64_MAX), @(INT64_MIN)];
+	
+	NSString* string = [serializer stringFromArray:source];
+	XCTAssertEqualObjects(string, @"[0.30000000000000004,1e+21,1.5e-7,9007199254740993,9223372036854775807,-9223372036854775808]");
+	
+	NSArray<id<JFJSONConvertibleValue>>* result = [serializer arrayFromString:string];
+	XCTAssertNotNil(result);
+	XCTAssertEqualObjects(source, result);
+	XCTAssertEqual(((NSNumber*)result[3]).longLongValue, 9007199254740993LL);
+	
+	string = [serializer stringFromArray:@[@(0.15f)]];
+	XCTAssertEqualObjects(string, @"[0.15]");
+	
+	string = [serializer stringFromArray:@[@(NAN)]];
+	XCTAssertNil(string);
+}
 @end
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
@@ -0,0 +1,207 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#import "JFJSONArray.h"
+#import "JFJSONDocument.h"
+#import "JFJSONObject.h"
+#import "JFJSONWriter.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFJSONWriter_Tests : XCTestCase
+
+- (NSString*)stringWithBufferSize:(NSUInteger)bufferSize block:(void (^)(JFJSONWriter* writer))block;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFJSONWriter_Tests
+
+- (NSString*)stringWithBufferSize:(NSUInteger)bufferSize block:(void (^)(JFJSONWriter* writer))block
+{
+	NSOutputStream* stream = [NSOutputStream outputStreamToMemory];
+	[stream open];
+	
+	JFJSONWriter* writer = [[JFJSONWriter alloc] initWithOutputStream:stream bufferSize:bufferSize];
+	block(writer);
+	
+	NSError* error = nil;
+	XCTAssertTrue([writer flushWithError:&error], @"Failed to flush the writer. [error = '%@']", error);
+	XCTAssertTrue(writer.isComplete);
+	[stream close];
+	
+	NSData* data = [stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+	XCTAssertEqual(data.length, writer.bytesCount);
+	return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+}
+
+- (void)testErrors
+{
+	NSOutputStream* stream = [NSOutputStream outputStreamToMemory];
+	[stream open];
+	
+	JFJSONWriter* writer = [JFJSONWriter writerWithOutputStream:stream];
+	XCTAssertTrue([writer beginObject]);
+	XCTAssertFalse([writer writeInteger:1]);
+	XCTAssertEqual(writer.error.code, JFJSONWriterErrorInvalidState);
+	XCTAssertFalse([writer writeKey:@"a"]);
+	
+	NSError* error = nil;
+	XCTAssertFalse([writer flushWithError:&error]);
+	XCTAssertEqualObjects(error.domain, JFJSONWriter.errorDomain);
+	
+	writer = [JFJSONWriter writerWithOutputStream:stream];
+	XCTAssertTrue([writer beginArray]);
+	XCTAssertFalse([writer endObject]);
+	XCTAssertEqual(writer.error.code, JFJSONWriterErrorInvalidState);
+	
+	writer = [JFJSONWriter writerWithOutputStream:stream];
+	XCTAssertTrue([writer beginArray]);
+	XCTAssertFalse([writer writeDouble:NAN]);
+	XCTAssertEqual(writer.error.code, JFJSONWriterErrorInvalidValue);
+	
+	writer = [JFJSONWriter writerWithOutputStream:stream];
+	XCTAssertFalse([writer writeValue:(id<JFJSONConvertibleValue>)@[[NSDate date]]]);
+	XCTAssertEqual(writer.error.code, JFJSONWriterErrorInvalidValue);
+	
+	writer = [JFJSONWriter writerWithOutputStream:stream];
+	XCTAssertTrue([writer writeNull]);
+	XCTAssertFalse([writer writeNull]);
+	XCTAssertEqual(writer.error.code, JFJSONWriterErrorInvalidState);
+	
+	[stream close];
+}
+
+- (void)testFileDescriptor
+{
+	NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+	int fileDescriptor = open(path.fileSystemRepresentation, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	XCTAssertGreaterThanOrEqual(fileDescriptor, 0);
+	
+	JFJSONWriter* writer = [[JFJSONWriter alloc] initWithFileDescriptor:fileDescriptor bufferSize:64];
+	XCTAssertTrue([writer beginArray]);
+	for(NSUInteger index = 0; index < 1000; index++)
+		XCTAssertTrue([writer writeInteger:(int64_t)index]);
+	XCTAssertTrue([writer endArray]);
+	XCTAssertTrue([writer flushWithError:NULL]);
+	close(fileDescriptor);
+	
+	JFJSONArray* array = [JFJSONArray arrayWithData:[NSData dataWithContentsOfFile:path]];
+	XCTAssertEqual(array.count, 1000);
+	XCTAssertEqualObjects([array numberAtIndex:999], @999);
+	[[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+- (void)testNodes
+{
+	JFJSONObject* object = [JFJSONObject objectWithString:@"{\"a\": [1, 2.5, \"x\", null, true], \"b\": {\"c\": {}}}"];
+	NSString* string = [self stringWithBufferSize:0 block:^(JFJSONWriter* writer) {
+		XCTAssertTrue([writer writeValue:object]);
+	}];
+	XCTAssertEqualObjects([JFJSONObject objectWithString:string], object);
+	
+	double doubles[] = {0.1, -2.5, 1e21};
+	JFJSONArray* packed = [[JFJSONArray alloc] initWithDoubles:doubles count:3];
+	string = [self stringWithBufferSize:0 block:^(JFJSONWriter* writer) {
+		XCTAssertTrue([writer writeValue:packed]);
+	}];
+	XCTAssertEqualObjects(string, @"[0.1,-2.5,1e+21]");
+	
+	JFJSONDocument* document = [JFJSONDocument documentWithData:[@"[{\"k\": [\"v\", 3]}, false]" dataUsingEncoding:NSUTF8StringEncoding]];
+	string = [self stringWithBufferSize:0 block:^(JFJSONWriter* writer) {
+		XCTAssertTrue([writer writeValue:document.root]);
+	}];
+	XCTAssertEqualObjects(string, @"[{\"k\":[\"v\",3]},false]");
+	
+	string = [self stringWithBufferSize:0 block:^(JFJSONWriter* writer) {
+		XCTAssertTrue([writer writeValue:@[@{@"k": @[@1, NSNull.null]}, @"s"]]);
+	}];
+	XCTAssertEqualObjects(string, @"[{\"k\":[1,null]},\"s\"]");
+}
+
+- (void)testPerformance
+{
+	JFJSONObject* record = [JFJSONObject objectWithString:@"{\"id\": 1, \"name\": \"Record\", \"score\": 0.5, \"active\": true, \"tags\": [\"a\", \"b\"]}"];
+	int fileDescriptor = open("/dev/null", O_WRONLY);
+	
+	[self measureBlock:^{
+		JFJSONWriter* writer = [JFJSONWriter writerWithFileDescriptor:fileDescriptor];
+		[writer beginArray];
+		for(NSUInteger index = 0; index < 100000; index++)
+			[writer writeValue:record];
+		[writer endArray];
+		XCTAssertTrue([writer flushWithError:NULL]);
+	}];
+	
+	close(fileDescriptor);
+}
+
+- (void)testValues
+{
+	NSString* string = [self stringWithBufferSize:64 block:^(JFJSONWriter* writer) {
+		XCTAssertTrue([writer beginObject]);
+		XCTAssertTrue([writer writeKey:@"bool"]);
+		XCTAssertTrue([writer writeBoolean:YES]);
+		XCTAssertTrue([writer writeKey:@"double"]);
+		XCTAssertTrue([writer writeDouble:0.15]);
+		XCTAssertTrue([writer writeKey:@"float"]);
+		XCTAssertTrue([writer writeNumber:@(0.15f)]);
+		XCTAssertTrue([writer writeKey:@"integers"]);
+		XCTAssertTrue([writer beginArray]);
+		XCTAssertTrue([writer writeInteger:INT64_MIN]);
+		XCTAssertTrue([writer writeNumber:@(UINT64_MAX)]);
+		XCTAssertTrue([writer endArray]);
+		XCTAssertTrue([writer writeValue:@"\"quoted\"\n\ttab\\ \u00e8 \x01" forKey:@"string"]);
+		XCTAssertTrue([writer writeKey:@"long"]);
+		XCTAssertTrue([writer writeString:[@"" stringByPaddingToLength:5000 withString:@"abc" startingAtIndex:0]]);
+		XCTAssertTrue([writer writeKey:@"null"]);
+		XCTAssertTrue([writer writeNull]);
+		XCTAssertTrue([writer endObject]);
+		XCTAssertEqual(writer.depth, 0);
+	}];
+	
+	NSString* expected = [NSString stringWithFormat:@"{\"bool\":true,\"double\":0.15,\"float\":0.15,\"integers\":[-9223372036854775808,18446744073709551615],\"string\":\"\\\"quoted\\\"\\n\\ttab\\\\ \u00e8 \\u0001\",\"long\":\"%@\",\"null\":null}", [@"" stringByPaddingToLength:5000 withString:@"abc" startingAtIndex:0]];
+	XCTAssertEqualObjects(string, expected);
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
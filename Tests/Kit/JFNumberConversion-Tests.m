@@ -0,0 +1,175 @@
+//
+//	The MIT License (MIT)
+//
+//	Copyright © 2026 Jacopo Filié
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files (the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions:
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+//
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+#import <XCTest/XCTest.h>
+
+#import "JFNumberConversion.h"
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_BEGIN
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+@interface JFNumberConversion_Tests : XCTestCase
+
+- (double)parseString:(NSString*)string;
+- (NSString*)printDouble:(double)value;
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFNumberConversion_Tests
+
+- (double)parseString:(NSString*)string
+{
+	const char* bytes = string.UTF8String;
+	double retVal = 0;
+	XCTAssertTrue(JFNumberConversionParseDouble(bytes, strlen(bytes), &retVal), @"The string '%@' should be a valid number.", string);
+	return retVal;
+}
+
+- (NSString*)printDouble:(double)value
+{
+	char buffer[JFNumberConversionBufferSize];
+	NSUInteger length = JFNumberConversionPrintDouble(value, buffer);
+	XCTAssertEqual(length, strlen(buffer));
+	return @(buffer);
+}
+
+- (void)testParsing
+{
+	XCTAssertEqual([self parseString:@"0"], 0.0);
+	XCTAssertTrue(signbit([self parseString:@"-0"]));
+	XCTAssertEqual([self parseString:@"0.15"], 0.15);
+	XCTAssertEqual([self parseString:@"-123.456e-2"], -1.23456);
+	XCTAssertEqual([self parseString:@"1E5"], 1e5);
+	XCTAssertEqual([self parseString:@"0.30000000000000004"], 0.1 + 0.2);
+	
+	// Halfway cases are rounded to even.
+	XCTAssertEqual([self parseString:@"9007199254740993"], 9007199254740992.0);
+	XCTAssertEqual([self parseString:@"9007199254740995"], 9007199254740996.0);
+	XCTAssertEqual([self parseString:@"1.00000000000000011102230246251565404236316680908203125"], 1.0);
+	XCTAssertEqual([self parseString:@"1.00000000000000011102230246251565404236316680908203126"], nextafter(1.0, 2.0));
+	
+	// Limits.
+	XCTAssertEqual([self parseString:@"1.7976931348623157e308"], DBL_MAX);
+	XCTAssertEqual([self parseString:@"2.2250738585072014e-308"], DBL_MIN);
+	XCTAssertEqual([self parseString:@"4.9406564584124654e-324"], nextafter(0.0, 1.0));
+	XCTAssertEqual([self parseString:@"1e400"], INFINITY);
+	XCTAssertEqual([self parseString:@"-1e400"], -INFINITY);
+	XCTAssertEqual([self parseString:@"1e-400"], 0.0);
+	
+	NSArray<NSString*>* invalidStrings = @[@"", @"-", @"01", @".5", @"1.", @"1e", @"1e+", @"+1", @" 1", @"1.5x", @"0x10", @"nan", @"inf"];
+	for(NSString* string in invalidStrings)
+	{
+		double value;
+		XCTAssertFalse(JFNumberConversionParseDouble(string.UTF8String, strlen(string.UTF8String), &value), @"The string '%@' should not be a valid number.", string);
+	}
+}
+
+- (void)testPerformance
+{
+	NSUInteger count = 100000;
+	double* values = malloc(count * sizeof(double));
+	for(NSUInteger index = 0; index < count; index++)
+		values[index] = (double)arc4random() / UINT32_MAX * 1000.0;
+	
+	[self measureBlock:^{
+		char buffer[JFNumberConversionBufferSize];
+		for(NSUInteger index = 0; index < count; index++)
+		{
+			double value;
+			NSUInteger length = JFNumberConversionPrintDouble(values[index], buffer);
+			JFNumberConversionParseDouble(buffer, length, &value);
+			XCTAssertEqual(value, values[index]);
+		}
+	}];
+	
+	free(values);
+}
+
+- (void)testPrinting
+{
+	XCTAssertEqualObjects([self printDouble:0], @"0");
+	XCTAssertEqualObjects([self printDouble:-0.0], @"-0");
+	XCTAssertEqualObjects([self printDouble:0.1], @"0.1");
+	XCTAssertEqualObjects([self printDouble:-0.15], @"-0.15");
+	XCTAssertEqualObjects([self printDouble:100], @"100");
+	XCTAssertEqualObjects([self printDouble:123456789.25], @"123456789.25");
+	XCTAssertEqualObjects([self printDouble:0.1 + 0.2], @"0.30000000000000004");
+	XCTAssertEqualObjects([self printDouble:1e20], @"100000000000000000000");
+	XCTAssertEqualObjects([self printDouble:1e21], @"1e+21");
+	XCTAssertEqualObjects([self printDouble:0.000001], @"0.000001");
+	XCTAssertEqualObjects([self printDouble:1.5e-7], @"1.5e-7");
+	XCTAssertEqualObjects([self printDouble:DBL_MAX], @"1.7976931348623157e+308");
+	XCTAssertEqualObjects([self printDouble:nextafter(0.0, 1.0)], @"5e-324");
+	XCTAssertEqualObjects([self printDouble:NAN], @"nan");
+	XCTAssertEqualObjects([self printDouble:-INFINITY], @"-inf");
+	
+	// Values whose shortest and closest representation is missed by approximate algorithms like Grisu2.
+	XCTAssertEqualObjects([self printDouble:7.71077127039924e155], @"7.71077127039924e+155");
+	XCTAssertEqualObjects([self printDouble:4.125638199772312e-9], @"4.125638199772312e-9");
+	XCTAssertEqualObjects([self printDouble:392479526538200800.0], @"392479526538200800");
+	XCTAssertEqualObjects([self printDouble:1.5481607399467313e-211], @"1.5481607399467313e-211");
+	
+	char buffer[JFNumberConversionBufferSize];
+	JFNumberConversionPrintFloat(0.15f, buffer);
+	XCTAssertEqualObjects(@(buffer), @"0.15");
+	JFNumberConversionPrintFloat(FLT_MAX, buffer);
+	XCTAssertEqualObjects(@(buffer), @"3.4028235e+38");
+	JFNumberConversionPrintFloat(0.0478515625f, buffer);
+	XCTAssertEqualObjects(@(buffer), @"0.047851562");
+}
+
+- (void)testRoundTrip
+{
+	char buffer[JFNumberConversionBufferSize];
+	for(NSUInteger index = 0; index < 100000; index++)
+	{
+		uint64_t bits = ((uint64_t)arc4random() << 32) | arc4random();
+		double value;
+		memcpy(&value, &bits, sizeof(value));
+		if(isnan(value) || isinf(value))
+			continue;
+		
+		double result;
+		NSUInteger length = JFNumberConversionPrintDouble(value, buffer);
+		XCTAssertTrue(JFNumberConversionParseDouble(buffer, length, &result));
+		XCTAssertEqual(memcmp(&result, &value, sizeof(value)), 0, @"The string '%s' should convert back to '%.17g'.", buffer, value);
+		XCTAssertEqual(result, strtod(buffer, NULL));
+	}
+}
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+
+NS_ASSUME_NONNULL_END
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
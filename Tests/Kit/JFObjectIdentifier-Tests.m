@@ -41,20 +41,30 @@ NS_ASSUME_NONNULL_BEGIN
 // =================================================================================================
 
 - (void)testCurrentClearID;
+- (void)testCurrentConcurrentGetID;
+- (void)testCurrentDeallocation;
 - (void)testCurrentGetID;
+- (void)testCurrentObjectForID;
+- (void)testCurrentPerformance;
+- (void)testCurrentReplacedIdentifier;
 - (void)testCurrentResetID;
+- (void)testCurrentResetIDPerformance;
 - (void)testLegacyClearID;
 - (void)testLegacyGetID;
+- (void)testLegacyObjectForID;
+- (void)testLegacyPerformance;
+- (void)testLegacyReclaimSlots;
 - (void)testLegacyResetID;
 - (void)testSharedClearID;
 - (void)testSharedGetID;
+- (void)testSharedObjectForID;
 - (void)testSharedResetID;
 
 // =================================================================================================
 // MARK: Methods - Utilities
 // =================================================================================================
 
-- (JFObjectIdentifier* _Nullable)newCurrentIdentifier API_AVAILABLE(ios(8.0), macos(10.8));
+- (JFObjectIdentifier* _Nullable)newCurrentIdentifier API_AVAILABLE(ios(10.0), macos(10.12));
 - (JFObjectIdentifier*)newLegacyIdentifier;
 
 @end
@@ -70,7 +80,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)testCurrentClearID
 {
-	if(@available(macOS 10.8, *))
+	if(@available(macOS 10.12, iOS 10.0, *))
 	{
 		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
 		NSObject* object = [NSObject new];
@@ -80,9 +90,64 @@ NS_ASSUME_NONNULL_BEGIN
 	}
 }
 
+- (void)testCurrentConcurrentGetID
+{
+	if(@available(macOS 10.12, iOS 10.0, *))
+	{
+		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
+		
+		NSUInteger count = 1000;
+		NSMutableArray<NSObject*>* objects = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+		for(NSUInteger i = 0; i < count; i++)
+			[objects addObject:[NSObject new]];
+		
+		// Every thread must see the same ID for the same object, even when it's registered concurrently.
+		NSUInteger threadsCount = 8;
+		NSUInteger* objectIDs = calloc(threadsCount * count, sizeof(NSUInteger));
+		dispatch_apply(threadsCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+			for(NSUInteger i = 0; i < count; i++)
+				objectIDs[thread * count + i] = [identifier getID:[objects objectAtIndex:i]];
+		});
+		
+		NSMutableSet<NSNumber*>* uniqueIDs = [NSMutableSet<NSNumber*> setWithCapacity:count];
+		for(NSUInteger i = 0; i < count; i++)
+		{
+			[uniqueIDs addObject:@(objectIDs[i])];
+			for(NSUInteger thread = 1; thread < threadsCount; thread++)
+				XCTAssertEqual(objectIDs[i], objectIDs[thread * count + i]);
+		}
+		free(objectIDs);
+		
+		XCTAssertEqual(uniqueIDs.count, count);
+		XCTAssertEqual(identifier.count, count);
+	}
+}
+
+- (void)testCurrentDeallocation
+{
+	if(@available(macOS 10.12, iOS 10.0, *))
+	{
+		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
+		NSObject* survivor = [NSObject new];
+		[identifier getID:survivor];
+		
+		@autoreleasepool
+		{
+			for(NSUInteger i = 0; i < 100; i++)
+				[identifier getID:[NSObject new]];
+		}
+		
+		// The deallocated objects leave the registry immediately.
+		XCTAssertEqual(identifier.count, 1);
+		
+		[identifier clearID:survivor];
+		XCTAssertEqual(identifier.count, 0);
+	}
+}
+
 - (void)testCurrentGetID
 {
-	if(@available(macOS 10.8, *))
+	if(@available(macOS 10.12, iOS 10.0, *))
 	{
 		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
 		NSObject* object = [NSObject new];
@@ -91,9 +156,98 @@ NS_ASSUME_NONNULL_BEGIN
 	}
 }
 
+- (void)testCurrentObjectForID
+{
+	if(@available(macOS 10.12, iOS 10.0, *))
+	{
+		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
+		NSObject* object = [NSObject new];
+		NSUInteger objectID = [identifier getID:object];
+		XCTAssertEqual([identifier objectForID:objectID], object);
+		XCTAssertNil([identifier objectForID:objectID + 1]);
+		
+		[identifier clearID:object];
+		XCTAssertNil([identifier objectForID:objectID]);
+		
+		NSUInteger newObjectID = [identifier getID:object];
+		XCTAssertNil([identifier objectForID:objectID]);
+		XCTAssertEqual([identifier objectForID:newObjectID], object);
+		
+		@autoreleasepool
+		{
+			objectID = [identifier getID:[NSObject new]];
+		}
+		XCTAssertNil([identifier objectForID:objectID]);
+	}
+}
+
+- (void)testCurrentPerformance
+{
+	if(@available(macOS 10.12, iOS 10.0, *))
+	{
+		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
+		
+		NSUInteger count = 1000;
+		NSMutableArray<NSObject*>* objects = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+		for(NSUInteger i = 0; i < count; i++)
+		{
+			NSObject* object = [NSObject new];
+			[objects addObject:object];
+			[identifier getID:object];
+		}
+		
+		// The lookups of different threads should not wait for each other.
+		NSUInteger threadsCount = NSProcessInfo.processInfo.activeProcessorCount;
+		[self measureBlock:^{
+			dispatch_apply(threadsCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+				for(NSUInteger iteration = 0; iteration < 100; iteration++)
+				{
+					for(NSObject* object in objects)
+						[identifier getID:object];
+				}
+			});
+		}];
+	}
+}
+
+- (void)testCurrentReplacedIdentifier
+{
+	if(@available(macOS 10.12, iOS 10.0, *))
+	{
+		JFObjectIdentifier* identifier;
+		
+		NSUInteger count = 100;
+		@autoreleasepool
+		{
+			NSMutableArray<NSObject*>* objects = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+			for(NSUInteger i = 0; i < count; i++)
+				[objects addObject:[NSObject new]];
+			
+			// The released identifiers leave their sentinels on the objects, and the next ones are likely to be allocated at the same address.
+			for(NSUInteger iteration = 0; iteration < 10; iteration++)
+			{
+				@autoreleasepool
+				{
+					JFObjectIdentifier* releasedIdentifier = [self newCurrentIdentifier];
+					for(NSObject* object in objects)
+						[releasedIdentifier getID:object];
+				}
+			}
+			
+			identifier = [self newCurrentIdentifier];
+			for(NSObject* object in objects)
+				[identifier getID:object];
+			XCTAssertEqual(identifier.count, count);
+		}
+		
+		// The objects are deallocated: their IDs must be removed, whatever the identifiers that registered them before.
+		XCTAssertEqual(identifier.count, 0);
+	}
+}
+
 - (void)testCurrentResetID
 {
-	if(@available(macOS 10.8, *))
+	if(@available(macOS 10.12, iOS 10.0, *))
 	{
 		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
 		NSObject* object = [NSObject new];
@@ -103,6 +257,26 @@ NS_ASSUME_NONNULL_BEGIN
 	}
 }
 
+- (void)testCurrentResetIDPerformance
+{
+	if(@available(macOS 10.12, iOS 10.0, *))
+	{
+		JFObjectIdentifier* identifier = [self newCurrentIdentifier];
+		
+		NSUInteger count = 100000;
+		NSMutableArray<NSObject*>* objects = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+		for(NSUInteger i = 0; i < count; i++)
+			[objects addObject:[NSObject new]];
+		
+		// Resetting an ID must not depend on the number of registered objects.
+		[self measureBlock:^{
+			for(NSObject* object in objects)
+				[identifier resetID:[identifier getID:object]];
+		}];
+		XCTAssertEqual(identifier.count, 0);
+	}
+}
+
 - (void)testLegacyCleanRegistry
 {
 	JFObjectIdentifier* identifier = [self newLegacyIdentifier];
@@ -158,6 +332,57 @@ NS_ASSUME_NONNULL_BEGIN
 	XCTAssertEqual(objectID, [identifier getID:object]);
 }
 
+- (void)testLegacyObjectForID
+{
+	JFObjectIdentifier* identifier = [self newLegacyIdentifier];
+	NSObject* object = [NSObject new];
+	NSUInteger objectID = [identifier getID:object];
+	XCTAssertEqual([identifier objectForID:objectID], object);
+	XCTAssertNil([identifier objectForID:objectID + 1]);
+	
+	[identifier resetID:objectID];
+	XCTAssertNil([identifier objectForID:objectID]);
+	XCTAssertEqual([identifier objectForID:[identifier getID:object]], object);
+}
+
+- (void)testLegacyPerformance
+{
+	JFObjectIdentifier* identifier = [self newLegacyIdentifier];
+	
+	NSUInteger count = 10000;
+	NSMutableArray<NSObject*>* objects = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	for(NSUInteger i = 0; i < count; i++)
+		[objects addObject:[NSObject new]];
+	
+	// Identifying the objects must take linear time, not quadratic.
+	[self measureBlock:^{
+		for(NSObject* object in objects)
+			[identifier getID:object];
+		for(NSObject* object in objects)
+			[identifier clearID:object];
+	}];
+}
+
+- (void)testLegacyReclaimSlots
+{
+	JFObjectIdentifier* identifier = [self newLegacyIdentifier];
+	NSObject* survivor = [NSObject new];
+	NSUInteger survivorID = [identifier getID:survivor];
+	
+	NSUInteger count = 1000;
+	@autoreleasepool
+	{
+		for(NSUInteger i = 0; i < count; i++)
+			[identifier getID:[NSObject new]];
+	}
+	
+	// Every operation reclaims a few slots of the deallocated objects, without waiting for a timer.
+	for(NSUInteger i = 0; i < count * 2; i++)
+		XCTAssertEqual([identifier getID:survivor], survivorID);
+	
+	XCTAssertEqual(identifier.count, 1);
+}
+
 - (void)testLegacyResetID
 {
 	JFObjectIdentifier* identifier = [self newLegacyIdentifier];
@@ -184,6 +409,16 @@ NS_ASSUME_NONNULL_BEGIN
 	XCTAssertEqual(objectID, [identifier getID:object]);
 }
 
+- (void)testSharedObjectForID
+{
+	NSObject* object = [NSObject new];
+	NSUInteger objectID = [JFObjectIdentifier getID:object];
+	XCTAssertEqual([JFObjectIdentifier objectForID:objectID], object);
+	
+	[JFObjectIdentifier clearID:object];
+	XCTAssertNil([JFObjectIdentifier objectForID:objectID]);
+}
+
 - (void)testSharedResetID
 {
 	JFObjectIdentifier* identifier = [JFObjectIdentifier sharedInstance];
@@ -197,7 +432,7 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - Utilities
 // =================================================================================================
 
-- (JFObjectIdentifier* _Nullable)newCurrentIdentifier API_AVAILABLE(ios(8.0), macos(10.8))
+- (JFObjectIdentifier* _Nullable)newCurrentIdentifier API_AVAILABLE(ios(10.0), macos(10.12))
 {
 	return [[JFObjectIdentifier alloc] initWithCurrentImplementation];
 }
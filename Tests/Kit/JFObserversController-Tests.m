@@ -51,6 +51,15 @@ NS_ASSUME_NONNULL_BEGIN
 // =================================================================================================
 
 - (void)testAsynchronousNotifications;
+- (void)testConcurrentNotifications;
+- (void)testConcurrentNotificationsSlowObserver;
+- (void)testDeallocatedObservers;
+- (void)testNotificationsOrder;
+- (void)testNotificationsPerformance;
+- (void)testObservers;
+- (void)testSerialNotifications;
+- (void)testSerialNotificationsLatestOnly;
+- (void)testSerialNotificationsPerformance;
 - (void)testSynchronousNotifications;
 
 @end
@@ -118,6 +127,314 @@ NS_ASSUME_NONNULL_BEGIN
 	[self waitForExpectationsWithTimeout:1 handler:handler];
 }
 
+- (void)testConcurrentNotifications
+{
+	JFObserversController<NSObject*>* controller = [JFObserversController<NSObject*> new];
+	
+	NSUInteger count = 20;
+	NSMutableArray<NSObject*>* observers = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		NSObject* observer = [NSObject new];
+		[observers addObject:observer];
+		[controller addObserver:observer];
+	}
+	
+	XCTestExpectation* expectation = [self expectationWithDescription:MethodName];
+	NSUInteger maxConcurrentObservers = 4;
+	NSUInteger __block running = 0;
+	NSUInteger __block maxRunning = 0;
+	NSUInteger __block notified = 0;
+	[controller notifyObservers:^(NSObject* observer) {
+		NSUInteger current = __atomic_add_fetch(&running, 1, __ATOMIC_ACQ_REL);
+		NSUInteger max = __atomic_load_n(&maxRunning, __ATOMIC_ACQUIRE);
+		while((current > max) && !__atomic_compare_exchange_n(&maxRunning, &max, current, NO, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+		[NSThread sleepForTimeInterval:0.01];
+		__atomic_add_fetch(&notified, 1, __ATOMIC_ACQ_REL);
+		__atomic_sub_fetch(&running, 1, __ATOMIC_ACQ_REL);
+	} maxConcurrentObservers:maxConcurrentObservers timeout:0 completion:^{
+		[expectation fulfill];
+	}];
+	
+	[self waitForExpectationsWithTimeout:5 handler:nil];
+	XCTAssertEqual(__atomic_load_n(&notified, __ATOMIC_ACQUIRE), count);
+	XCTAssertLessThanOrEqual(__atomic_load_n(&maxRunning, __ATOMIC_ACQUIRE), maxConcurrentObservers);
+	XCTAssertGreaterThan(__atomic_load_n(&maxRunning, __ATOMIC_ACQUIRE), 1);
+}
+
+- (void)testConcurrentNotificationsSlowObserver
+{
+	JFObserversController<NSObject*>* controller = self.observerController;
+	NSArray<NSObject*>* observers = self.observers;
+	NSObject* slowObserver = observers.firstObject;
+	
+	XCTestExpectation* timeoutExpectation = [self expectationWithDescription:@"Timeout"];
+	XCTestExpectation* finishExpectation = [self expectationWithDescription:@"Finish"];
+	controller.slowObserverHandler = ^(NSObject* observer, NSTimeInterval duration, BOOL finished) {
+		XCTAssertEqual(observer, slowObserver);
+		if(finished)
+		{
+			XCTAssertGreaterThanOrEqual(duration, 0.5);
+			[finishExpectation fulfill];
+		}
+		else
+			[timeoutExpectation fulfill];
+	};
+	
+	// With a single slot, the slow observer must give it back once timed out, or the others would wait for it to finish.
+	XCTestExpectation* completionExpectation = [self expectationWithDescription:@"Completion"];
+	NSUInteger __block notified = 0;
+	[controller notifyObservers:^(NSObject* observer) {
+		if(observer == slowObserver)
+			[NSThread sleepForTimeInterval:0.5];
+		else
+			__atomic_add_fetch(&notified, 1, __ATOMIC_ACQ_REL);
+	} maxConcurrentObservers:1 timeout:0.05 completion:^{
+		[completionExpectation fulfill];
+	}];
+	
+	[self waitForExpectations:@[timeoutExpectation, completionExpectation, finishExpectation] timeout:5 enforceOrder:NO];
+	XCTAssertEqual(__atomic_load_n(&notified, __ATOMIC_ACQUIRE), observers.count - 1);
+}
+
+- (void)testDeallocatedObservers
+{
+	JFObserversController<NSObject*>* controller = self.observerController;
+	
+	@autoreleasepool
+	{
+		for(NSUInteger i = 0; i < 10; i++)
+			[controller addObserver:[NSObject new]];
+	}
+	
+	// The deallocated observers are not counted, even before they are removed.
+	XCTAssertEqual(controller.count, self.observers.count);
+	
+	// The deallocated observers are skipped and, once found, removed.
+	NSUInteger __block counter = 0;
+	[controller notifyObservers:^(NSObject* observer) {
+		counter++;
+	} async:NO];
+	XCTAssertEqual(counter, self.observers.count);
+	XCTAssertEqual(controller.count, self.observers.count);
+}
+
+- (void)testNotificationsOrder
+{
+	JFObserversController<NSObject*>* controller = [JFObserversController<NSObject*> new];
+	
+	NSUInteger count = 100;
+	NSMutableArray<NSObject*>* observers = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		NSObject* observer = [NSObject new];
+		[observers addObject:observer];
+		[controller addObserver:observer];
+	}
+	
+	// An observer removed and added again goes to the end of the list.
+	NSObject* movedObserver = observers.firstObject;
+	[controller removeObserver:movedObserver];
+	[controller addObserver:movedObserver];
+	[observers removeObjectAtIndex:0];
+	[observers addObject:movedObserver];
+	
+	NSMutableArray<NSObject*>* notified = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	[controller notifyObservers:^(NSObject* observer) {
+		[notified addObject:observer];
+	} async:NO];
+	XCTAssertEqualObjects(notified, observers);
+	
+	XCTestExpectation* expectation = [self expectationWithDescription:MethodName];
+	NSMutableArray<NSObject*>* seriallyNotified = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	[controller notifyObserversSerially:^(NSObject* observer) {
+		[seriallyNotified addObject:observer];
+		if(seriallyNotified.count == count)
+			[expectation fulfill];
+	}];
+	[self waitForExpectationsWithTimeout:1 handler:nil];
+	XCTAssertEqualObjects(seriallyNotified, observers);
+	
+	// Removing observers keeps the order of the others, both when the removed entries are compacted while removing and when they are compacted by the next notification.
+	NSMutableArray<NSObject*>* remaining = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		if(i % 3 == 0)
+			[remaining addObject:observers[i]];
+		else
+			[controller removeObserver:observers[i]];
+	}
+	[controller removeObserver:remaining.lastObject];
+	[remaining removeLastObject];
+	XCTAssertEqual(controller.count, remaining.count);
+	
+	[notified removeAllObjects];
+	[controller notifyObservers:^(NSObject* observer) {
+		[notified addObject:observer];
+	} async:NO];
+	XCTAssertEqualObjects(notified, remaining);
+}
+
+- (void)testNotificationsPerformance
+{
+	JFObserversController<NSObject*>* controller = [JFObserversController<NSObject*> new];
+	
+	NSUInteger count = 5000;
+	NSMutableArray<NSObject*>* observers = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		NSObject* observer = [NSObject new];
+		[observers addObject:observer];
+		[controller addObserver:observer];
+	}
+	
+	NSUInteger __block counter = 0;
+	[self measureBlock:^{
+		for(NSUInteger i = 0; i < 100; i++)
+		{
+			[controller notifyObservers:^(NSObject* observer) {
+				counter++;
+			} async:NO];
+		}
+		
+		// Observers keep coming and going while the notifications are sent.
+		for(NSObject* observer in observers)
+		{
+			[controller removeObserver:observer];
+			[controller addObserver:observer];
+		}
+	}];
+	XCTAssertGreaterThan(counter, 0);
+}
+
+- (void)testObservers
+{
+	JFObserversController<NSObject*>* controller = self.observerController;
+	NSArray<NSObject*>* observers = self.observers;
+	XCTAssertEqual(controller.count, observers.count);
+	
+	// Adding an observer twice has no effect.
+	[controller addObserver:observers.firstObject];
+	XCTAssertEqual(controller.count, observers.count);
+	
+	[controller removeObserver:observers.firstObject];
+	[controller removeObserver:observers.firstObject];
+	XCTAssertEqual(controller.count, observers.count - 1);
+	
+	NSMutableSet<NSObject*>* notified = [NSMutableSet<NSObject*> set];
+	[controller notifyObservers:^(NSObject* observer) {
+		[notified addObject:observer];
+	} async:NO];
+	XCTAssertFalse([notified containsObject:observers.firstObject]);
+	XCTAssertEqual(notified.count, observers.count - 1);
+	
+	// The snapshot of an asynchronous notification is taken when it's sent.
+	XCTestExpectation* expectation = [self expectationWithDescription:MethodName];
+	NSUInteger __block counter = 0;
+	[controller notifyObservers:^(NSObject* observer) {
+		if(++counter == observers.count - 1)
+			[expectation fulfill];
+	}];
+	[controller addObserver:observers.firstObject];
+	[self waitForExpectationsWithTimeout:1 handler:nil];
+	XCTAssertEqual(controller.count, observers.count);
+}
+
+- (void)testSerialNotifications
+{
+	JFObserversController<NSObject*>* controller = self.observerController;
+	NSArray<NSObject*>* observers = self.observers;
+	XCTestExpectation* expectation = [self expectationWithDescription:MethodName];
+	
+	// The deliveries happen on the serial queue of the controller, one after the other.
+	NSUInteger count = 1000;
+	NSMapTable<NSObject*, NSMutableArray<NSNumber*>*>* received = [NSMapTable strongToStrongObjectsMapTable];
+	for(NSObject* observer in observers)
+		[received setObject:[NSMutableArray<NSNumber*> arrayWithCapacity:count] forKey:observer];
+	
+	NSUInteger __block completed = 0;
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		[controller notifyObserversSerially:^(NSObject* observer) {
+			[[received objectForKey:observer] addObject:@(i)];
+			if((i == count - 1) && (++completed == observers.count))
+				[expectation fulfill];
+		}];
+	}
+	
+	[self waitForExpectationsWithTimeout:5 handler:nil];
+	
+	for(NSObject* observer in observers)
+	{
+		NSArray<NSNumber*>* values = [received objectForKey:observer];
+		XCTAssertEqual(values.count, count);
+		for(NSUInteger i = 0; i < values.count; i++)
+			XCTAssertEqualObjects(values[i], @(i));
+	}
+}
+
+- (void)testSerialNotificationsLatestOnly
+{
+	JFObserversController<NSObject*>* controller = self.observerController;
+	controller.coalescingPolicy = JFObserversControllerCoalescingPolicyLatestOnly;
+	NSArray<NSObject*>* observers = self.observers;
+	XCTestExpectation* expectation = [self expectationWithDescription:MethodName];
+	
+	NSUInteger count = 1000;
+	NSMapTable<NSObject*, NSMutableArray<NSNumber*>*>* received = [NSMapTable strongToStrongObjectsMapTable];
+	for(NSObject* observer in observers)
+		[received setObject:[NSMutableArray<NSNumber*> array] forKey:observer];
+	
+	NSUInteger __block completed = 0;
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		[controller notifyObserversSerially:^(NSObject* observer) {
+			[[received objectForKey:observer] addObject:@(i)];
+			if((i == count - 1) && (++completed == observers.count))
+				[expectation fulfill];
+		}];
+	}
+	
+	[self waitForExpectationsWithTimeout:5 handler:nil];
+	
+	// Some notifications may be dropped, but the ones delivered keep their order and the latest one is never lost.
+	for(NSObject* observer in observers)
+	{
+		NSArray<NSNumber*>* values = [received objectForKey:observer];
+		XCTAssertEqualObjects(values.lastObject, @(count - 1));
+		for(NSUInteger i = 1; i < values.count; i++)
+			XCTAssertLessThan(values[i - 1].unsignedIntegerValue, values[i].unsignedIntegerValue);
+	}
+}
+
+- (void)testSerialNotificationsPerformance
+{
+	JFObserversController<NSObject*>* controller = [JFObserversController<NSObject*> new];
+	
+	NSUInteger count = 100;
+	NSMutableArray<NSObject*>* observers = [NSMutableArray<NSObject*> arrayWithCapacity:count];
+	for(NSUInteger i = 0; i < count; i++)
+	{
+		NSObject* observer = [NSObject new];
+		[observers addObject:observer];
+		[controller addObserver:observer];
+	}
+	
+	[self measureBlock:^{
+		dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+		NSUInteger notificationsCount = 10000;
+		NSUInteger __block completed = 0;
+		for(NSUInteger i = 0; i < notificationsCount; i++)
+		{
+			[controller notifyObserversSerially:^(NSObject* observer) {
+				if((i == notificationsCount - 1) && (++completed == count))
+					dispatch_semaphore_signal(semaphore);
+			}];
+		}
+		dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+	}];
+}
+
 - (void)testSynchronousNotifications
 {
 	NSUInteger __block counter = self.observers.count;
@@ -243,6 +243,24 @@ NS_ASSUME_NONNULL_BEGIN
 	string = JFStringFromDouble(-0.15);
 	result = @"-0.15";
 	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromDouble(0.1 + 0.2);
+	result = @"0.30000000000000004";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromDouble(1e21);
+	result = @"1e+21";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromDouble(1234567);
+	result = @"1234567";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromDouble(1.5e-7);
+	result = @"1.5e-7";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromDouble(-0.0);
+	result = @"-0";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromDouble(5e-324);
+	result = @"5e-324";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
 	
 	// JFStringFromFloat
 	string = JFStringFromFloat(0);
@@ -254,6 +272,15 @@ NS_ASSUME_NONNULL_BEGIN
 	string = JFStringFromFloat((float)-0.15);
 	result = @"-0.15";
 	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromFloat((float)16777217);
+	result = @"16777216";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromFloat((float)1.5e-7);
+	result = @"1.5e-7";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
+	string = JFStringFromFloat((float)3.4028235e38);
+	result = @"3.4028235e+38";
+	XCTAssert([string isEqualToString:result], @"The string value is '%@'; it should be '%@'.", string, result);
 	
 	// JFStringFromFloat32
 	string = JFStringFromFloat32(0);
@@ -36,27 +36,46 @@ NS_ASSUME_NONNULL_BEGIN
 
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
+/**
+ * A switch that jams when it's closed: it overrides one of the transition methods for a transition of the table.
+ */
+@interface JFSwitchMachineTestsJammedSwitch : JFSwitchMachine
+
+@end
+
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
 @interface JFSwitchMachine_Tests : XCTestCase <JFStateMachineDelegate>
 
 // =================================================================================================
 // MARK: Properties - Tests
 // =================================================================================================
 
-@property (strong, nonatomic, nullable)	XCTestExpectation*	expectation;
-@property (strong, nonatomic, nullable)	JFSwitchMachine*	machine;
-@property (assign, nonatomic)			BOOL				shouldFail;
-@property (assign, nonatomic)			BOOL				shouldFullfillOnDidPerform;
+@property (assign, nonatomic)			JFStateMachineBackend	backend;
+@property (strong, nonatomic, nullable)	XCTestExpectation*		expectation;
+@property (strong, nonatomic, nullable)	JFSwitchMachine*		machine;
+@property (assign, nonatomic)			BOOL					shouldFail;
+@property (assign, nonatomic)			BOOL					shouldFullfillOnDidPerform;
 
 // =================================================================================================
 // MARK: Methods - Tests
 // =================================================================================================
 
+- (void)measureTransitionsWithBackend:(JFStateMachineBackend)backend;
 - (void)setUpWithDescription:(NSString*)description beginningState:(JFSwitchState)state failureExpected:(BOOL)shouldFail;
 - (void)testChainedTransitions;
 - (void)testCloseFailure;
 - (void)testCloseSuccess;
 - (void)testOpenFailure;
 - (void)testOpenSuccess;
+- (void)testSerialExecutorChainedTransitions;
+- (void)testSerialExecutorOpenFailure;
+- (void)testSerialExecutorWaitUntilFinished;
+- (void)testTransitionTable;
+- (void)testTransitionTableOverride;
+- (void)testTransitionsPerformanceOperationQueue;
+- (void)testTransitionsPerformanceSerialExecutor;
 - (void)verifyResult:(JFSwitchState)expectedResult;
 - (void)waitExpectingResult:(JFSwitchState)expectedResult;
 
@@ -71,6 +90,7 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Properties - Tests
 // =================================================================================================
 
+@synthesize backend = _backend;
 @synthesize expectation = _expectation;
 @synthesize machine = _machine;
 @synthesize shouldFail = _shouldFail;
@@ -80,16 +100,36 @@ NS_ASSUME_NONNULL_BEGIN
 // MARK: Methods - Tests
 // =================================================================================================
 
+- (void)measureTransitionsWithBackend:(JFStateMachineBackend)backend
+{
+	NSUInteger count = 1000;
+	self.shouldFullfillOnDidPerform = NO;
+	
+	[self measureBlock:^{
+		JFSwitchMachine* machine = [[JFSwitchMachine alloc] initWithState:JFSwitchStateClosed delegate:self backend:backend];
+		for(NSUInteger i = 0; i < count; i++)
+		{
+			if(i % 2 == 0)
+				[machine open];
+			else
+				[machine close];
+		}
+		[machine waitUntilAllTransitionsAreFinished];
+		XCTAssertEqual(machine.state, JFSwitchStateClosed);
+	}];
+}
+
 - (void)setUpWithDescription:(NSString*)description beginningState:(JFSwitchState)state failureExpected:(BOOL)shouldFail
 {
 	self.expectation = [self expectationWithDescription:description];
-	self.machine = [[JFSwitchMachine alloc] initWithState:state delegate:self];
+	self.machine = [[JFSwitchMachine alloc] initWithState:state delegate:self backend:self.backend];
 	self.shouldFail = shouldFail;
 	self.shouldFullfillOnDidPerform = YES;
 }
 
 - (void)tearDown
 {
+	self.backend = JFStateMachineBackendOperationQueue;
 	self.expectation = nil;
 	self.machine = nil;
 	self.shouldFail = NO;
@@ -143,6 +183,101 @@ NS_ASSUME_NONNULL_BEGIN
 	[self waitExpectingResult:JFSwitchStateOpen];
 }
 
+- (void)testSerialExecutorChainedTransitions
+{
+	self.backend = JFStateMachineBackendSerialExecutor;
+	[self testChainedTransitions];
+}
+
+- (void)testSerialExecutorOpenFailure
+{
+	self.backend = JFStateMachineBackendSerialExecutor;
+	[self testOpenFailure];
+}
+
+- (void)testSerialExecutorWaitUntilFinished
+{
+	self.backend = JFStateMachineBackendSerialExecutor;
+	[self setUpWithDescription:MethodName beginningState:JFSwitchStateClosed failureExpected:NO];
+	self.expectation.expectedFulfillmentCount = 2;
+	
+	JFSwitchMachine* machine = self.machine;
+	[machine perform:[[JFStateMachineTransition alloc] initWithTransition:JFSwitchTransitionOpening context:nil closure:nil] waitUntilFinished:YES];
+	XCTAssertEqual(machine.state, JFSwitchStateOpen);
+	
+	// A transition that is not allowed anymore when it's executed is cancelled, and the following ones still run.
+	[machine open];
+	[machine close];
+	[machine waitUntilAllTransitionsAreFinished];
+	XCTAssertEqual(machine.state, JFSwitchStateClosed);
+	
+	[self waitExpectingResult:JFSwitchStateClosed];
+}
+
+- (void)testTransitionTable
+{
+	JFSwitchMachine* machine = [[JFSwitchMachine alloc] initWithDelegate:self];
+	XCTAssertEqualObjects([machine beginningStatesForTransition:JFSwitchTransitionClosing], @[@(JFSwitchStateOpen)]);
+	XCTAssertEqualObjects([machine beginningStatesForTransition:JFSwitchTransitionOpening], @[@(JFSwitchStateClosed)]);
+	XCTAssertEqual([machine endingStateForFailedTransition:JFSwitchTransitionOpening], JFSwitchStateClosed);
+	XCTAssertEqual([machine endingStateForSucceededTransition:JFSwitchTransitionOpening], JFSwitchStateOpen);
+	XCTAssertEqual([machine endingStateForSucceededTransition:JFSwitchTransitionNone], JFStateNotAvailable);
+	
+	// The ending states can depend on the beginning state.
+	JFStateMachineTransitionRule rules[] = {
+		{0, 1, 1, 0},
+		{1, 1, 2, 1},
+		{2, 2, 0, 2},
+	};
+	JFStateMachineTransitionTable* table = [[JFStateMachineTransitionTable alloc] initWithRules:rules count:sizeof(rules) / sizeof(rules[0])];
+	XCTAssertTrue([table containsTransition:1]);
+	XCTAssertFalse([table containsTransition:3]);
+	XCTAssertTrue([table canPerformTransition:1 fromState:1]);
+	XCTAssertFalse([table canPerformTransition:1 fromState:2]);
+	XCTAssertFalse([table canPerformTransition:2 fromState:-5]);
+	XCTAssertEqual([table endingStateForSucceededTransition:1 fromState:0], 1);
+	XCTAssertEqual([table endingStateForSucceededTransition:1 fromState:1], 2);
+	XCTAssertEqual([table endingStateForSucceededTransition:1], JFStateNotAvailable);
+	XCTAssertEqual([table endingStateForFailedTransition:2], 2);
+	XCTAssertEqualObjects([table beginningStatesForTransition:1], (@[@0, @1]));
+	
+	JFStateMachineTransitionRule conflictingRules[] = {
+		{0, 1, 1, 0},
+		{0, 1, 2, 0},
+	};
+	XCTAssertThrowsSpecificNamed([[JFStateMachineTransitionTable alloc] initWithRules:conflictingRules count:2], NSException, NSInvalidArgumentException);
+	
+	JFStateMachineTransitionRule sparseRules[] = {
+		{0, 1, 1, 0},
+		{NSIntegerMax, 1, 1, 0},
+	};
+	XCTAssertThrowsSpecificNamed([[JFStateMachineTransitionTable alloc] initWithRules:sparseRules count:2], NSException, NSInvalidArgumentException);
+}
+
+- (void)testTransitionTableOverride
+{
+	[self setUpWithDescription:MethodName beginningState:JFSwitchStateOpen failureExpected:NO];
+	
+	// The overridden method wins over the table, while the other ones still answer from it.
+	JFSwitchMachine* machine = [[JFSwitchMachineTestsJammedSwitch alloc] initWithState:JFSwitchStateOpen delegate:self backend:self.backend];
+	self.machine = machine;
+	XCTAssertEqual([machine endingStateForSucceededTransition:JFSwitchTransitionClosing], JFSwitchStateOpen);
+	XCTAssertEqualObjects([machine beginningStatesForTransition:JFSwitchTransitionClosing], @[@(JFSwitchStateOpen)]);
+	
+	[machine close];
+	[self waitExpectingResult:JFSwitchStateOpen];
+}
+
+- (void)testTransitionsPerformanceOperationQueue
+{
+	[self measureTransitionsWithBackend:JFStateMachineBackendOperationQueue];
+}
+
+- (void)testTransitionsPerformanceSerialExecutor
+{
+	[self measureTransitionsWithBackend:JFStateMachineBackendSerialExecutor];
+}
+
 - (void)verifyResult:(JFSwitchState)expectedResult
 {
 	JFSwitchMachine* machine = self.machine;
@@ -179,6 +314,25 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+// –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
+// MARK: -
+
+@implementation JFSwitchMachineTestsJammedSwitch
+
+// =================================================================================================
+// MARK: Methods - State
+// =================================================================================================
+
+- (JFState)endingStateForSucceededTransition:(JFStateTransition)transition
+{
+	if(transition == JFSwitchTransitionClosing)
+		return JFSwitchStateOpen;
+	
+	return [super endingStateForSucceededTransition:transition];
+}
+
+@end
+
 // –––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––––
 
 NS_ASSUME_NONNULL_END